@@ -124,6 +124,9 @@ typedef struct EbBufferHeaderType {
     double cb_ssim;
 
     struct SvtMetadataArray *metadata;
+
+    // preset used to encode the picture, varies under real-time speed control
+    int8_t enc_mode;
 } EbBufferHeaderType;
 
 typedef struct EbComponentType {
@@ -72,14 +72,17 @@ typedef struct EbSvtAv1DecConfiguration {
      * Default is 0 */
     EbBool skip_film_grain;
 
-    /* Skip N output frames in the display order.
+    /* Skip N output frames in the display order. Skipped frames are not
+     * output and the ones not used as reference are not reconstructed.
      *
      * 0 = decodes from the start of the bitstream.
      *
      * Default is 0. */
     uint64_t skip_frames;
 
-    /* Maximum number of frames in the sequence to be decoded.
+    /* Maximum number of frames in the sequence to be decoded. Frames after
+     * the last one are not output and the ones not used as reference are not
+     * reconstructed.
      *
      * 0 = decodes the full bitstream.
      *
@@ -135,11 +138,59 @@ typedef struct EbSvtAv1DecConfiguration {
      * Default is 1
      */
     uint32_t active_channel_count;
+
+    /* Log the memory allocated by each decoder module on deinit.
+     *
+     * Default is 0. */
     uint32_t stat_report;
     /* Decoder internal bit-depth is set to 16-bit even if the bitstream is 8-bit
  *
  * Default is 0. */
     EbBool is_16bit_pipeline;
+
+    /* Size of the input and output queues of the asynchronous API
+     * (svt_av1_dec_send_data / svt_av1_dec_receive_picture). When set, temporal
+     * units are decoded by a library thread so that the application can read
+     * and write data while the decoder is busy. The synchronous API
+     * (svt_av1_dec_frame / svt_av1_dec_get_picture) is then unavailable.
+     *
+     * 0 = asynchronous API disabled. Default is 0. */
+    uint32_t async_queue_size;
+
+    /* Optional callback invoked from the library thread each time a picture
+     * is added to the output queue of the asynchronous API. The argument is
+     * the p_app_data pointer given to svt_av1_dec_init_handle().
+     *
+     * Default is NULL. */
+    void (*picture_ready_cb)(void *p_app_data);
+
+    /* Fast decode for thumbnailing and seeking : only key frames are
+     * reconstructed and output, the other frames are dropped after their
+     * frame header is parsed.
+     *
+     * Default is 0. */
+    EbBool keyframes_only;
+
+    /* Skip deblocking, CDEF and loop restoration of frames that are not used
+     * as reference. The output of those frames is no longer conformant but no
+     * error propagates to other frames. Applies to single-threaded decoding.
+     *
+     * Default is 0. */
+    EbBool skip_non_ref_filters;
+
+    /* Output pictures are downscaled by (1 << output_downscale) in each
+     * dimension with a box filter. Film grain is not applied to downscaled
+     * pictures. Valid values are 0 to 3.
+     *
+     * Default is 0. */
+    uint32_t output_downscale;
+
+    /* Entropy decode only : tile data is parsed but no picture is
+     * reconstructed or output. Meant to benchmark the parser, forces
+     * single-threaded decoding.
+     *
+     * Default is 0. */
+    EbBool parse_only;
 } EbSvtAv1DecConfiguration;
 
 /* STEP 1: Call the library to construct a Component Handle.
@@ -201,6 +252,43 @@ EB_API EbErrorType svt_av1_dec_get_picture(EbComponentType    *svt_dec_component
                                            EbAV1StreamInfo    *stream_info,
                                            EbAV1FrameInfo     *frame_info);
 
+/* STEP 4 (asynchronous): Submits one temporal unit to the decoder. The data
+     * is copied to the library input queue and decoded by a library thread.
+     * Blocks while async_queue_size temporal units are pending. A NULL data
+     * pointer or a zero data_size signals the end of the stream.
+     *
+     * Parameter:
+     * @ *svt_dec_component     Decoder handle
+     * @ *data                  Buffer with data
+     * @ data_size              Data size in bytes
+     *
+     *  Returns EB_ErrorNone if the data has been queued successfully.
+     *  Returns EB_DecDecodingError if a previously queued temporal unit failed. */
+EB_API EbErrorType svt_av1_dec_send_data(EbComponentType *svt_dec_component, const uint8_t *data,
+                                         const size_t data_size, uint32_t is_annexb);
+
+/* STEP 5 (asynchronous): Get the next picture from the output queue, in
+     * display order. The picture buffers are swapped with the ones of
+     * p_buffer, which must have been allocated with malloc(): the library
+     * reuses them for a later picture and frees them on deinit.
+     *
+     * Parameter:
+     * @ *svt_dec_component     Decoder handle.
+     * @ *p_buffer              Header pointer, picture buffer.
+     * @ *stream_info           Sequence header info
+     * @ *frame_info            Last decoded frame info
+     * @ wait                   Blocks until a picture is available when set
+     *
+     *  Returns EB_ErrorNone if the picture has been returned successfully.
+     *  Returns EB_DecNoOutputPicture if wait is 0 and no picture is ready.
+     *  Returns EB_NoErrorFifoShutdown once the end of stream has been
+     *  reached and all pictures have been returned. */
+EB_API EbErrorType svt_av1_dec_receive_picture(EbComponentType    *svt_dec_component,
+                                               EbBufferHeaderType *p_buffer,
+                                               EbAV1StreamInfo    *stream_info,
+                                               EbAV1FrameInfo     *frame_info,
+                                               uint8_t             wait);
+
 /* STEP 6: Deinitialize decoder library.
      *
      * Parameter:
@@ -91,6 +91,8 @@ typedef enum {
     SUPERRES_RANDOM, // All frames are coded at a random scale, and super-resolved.
     SUPERRES_QTHRESH, // Superres scale for a frame is determined based on q_index.
     SUPERRES_AUTO, // Automatically select superres for appropriate frames.
+    SUPERRES_DYNAMIC, // Inter frames drop to a lower scale when the encoder falls behind real time
+                      // or rate control runs out of bits, and go back up when it catches up.
     SUPERRES_MODES
 } SUPERRES_MODE;
 
@@ -116,6 +118,35 @@ typedef enum {
     SVT_AV1_STREAM_INFO_END,
 } SVT_AV1_STREAM_INFO_ID;
 
+/* Type of the private data nodes attached to an input picture, see EbPrivDataNode */
+typedef enum {
+    FRAME_RC_PARAMS_EVENT, // EbFrameRcParams, per-frame external rate control decisions
+    PRIVATE_DATA_TYPES
+} PrivDataType;
+
+/* Private data attached to an input picture: p_app_private of the input
+ * EbBufferHeaderType points to the head of a list of nodes. The data is
+ * copied by svt_av1_enc_send_picture and can be freed once it returns. */
+typedef struct EbPrivDataNode {
+    PrivDataType           node_type;
+    void                  *data; // pointer to the data of node_type
+    uint32_t               size; // size of data in bytes
+    struct EbPrivDataNode *next; // next node, NULL for the last one
+} EbPrivDataNode;
+
+/* Per-frame rate control decisions of an external controller. When present,
+ * the frame qindex bypasses the internal rate control decision. */
+typedef struct EbFrameRcParams {
+    /* Frame qindex [1-255], clipped to the min/max allowed QP, 0: internal decision */
+    uint8_t qindex;
+    /* Per-SB delta qindex in raster SB order, NULL: no delta q. SBs beyond
+     * sb_delta_qindex_count use the frame qindex */
+    const int8_t *sb_delta_qindex;
+    uint32_t      sb_delta_qindex_count;
+    /* Scaling of the rate distortion lambda in 1/128 units, 0 or 128: no scaling */
+    uint16_t lambda_scale;
+} EbFrameRcParams;
+
 /*!\brief Generic fixed size buffer structure
  *
  * This structure is able to hold a reference to any fixed size buffer.
@@ -166,6 +197,13 @@ typedef struct EbSvtAv1EncConfiguration {
      *
      * Default is 3. */
     uint32_t hierarchical_levels;
+    /* Pick the hierarchy depth of each mini GOP from the first pass statistics of its
+     * pictures, high motion mini GOPs being split in shorter ones. The depth selected for
+     * the clip is the maximum and sizes the buffers. Only used by the middle and final
+     * passes of a multi-pass encode.
+     *
+     * Default is 0. */
+    EbBool enable_adaptive_mini_gop;
 
     /* Prediction structure used to construct GOP. There are two main structures
      * supported, which are: Low Delay (P or B) and Random Access.
@@ -246,6 +284,27 @@ typedef struct EbSvtAv1EncConfiguration {
      * Default is 0. */
     uint32_t compressed_ten_bit_format;
 
+    /* 10-bit input in the P010 layout: one luma plane followed by one interleaved
+     * CbCr plane, with every sample stored in the 10 most significant bits of a
+     * 16-bit word. The CbCr plane is passed in EbSvtIOFormat.cb with cb_stride in
+     * 16-bit words, cr is not used. The input is split into the 8-bit and 2-bit
+     * planes while it is copied, so no planar conversion is needed before encoding.
+     * Only applicable when encoder_bit_depth is 10 and compressed_ten_bit_format is 0.
+     *
+     * Default is 0. */
+    uint32_t p010_input;
+
+    /* Keep a full 16-bit copy of the 10-bit source picture for the lifetime of
+     * the picture. Temporal filtering, mode decision, encode pass and the loop
+     * filters then read the source in place from that copy instead of packing
+     * the 8-bit and 2-bit planes again for every reference and superblock, at
+     * the cost of one extra 16-bit frame per picture in flight. Motion
+     * estimation and the references still use the 8-bit + 2-bit planes.
+     * Only applicable when encoder_bit_depth is 10 and super-resolution is off.
+     *
+     * Default is 0. */
+    uint32_t hbd_16bit_source;
+
     /* Instruct the library to calculate the recon to source for PSNR calculation
     *
     * Default is 0.*/
@@ -321,6 +380,13 @@ typedef struct EbSvtAv1EncConfiguration {
      *
      * Default is 1. */
     uint32_t scene_change_detection;
+    /* Number of future pictures the scene change detector looks at before deciding
+     * on a cut. 0 decides on the current picture alone (fades only, no flash
+     * detection), 1 uses the next picture to reject flashes and fades, 2 also
+     * rejects two-picture flashes.
+     *
+     * Default is 2. */
+    uint32_t scene_change_look_ahead;
 
     /* When RateControlMode is set to 1 it's best to set this parameter to be
      * equal to the Intra period value (such is the default set by the encoder).
@@ -393,6 +459,14 @@ typedef struct EbSvtAv1EncConfiguration {
     /* Indicates the maximum amount of data that may be buffered by the decoding
      * application, and is expressed in units of time(milliseconds).*/
     int64_t maximum_buffer_size_ms;
+    /* Flag to let CBR rate control charge the decoder buffer model with the
+     * estimated size of pictures still being encoded, as soon as the mode
+     * decision rates are known, instead of waiting for packetization feedback.
+     * The estimates depend on thread timing, set to 0 for run-to-run
+     * reproducible CBR output.
+     *
+     * Default is 1. */
+    EbBool cbr_inflight_estimates;
 
     /* recode_loop indicates the recode levels,
      * DISALLOW_RECODE = 0, No recode.
@@ -613,6 +687,33 @@ typedef struct EbSvtAv1EncConfiguration {
     * 3: High-level decoder speed optimization (fastest decode)
     */
     uint8_t fast_decode;
+    /* Real-time speed control target in frames per second.
+    * When set, the encoder compares its throughput to a live source running at
+    * this rate and moves the preset of each picture between enc_mode and the
+    * fastest preset to keep up. The preset used is reported per picture in the
+    * output packet. Single pass only.
+    * 0: off
+    Default is 0. */
+    uint32_t target_fps;
+    /* Chunked encoding: index of the first frame of the chunk in the two-pass
+    * stats (rc_stats_buffer). The application sends the frames of the chunk only.
+    * Rate control keeps the statistics of the whole title, so chunks of a title
+    * encoded by separate instances with the same configuration can be
+    * concatenated into one stream. Final pass only.
+    Default is 0. */
+    uint32_t chunk_start_frame;
+    /* Number of frames of the chunk, 0 = up to the end of the stats.
+    Default is 0. */
+    uint32_t chunk_frames;
+    /* Luma resolution the multi-pass stats in rc_stats_buffer were collected at.
+    * When it differs from the source resolution, the stats are rescaled in place
+    * to the source resolution on import, so a single analysis pass, typically run on
+    * the smallest rendition, can drive every rendition of an ABR ladder. The
+    * key frame and mini-GOP decisions taken from the stats are then the same in
+    * all the renditions. Both 0 means the stats match the source resolution.
+    Default is 0. */
+    uint32_t stats_source_width;
+    uint32_t stats_source_height;
 } EbSvtAv1EncConfiguration;
 
 /**
@@ -683,7 +784,8 @@ EB_API EbErrorType svt_av1_enc_stream_header_release(EbBufferHeaderType *stream_
      *
      * Parameter:
      * @ *svt_enc_component  Encoder handler.
-     * @ *p_buffer           Header pointer, picture buffer. */
+     * @ *p_buffer           Header pointer, picture buffer. p_app_private may point to
+     *                       a list of EbPrivDataNode. */
 EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType    *svt_enc_component,
                                             EbBufferHeaderType *p_buffer);
 
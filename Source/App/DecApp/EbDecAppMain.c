@@ -154,6 +154,7 @@ int32_t main(int32_t argc, char *argv[]) {
 
     uint64_t stop_after = 0;
     uint32_t in_frame   = 0;
+    uint64_t in_bytes   = 0;
 
     Md5Context    md5_ctx;
     unsigned char md5_digest[16];
@@ -213,19 +214,55 @@ int32_t main(int32_t argc, char *argv[]) {
             EbAV1StreamInfo *stream_info = (EbAV1StreamInfo *)malloc(sizeof(EbAV1StreamInfo));
             EbAV1FrameInfo  *frame_info  = (EbAV1FrameInfo *)malloc(sizeof(EbAV1FrameInfo));
 
+            /* Skipped frames are still fed to the library, which keeps the
+               references and drops the rest */
             if (config_ptr->skip_frames)
                 fprintf(stderr, "Skipping first %" PRIu64 " frames.\n", config_ptr->skip_frames);
-            uint64_t skip_frame = config_ptr->skip_frames;
-            while (skip_frame) {
-                if (!read_input_frame(&input, &buf, &bytes_in_buffer, &buffer_size, NULL))
-                    break;
-                skip_frame--;
-            }
-            stop_after = config_ptr->frames_to_be_decoded;
+            stop_after = config_ptr->frames_to_be_decoded
+                ? config_ptr->skip_frames + config_ptr->frames_to_be_decoded
+                : 0;
             if (enable_md5)
                 md5_init(&md5_ctx);
+            if (config_ptr->async_queue_size) {
+                /* Decoding runs on a library thread : pictures are drained
+                   while reading ahead and the timer measures wall time */
+                dec_timer_start(&timer);
+                while (read_input_frame(&input, &buf, &bytes_in_buffer, &buffer_size, NULL)) {
+                    if (stop_after && in_frame >= stop_after)
+                        break;
+                    return_error |= svt_av1_dec_send_data(
+                        p_handle, buf, bytes_in_buffer, obu_ctx.is_annexb);
+                    in_frame++;
+                    in_bytes += bytes_in_buffer;
+
+                    while (svt_av1_dec_receive_picture(
+                               p_handle, recon_buffer, stream_info, frame_info, 0) ==
+                           EB_ErrorNone) {
+                        if (enable_md5)
+                            write_md5(recon_buffer, &md5_ctx);
+                        if (cli.out_file != NULL)
+                            write_frame(recon_buffer, &cli);
+                    }
+                    if (fps_frm) {
+                        dec_timer_mark(&timer);
+                        show_progress(in_frame, dec_timer_elapsed(&timer));
+                    }
+                }
+                /* Signal end of stream and drain the output queue */
+                return_error |= svt_av1_dec_send_data(p_handle, NULL, 0, obu_ctx.is_annexb);
+                while (svt_av1_dec_receive_picture(
+                           p_handle, recon_buffer, stream_info, frame_info, 1) == EB_ErrorNone) {
+                    if (enable_md5)
+                        write_md5(recon_buffer, &md5_ctx);
+                    if (cli.out_file != NULL)
+                        write_frame(recon_buffer, &cli);
+                }
+                dec_timer_mark(&timer);
+                dx_time = dec_timer_elapsed(&timer);
+            }
             // Input Loop Thread
-            while (read_input_frame(&input, &buf, &bytes_in_buffer, &buffer_size, NULL)) {
+            while (!config_ptr->async_queue_size &&
+                   read_input_frame(&input, &buf, &bytes_in_buffer, &buffer_size, NULL)) {
                 if (!stop_after || in_frame < stop_after) {
                     dec_timer_start(&timer);
 
@@ -236,6 +273,7 @@ int32_t main(int32_t argc, char *argv[]) {
                     dx_time += dec_timer_elapsed(&timer);
 
                     in_frame++;
+                    in_bytes += bytes_in_buffer;
 
                     if (svt_av1_dec_get_picture(p_handle, recon_buffer, stream_info, frame_info) !=
                         EB_DecNoOutputPicture) {
@@ -255,6 +293,12 @@ int32_t main(int32_t argc, char *argv[]) {
                 show_progress(in_frame, dx_time);
                 fprintf(stderr, "\n");
             }
+            if (config_ptr->parse_only && dx_time)
+                fprintf(stderr,
+                        "Parsed %" PRIu64 " bytes in %" PRIu64 " us (%.2f Mbit/s)\n",
+                        in_bytes,
+                        dx_time,
+                        (double)in_bytes * 8.0 / (double)dx_time);
 
             if (enable_md5) {
                 md5_final(md5_digest, &md5_ctx);
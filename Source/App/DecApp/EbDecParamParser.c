@@ -67,6 +67,28 @@ static void set_num_pframes(const char *value, EbSvtAv1DecConfiguration *cfg) {
         cfg->num_p_frames = 1;
     }
 };
+static void set_async_queue(const char *value, EbSvtAv1DecConfiguration *cfg) {
+    cfg->async_queue_size = strtoul(value, NULL, 0);
+};
+static void set_mem_report(const char *value, EbSvtAv1DecConfiguration *cfg) {
+    cfg->stat_report = strtoul(value, NULL, 0);
+};
+static void set_keyframes_only(const char *value, EbSvtAv1DecConfiguration *cfg) {
+    cfg->keyframes_only = (EbBool)strtoul(value, NULL, 0);
+};
+static void set_skip_filters(const char *value, EbSvtAv1DecConfiguration *cfg) {
+    cfg->skip_non_ref_filters = (EbBool)strtoul(value, NULL, 0);
+};
+static void set_output_downscale(const char *value, EbSvtAv1DecConfiguration *cfg) {
+    cfg->output_downscale = strtoul(value, NULL, 0);
+    if (cfg->output_downscale > 3) {
+        fprintf(stderr, "Warning : Invalid value for output downscale, setting value to 3. \n");
+        cfg->output_downscale = 3;
+    }
+};
+static void set_parse_only(const char *value, EbSvtAv1DecConfiguration *cfg) {
+    cfg->parse_only = (EbBool)strtoul(value, NULL, 0);
+};
 
 /**********************************
   * Config Entry Array
@@ -83,6 +105,12 @@ ConfigEntry config_entry[] = {
     {COLOUR_SPACE_TOKEN, "InputColourSpace", 1, set_colour_space},
     {THREADS_TOKEN, "ThreadCount", 1, set_num_thread},
     {FRAME_PLL_TOKEN, "PllFrameCount", 1, set_num_pframes},
+    {ASYNC_QUEUE_TOKEN, "AsyncQueueSize", 1, set_async_queue},
+    {MEM_REPORT_TOKEN, "MemoryReport", 0, set_mem_report},
+    {KEYFRAMES_ONLY_TOKEN, "KeyframesOnly", 0, set_keyframes_only},
+    {SKIP_FILTERS_TOKEN, "SkipNonRefFilters", 0, set_skip_filters},
+    {OUTPUT_DOWNSCALE_TOKEN, "OutputDownscale", 1, set_output_downscale},
+    {PARSE_ONLY_TOKEN, "ParseOnly", 0, set_parse_only},
     // Termination
     {NULL, NULL, 0, NULL}};
 
@@ -100,6 +128,12 @@ static void show_help() {
     H0(" -colour-space <arg>       Input picture colour space. [400, 420, 422, 444]\n");
     H0(" -threads <arg>            Disabled for now \n");
     H0(" -parallel-frames <arg>    Number of frames to be processed in parallel \n");
+    H0(" -async-queue <arg>        Decode asynchronously with n queued pictures [0: off] \n");
+    H0(" -mem-report               Print the decoder memory usage per module on exit \n");
+    H0(" -keyframes-only           Decode and output key frames only \n");
+    H0(" -skip-non-ref-filters     Skip in-loop filters of non reference frames \n");
+    H0(" -output-downscale <arg>   Downscale output pictures by 2^n. [0-3] \n");
+    H0(" -parse-only               Entropy decode only and report the parse rate in Mbit/s \n");
     H0(" -md5                      MD5 support flag \n");
     H0(" -fps-frm                  Show fps after each frame decoded\n");
     H0(" -fps-summary              Show fps summary");
@@ -46,6 +46,12 @@
 #define COLOUR_SPACE_TOKEN "-colour-space"
 #define THREADS_TOKEN "-threads"
 #define FRAME_PLL_TOKEN "-parallel-frames"
+#define ASYNC_QUEUE_TOKEN "-async-queue"
+#define MEM_REPORT_TOKEN "-mem-report"
+#define KEYFRAMES_ONLY_TOKEN "-keyframes-only"
+#define SKIP_FILTERS_TOKEN "-skip-non-ref-filters"
+#define OUTPUT_DOWNSCALE_TOKEN "-output-downscale"
+#define PARSE_ONLY_TOKEN "-parse-only"
 #define MD5_SUPPORT_TOKEN "-md5"
 #define FPS_FRM_TOKEN "-fps-frm"
 #define FPS_SUMMARY_TOKEN "-fps-summary"
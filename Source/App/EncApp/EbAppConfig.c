@@ -48,12 +48,17 @@
 #define PASS_TOKEN "--pass"
 #define TWO_PASS_STATS_TOKEN "--stats"
 #define PASSES_TOKEN "--passes"
+#define CHUNK_START_TOKEN "--chunk-start"
+#define CHUNK_FRAMES_TOKEN "--chunk-frames"
+#define STATS_SRC_WIDTH_TOKEN "--stats-src-width"
+#define STATS_SRC_HEIGHT_TOKEN "--stats-src-height"
 #define STAT_FILE_TOKEN "--stat-file"
 #define INPUT_PREDSTRUCT_FILE_TOKEN "--pred-struct-file"
 #define WIDTH_TOKEN "-w"
 #define HEIGHT_TOKEN "-h"
 #define NUMBER_OF_PICTURES_TOKEN "-n"
 #define BUFFERED_INPUT_TOKEN "--nb"
+#define LADDER_SOURCE_TOKEN "--ladder-src"
 #define NO_PROGRESS_TOKEN "--no-progress" // tbd if it should be removed
 #define PROGRESS_TOKEN "--progress"
 #define QP_TOKEN "-q"
@@ -70,8 +75,11 @@
 #define FRAME_RATE_DENOMINATOR_TOKEN "--fps-denom"
 #define ENCODER_COLOR_FORMAT "--color-format"
 #define INPUT_COMPRESSED_TEN_BIT_FORMAT "--compressed-ten-bit-format"
+#define INPUT_P010_TOKEN "--p010-input"
+#define HBD_16BIT_SOURCE_TOKEN "--hbd-16bit-source"
 #define HIERARCHICAL_LEVELS_TOKEN "--hierarchical-levels" // no Eval
 #define PRED_STRUCT_TOKEN "--pred-struct"
+#define ADAPTIVE_MINI_GOP_TOKEN "--adaptive-mini-gop"
 #define PROFILE_TOKEN "--profile"
 #define INTRA_PERIOD_TOKEN "--intra-period"
 #define TIER_TOKEN "--tier"
@@ -106,6 +114,7 @@
 #define BUFFER_SIZE_TOKEN "--buf-sz"
 #define BUFFER_INITIAL_SIZE_TOKEN "--buf-initial-sz"
 #define BUFFER_OPTIMAL_SIZE_TOKEN "--buf-optimal-sz"
+#define CBR_INFLIGHT_EST_TOKEN "--cbr-inflight-est"
 #define RECODE_LOOP_TOKEN "--recode-loop"
 #define ENABLE_TPL_LA_TOKEN "--enable-tpl-la"
 #define SUPER_BLOCK_SIZE_TOKEN "--sb-size"
@@ -113,6 +122,7 @@
 #define TILE_COL_TOKEN "--tile-columns"
 
 #define SCENE_CHANGE_DETECTION_TOKEN "--scd"
+#define SCENE_CHANGE_LOOK_AHEAD_TOKEN "--scd-lad"
 #define INJECTOR_TOKEN "--inj" // no Eval
 #define INJECTOR_FRAMERATE_TOKEN "--inj-frm-rt" // no Eval
 #define ASM_TYPE_TOKEN "--asm"
@@ -137,6 +147,7 @@
 
 //double dash
 #define PRESET_TOKEN "--preset"
+#define TARGET_FPS_TOKEN "--target-fps"
 #define QP_FILE_NEW_TOKEN "--qpfile"
 #define INPUT_DEPTH_TOKEN "--input-depth"
 #define KEYINT_TOKEN "--keyint"
@@ -299,6 +310,19 @@ static void set_two_pass_stats(const char *value, EbConfig *cfg) {
 #endif
 }
 
+static void set_chunk_start(const char *value, EbConfig *cfg) {
+    cfg->config.chunk_start_frame = strtoul(value, NULL, 0);
+}
+static void set_chunk_frames(const char *value, EbConfig *cfg) {
+    cfg->config.chunk_frames = strtoul(value, NULL, 0);
+}
+static void set_stats_src_width(const char *value, EbConfig *cfg) {
+    cfg->config.stats_source_width = strtoul(value, NULL, 0);
+}
+static void set_stats_src_height(const char *value, EbConfig *cfg) {
+    cfg->config.stats_source_height = strtoul(value, NULL, 0);
+}
+
 static void set_passes(const char *value, EbConfig *cfg) {
     (void)value;
     (void)cfg;
@@ -326,6 +350,9 @@ static void set_cfg_frames_to_be_encoded(const char *value, EbConfig *cfg) {
 static void set_buffered_input(const char *value, EbConfig *cfg) {
     cfg->buffered_input = strtol(value, NULL, 0);
 };
+static void set_ladder_source(const char *value, EbConfig *cfg) {
+    cfg->ladder_source = strtoul(value, NULL, 0);
+};
 static void set_no_progress(const char *value, EbConfig *cfg) {
     switch (value ? *value : '1') {
     case '0': cfg->progress = 1; break; // equal to --progress 1
@@ -366,6 +393,12 @@ static void set_encoder_color_format(const char *value, EbConfig *cfg) {
 static void set_compressed_ten_bit_format(const char *value, EbConfig *cfg) {
     cfg->config.compressed_ten_bit_format = strtoul(value, NULL, 0);
 }
+static void set_p010_input(const char *value, EbConfig *cfg) {
+    cfg->config.p010_input = strtoul(value, NULL, 0);
+}
+static void set_hbd_16bit_source(const char *value, EbConfig *cfg) {
+    cfg->config.hbd_16bit_source = strtoul(value, NULL, 0);
+}
 static void set_enc_mode(const char *value, EbConfig *cfg) {
     cfg->config.enc_mode = (uint8_t)strtoul(value, NULL, 0);
 };
@@ -447,6 +480,9 @@ static void set_cfg_intra_refresh_type(const char *value, EbConfig *cfg) {
 static void set_look_ahead_distance(const char *value, EbConfig *cfg) {
     cfg->config.look_ahead_distance = strtol(value, NULL, 0);
 };
+static void set_adaptive_mini_gop(const char *value, EbConfig *cfg) {
+    cfg->config.enable_adaptive_mini_gop = (EbBool)strtoul(value, NULL, 0);
+};
 static void set_hierarchical_levels(const char *value, EbConfig *cfg) {
     cfg->config.hierarchical_levels = strtol(value, NULL, 0);
 };
@@ -538,6 +574,9 @@ static void set_enable_restoration_flag(const char *value, EbConfig *cfg) {
 static void set_enable_mfmv_flag(const char *value, EbConfig *cfg) {
     cfg->config.enable_mfmv = strtol(value, NULL, 0);
 };
+static void set_target_fps(const char *value, EbConfig *cfg) {
+    cfg->config.target_fps = strtoul(value, NULL, 0);
+};
 static void set_fast_decode_flag(const char *value, EbConfig *cfg) {
     cfg->config.fast_decode = (uint8_t)strtol(value, NULL, 0);
 };
@@ -550,6 +589,9 @@ static void set_tile_col(const char *value, EbConfig *cfg) {
 static void set_scene_change_detection(const char *value, EbConfig *cfg) {
     cfg->config.scene_change_detection = strtoul(value, NULL, 0);
 }
+static void set_scene_change_look_ahead(const char *value, EbConfig *cfg) {
+    cfg->config.scene_change_look_ahead = strtoul(value, NULL, 0);
+}
 static void set_enable_tpl_la(const char *value, EbConfig *cfg) {
     cfg->config.enable_tpl_la = (uint8_t)strtoul(value, NULL, 0);
 };
@@ -596,6 +638,9 @@ static void set_buf_initial_sz(const char *value, EbConfig *cfg) {
 static void set_buf_optimal_sz(const char *value, EbConfig *cfg) {
     cfg->config.optimal_buffer_level_ms = strtoul(value, NULL, 0);
 };
+static void set_cbr_inflight_estimates(const char *value, EbConfig *cfg) {
+    cfg->config.cbr_inflight_estimates = (EbBool)strtoul(value, NULL, 0);
+};
 static void set_recode_loop(const char *value, EbConfig *cfg) {
     cfg->config.recode_loop = strtoul(value, NULL, 0);
 };
@@ -814,6 +859,11 @@ ConfigEntry config_entry_options[] = {
      "Encoder preset, presets < 0 are for debugging. Higher presets means faster encodes, but with "
      "a quality tradeoff, default is 12 [-2-13]",
      set_enc_mode},
+    {SINGLE_INPUT,
+     TARGET_FPS_TOKEN,
+     "Real-time speed control target in frames per second, presets faster than --preset are "
+     "used per picture to keep up, default is 0 [0: off, 1-240]",
+     set_target_fps},
 
     {SINGLE_INPUT,
      SVTAV1_PARAMS,
@@ -858,6 +908,12 @@ ConfigEntry config_entry_global_options[] = {
      "Buffer `n` input frames into memory and use them to encode, default is -1 [-1: no frames "
      "buffered, 1-`(2^31)-1`]",
      set_buffered_input},
+    {SINGLE_INPUT,
+     LADDER_SOURCE_TOKEN,
+     "Channel whose input pictures are downscaled to this channel's resolution instead of reading "
+     "an input file, for encoding an ABR ladder from a single input, default is 0 [0: off, 1-`n`: "
+     "an earlier channel]",
+     set_ladder_source},
     {SINGLE_INPUT,
      ENCODER_COLOR_FORMAT,
      "Color format, only yuv420 is supported at this time, default is 1 [0: yuv400, 1: yuv420, 2: "
@@ -896,6 +952,16 @@ ConfigEntry config_entry_global_options[] = {
      INPUT_COMPRESSED_TEN_BIT_FORMAT,
      "Pack 10bit video, handled between the app and library, default is 0 [0-1]",
      set_compressed_ten_bit_format},
+    {SINGLE_INPUT,
+     INPUT_P010_TOKEN,
+     "10bit input in the P010 layout (MSB aligned samples, interleaved CbCr plane), default is 0 "
+     "[0-1]",
+     set_p010_input},
+    {SINGLE_INPUT,
+     HBD_16BIT_SOURCE_TOKEN,
+     "Keep a 16-bit copy of the 10bit source for filtering and mode decision, default is 0 "
+     "[0-1]",
+     set_hbd_16bit_source},
     // Latency
     {SINGLE_INPUT,
      INJECTOR_TOKEN,
@@ -1033,6 +1099,11 @@ ConfigEntry config_entry_rc[] = {
      BUFFER_OPTIMAL_SIZE_TOKEN,
      "Client optimal buffer size (ms), only applicable for CBR, default is 5000 [0-`(2^63)-1`]",
      set_buf_optimal_sz},
+    {SINGLE_INPUT,
+     CBR_INFLIGHT_EST_TOKEN,
+     "Charge the CBR buffer model with size estimates of frames still being encoded, only "
+     "applicable for CBR, default is 1 [0: wait for the actual frame sizes, 1: on]",
+     set_cbr_inflight_estimates},
     {SINGLE_INPUT,
      RECODE_LOOP_TOKEN,
      "Recode loop level, refer to \"Recode loop level table\" in the user guide for more info [0: "
@@ -1070,6 +1141,26 @@ ConfigEntry config_entry_2p[] = {
      "Number of encoding passes, default is preset dependent but generally 1 [1: one pass encode, "
      "2: multi-pass encode]",
      set_passes},
+    {SINGLE_INPUT,
+     CHUNK_START_TOKEN,
+     "Chunked encoding, first frame of the chunk in the stats and input of the final pass, "
+     "default is 0 [0-`(2^32)-1`]",
+     set_chunk_start},
+    {SINGLE_INPUT,
+     CHUNK_FRAMES_TOKEN,
+     "Chunked encoding, number of frames of the chunk, default is 0 [0: up to the end of the "
+     "stats, 1-`(2^32)-1`]",
+     set_chunk_frames},
+    {SINGLE_INPUT,
+     STATS_SRC_WIDTH_TOKEN,
+     "ABR ladder, width of the rendition the stats were collected on, default is 0 [0: same as "
+     "the input, 64-16384]",
+     set_stats_src_width},
+    {SINGLE_INPUT,
+     STATS_SRC_HEIGHT_TOKEN,
+     "ABR ladder, height of the rendition the stats were collected on, default is 0 [0: same as "
+     "the input, 64-8704]",
+     set_stats_src_height},
     // Termination
     {SINGLE_INPUT, NULL, NULL, NULL}};
 
@@ -1087,6 +1178,11 @@ ConfigEntry config_entry_intra_refresh[] = {
      SCENE_CHANGE_DETECTION_TOKEN,
      "Scene change detection control, default is 0 [0-1]",
      set_scene_change_detection},
+    {SINGLE_INPUT,
+     SCENE_CHANGE_LOOK_AHEAD_TOKEN,
+     "Number of future frames used by the scene change detection, lower values reduce latency, "
+     "default is 2 [0-2]",
+     set_scene_change_look_ahead},
     {SINGLE_INPUT,
      LOOKAHEAD_NEW_TOKEN,
      "Number of frames in the future to look ahead, not including minigop, temporal filtering, and "
@@ -1098,6 +1194,11 @@ ConfigEntry config_entry_intra_refresh[] = {
      "Set hierarchical levels beyond the base layer, default is 4 [3: 4 temporal layers, 4: 5 "
      "layers, 5: 6 layers]",
      set_hierarchical_levels},
+    {SINGLE_INPUT,
+     ADAPTIVE_MINI_GOP_TOKEN,
+     "Split high motion mini-GOPs using the first pass statistics, the hierarchical levels being "
+     "the maximum (multi-pass only), default is 0 [0-1]",
+     set_adaptive_mini_gop},
     {SINGLE_INPUT,
      PRED_STRUCT_TOKEN,
      "Set prediction structure, default is 2 [0: low delay P-frames, 1: low delay B-frames, 2: "
@@ -1184,7 +1285,7 @@ ConfigEntry config_entry_specific[] = {
     {SINGLE_INPUT,
      SUPERRES_MODE_INPUT,
      "Enable super-resolution mode, refer to the super-resolution section in the user guide, "
-     "default is 0 [0: off, 1-3, 4: auto-select mode]",
+     "default is 0 [0: off, 1-3, 4: auto-select mode, 5: dynamic]",
      set_superres_mode},
     {SINGLE_INPUT,
      SUPERRES_DENOM,
@@ -1256,6 +1357,7 @@ ConfigEntry config_entry[] = {
     {SINGLE_INPUT, PROGRESS_TOKEN, "Progress", set_progress},
     {SINGLE_INPUT, NO_PROGRESS_TOKEN, "NoProgress", set_no_progress},
     {SINGLE_INPUT, PRESET_TOKEN, "EncoderMode", set_enc_mode},
+    {SINGLE_INPUT, TARGET_FPS_TOKEN, "TargetFps", set_target_fps},
     {SINGLE_INPUT, SVTAV1_PARAMS, "SvtAv1Params", parse_svtav1_params},
 
     // Encoder Global Options
@@ -1268,6 +1370,7 @@ ConfigEntry config_entry[] = {
     {SINGLE_INPUT, NUMBER_OF_PICTURES_TOKEN, "FrameToBeEncoded", set_cfg_frames_to_be_encoded},
     {SINGLE_INPUT, NUMBER_OF_PICTURES_LONG_TOKEN, "FrameToBeEncoded", set_cfg_frames_to_be_encoded},
     {SINGLE_INPUT, BUFFERED_INPUT_TOKEN, "BufferedInput", set_buffered_input},
+    {SINGLE_INPUT, LADDER_SOURCE_TOKEN, "LadderSource", set_ladder_source},
 
     //   Annex A parameters
     {SINGLE_INPUT, TIER_TOKEN, "Tier", set_tier}, // Lacks a command line flag for now
@@ -1291,6 +1394,8 @@ ConfigEntry config_entry[] = {
      INPUT_COMPRESSED_TEN_BIT_FORMAT,
      "CompressedTenBitFormat",
      set_compressed_ten_bit_format},
+    {SINGLE_INPUT, INPUT_P010_TOKEN, "P010Input", set_p010_input},
+    {SINGLE_INPUT, HBD_16BIT_SOURCE_TOKEN, "Hbd16bitSource", set_hbd_16bit_source},
 
     //   Latency
     {SINGLE_INPUT, INJECTOR_TOKEN, "Injector", set_injector},
@@ -1348,6 +1453,7 @@ ConfigEntry config_entry[] = {
     {SINGLE_INPUT, BUFFER_SIZE_TOKEN, "BufSz", set_buf_sz},
     {SINGLE_INPUT, BUFFER_INITIAL_SIZE_TOKEN, "BufInitialSz", set_buf_initial_sz},
     {SINGLE_INPUT, BUFFER_OPTIMAL_SIZE_TOKEN, "BufOptimalSz", set_buf_optimal_sz},
+    {SINGLE_INPUT, CBR_INFLIGHT_EST_TOKEN, "CbrInflightEst", set_cbr_inflight_estimates},
     {SINGLE_INPUT, RECODE_LOOP_TOKEN, "RecodeLoop", set_recode_loop},
     {SINGLE_INPUT, VBR_BIAS_PCT_TOKEN, "VBRBiasPct", set_vbr_bias_pct},
     {SINGLE_INPUT, VBR_MIN_SECTION_PCT_TOKEN, "MinSectionPct", set_vbr_min_section_pct},
@@ -1356,6 +1462,10 @@ ConfigEntry config_entry[] = {
     // Multi-pass Options
     {SINGLE_INPUT, PASS_TOKEN, "Pass", set_pass},
     {SINGLE_INPUT, TWO_PASS_STATS_TOKEN, "Stats", set_two_pass_stats},
+    {SINGLE_INPUT, CHUNK_START_TOKEN, "ChunkStart", set_chunk_start},
+    {SINGLE_INPUT, CHUNK_FRAMES_TOKEN, "ChunkFrames", set_chunk_frames},
+    {SINGLE_INPUT, STATS_SRC_WIDTH_TOKEN, "StatsSourceWidth", set_stats_src_width},
+    {SINGLE_INPUT, STATS_SRC_HEIGHT_TOKEN, "StatsSourceHeight", set_stats_src_height},
     {SINGLE_INPUT, PASSES_TOKEN, "Passes", set_passes},
 
     // GOP size and type Options
@@ -1366,9 +1476,14 @@ ConfigEntry config_entry[] = {
      SCENE_CHANGE_DETECTION_TOKEN,
      "SceneChangeDetection",
      set_scene_change_detection},
+    {SINGLE_INPUT,
+     SCENE_CHANGE_LOOK_AHEAD_TOKEN,
+     "SceneChangeLookAhead",
+     set_scene_change_look_ahead},
     {SINGLE_INPUT, LOOKAHEAD_NEW_TOKEN, "Lookahead", set_look_ahead_distance},
     //   Prediction Structure
     {SINGLE_INPUT, HIERARCHICAL_LEVELS_TOKEN, "HierarchicalLevels", set_hierarchical_levels},
+    {SINGLE_INPUT, ADAPTIVE_MINI_GOP_TOKEN, "AdaptiveMiniGop", set_adaptive_mini_gop},
     {SINGLE_INPUT, PRED_STRUCT_TOKEN, "PredStructure", set_cfg_pred_structure},
 
     // AV1 Specific Options
@@ -1873,7 +1988,7 @@ static EbErrorType app_verify_config(EbConfig *config, uint32_t channel_number)
     EbErrorType return_error = EB_ErrorNone;
 
     // Check Input File
-    if (config->input_file == (FILE *)NULL) {
+    if (config->input_file == (FILE *)NULL && !config->ladder_source) {
         fprintf(
             config->error_log_file, "Error instance %u: Invalid Input File\n", channel_number + 1);
         return_error = EB_ErrorBadParameter;
@@ -2158,6 +2273,10 @@ static EbBool check_two_pass_conflicts(int32_t argc, char *const argv[]) {
     char        config_string[COMMAND_LINE_MAX_SIZE];
     const char *conflicts[] = {
         PASS_TOKEN,
+        CHUNK_START_TOKEN,
+        CHUNK_FRAMES_TOKEN,
+        STATS_SRC_WIDTH_TOKEN,
+        STATS_SRC_HEIGHT_TOKEN,
         NULL,
     };
     int         i = 0;
@@ -2379,6 +2498,81 @@ int32_t compute_frames_to_be_encoded(EbConfig *config) {
     return frame_count;
 }
 
+// Skips the input frames located before the chunk (chunked encoding)
+static EbErrorType skip_chunk_input_frames(EbConfig *config) {
+    const EbBool is_pipe = config->input_file == stdin || config->input_file_is_fifo;
+    uint64_t     frame_size = (uint64_t)config->input_padded_width * config->input_padded_height;
+    frame_size += 2 * (frame_size >> (3 - config->config.encoder_color_format));
+    if (config->config.encoder_bit_depth == 10)
+        frame_size = config->config.compressed_ten_bit_format ? frame_size * 5 / 4
+                                                              : frame_size << 1;
+
+    if (!is_pipe && !config->y4m_input) {
+        if (fseeko(config->input_file,
+                   (off_t)(frame_size * config->config.chunk_start_frame),
+                   SEEK_CUR))
+            return EB_ErrorBadParameter;
+        return EB_ErrorNone;
+    }
+    uint8_t *skip_buf = (uint8_t *)malloc(frame_size);
+    if (!skip_buf)
+        return EB_ErrorInsufficientResources;
+    EbErrorType return_error = EB_ErrorNone;
+    for (uint32_t frame = 0; frame < config->config.chunk_start_frame; frame++) {
+        uint64_t read_size = frame_size;
+        if (config->y4m_input)
+            read_y4m_frame_delimiter(config->input_file, config->error_log_file);
+        else if (is_pipe && frame == 0)
+            // 9 bytes were already buffered during the YUV4MPEG2 header probe
+            read_size -= sizeof(config->y4m_buf);
+        if (fread(skip_buf, 1, read_size, config->input_file) != read_size) {
+            return_error = EB_ErrorBadParameter;
+            break;
+        }
+    }
+    // Refill the probe buffer with the start of the first frame of the chunk
+    if (return_error == EB_ErrorNone && is_pipe && !config->y4m_input &&
+        fread(config->y4m_buf, 1, sizeof(config->y4m_buf), config->input_file) !=
+            sizeof(config->y4m_buf))
+        return_error = EB_ErrorBadParameter;
+    free(skip_buf);
+    return return_error;
+}
+
+// ABR ladder: the channel encodes the input pictures of an earlier channel rescaled to its own
+// resolution, so the sample format, frame rate and frame count follow the source channel
+static EbErrorType set_ladder_source_channel(EncChannel *channels, uint32_t index) {
+    EbConfig *config = channels[index].config;
+    if (config->ladder_source > index) {
+        fprintf(config->error_log_file,
+                "Error instance %u: LadderSource must refer to an earlier channel\n",
+                index + 1);
+        return EB_ErrorBadParameter;
+    }
+    EncChannel *src        = channels + config->ladder_source - 1;
+    EbConfig   *src_config = src->config;
+    if (src->return_error != EB_ErrorNone)
+        return src->return_error;
+    if (src_config->config.compressed_ten_bit_format || src_config->config.p010_input ||
+        config->buffered_input != -1) {
+        fprintf(config->error_log_file,
+                "Error instance %u: LadderSource is not supported with compressed 10-bit input, "
+                "P010 input or buffered input\n",
+                index + 1);
+        return EB_ErrorBadParameter;
+    }
+    config->config.encoder_bit_depth         = src_config->config.encoder_bit_depth;
+    config->config.encoder_color_format      = src_config->config.encoder_color_format;
+    config->config.compressed_ten_bit_format = 0;
+    config->config.p010_input                = 0;
+    config->config.frame_rate_numerator      = src_config->config.frame_rate_numerator;
+    config->config.frame_rate_denominator    = src_config->config.frame_rate_denominator;
+    config->frames_to_be_encoded             = src_config->frames_to_be_encoded;
+    src_config->is_ladder_source             = EB_TRUE;
+    channels[index].ladder_source            = src;
+    return EB_ErrorNone;
+}
+
 /**********************************
 * Parse Pred Struct File
 **********************************/
@@ -2669,7 +2863,7 @@ EbErrorType read_command_line(int32_t argc, char *const argv[], EncChannel *chan
 
     for (index = 0; index < num_channels; ++index) {
         EncChannel *c = channels + index;
-        if (c->config->y4m_input == EB_TRUE) {
+        if (c->config->y4m_input == EB_TRUE && !c->config->ladder_source) {
             ret_y4m = read_y4m_header(c->config);
             if (ret_y4m == EB_ErrorBadParameter) {
                 fprintf(stderr, "Error found when reading the y4m file parameters.\n");
@@ -2710,13 +2904,36 @@ EbErrorType read_command_line(int32_t argc, char *const argv[], EncChannel *chan
                     config->input_padded_height = config->config.source_height;
                 }
 
+                // ABR ladder: the pictures are taken from the source channel
+                if (c->return_error == EB_ErrorNone && config->ladder_source)
+                    c->return_error = set_ladder_source_channel(channels, index);
+
+                // Chunked encoding: only the frames of the chunk are sent to the encoder
+                if (c->return_error == EB_ErrorNone && config->frames_to_be_encoded == 0 &&
+                    config->config.chunk_frames)
+                    config->frames_to_be_encoded = config->config.chunk_frames;
+
                 // Assuming no errors, set the frames to be encoded to the number of frames in the input yuv
-                if (c->return_error == EB_ErrorNone && config->frames_to_be_encoded == 0)
+                if (c->return_error == EB_ErrorNone && config->frames_to_be_encoded == 0) {
                     config->frames_to_be_encoded = compute_frames_to_be_encoded(config);
+                    if (config->frames_to_be_encoded > 0 && config->config.chunk_start_frame)
+                        config->frames_to_be_encoded = (int32_t)config->config.chunk_start_frame <
+                                config->frames_to_be_encoded
+                            ? config->frames_to_be_encoded - (int32_t)config->config.chunk_start_frame
+                            : -1;
+                }
+
+                if (c->return_error == EB_ErrorNone && config->config.chunk_start_frame &&
+                    !config->ladder_source && skip_chunk_input_frames(config) != EB_ErrorNone) {
+                    fprintf(config->error_log_file,
+                            "Error instance %u: Input does not contain the chunk start frame \n",
+                            index + 1);
+                    c->return_error = EB_ErrorBadParameter;
+                }
 
                 // For pipe input it is fine if we have -1 here (we will update on end of stream)
                 if (config->frames_to_be_encoded == -1 && config->input_file != stdin &&
-                    !config->input_file_is_fifo) {
+                    !config->input_file_is_fifo && !config->ladder_source) {
                     fprintf(config->error_log_file,
                             "Error instance %u: Input yuv does not contain enough frames \n",
                             index + 1);
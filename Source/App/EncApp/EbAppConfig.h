@@ -209,6 +209,9 @@ typedef struct EbConfig {
     int32_t   frames_encoded;
     int32_t   buffered_input;
     uint8_t **sequence_buffer;
+    // 1-based channel whose input pictures are rescaled for this channel, 0 = read own input
+    uint32_t ladder_source;
+    EbBool   is_ladder_source; // input pictures are rescaled by later channels
 
     uint32_t injector_frame_rate;
     uint32_t injector;
@@ -236,14 +239,16 @@ typedef struct EbConfig {
 } EbConfig;
 
 typedef struct EncChannel {
-    EbConfig            *config; // Encoder Configuration
-    EbAppContext        *app_callback; // Instances App callback date
-    EbErrorType          return_error; // Error Handling
-    AppExitConditionType exit_cond_output; // Processing loop exit condition
-    AppExitConditionType exit_cond_recon; // Processing loop exit condition
-    AppExitConditionType exit_cond_input; // Processing loop exit condition
-    AppExitConditionType exit_cond; // Processing loop exit condition
-    EbBool               active;
+    EbConfig                *config; // Encoder Configuration
+    EbAppContext            *app_callback; // Instances App callback date
+    EbErrorType              return_error; // Error Handling
+    AppExitConditionType     exit_cond_output; // Processing loop exit condition
+    AppExitConditionType     exit_cond_recon; // Processing loop exit condition
+    AppExitConditionType     exit_cond_input; // Processing loop exit condition
+    AppExitConditionType     exit_cond; // Processing loop exit condition
+    EbBool                   active;
+    const struct EncChannel *ladder_source; // Channel providing the input pictures
+    const EbSvtIOFormat     *ladder_picture; // Last input picture of the ladder source
 } EncChannel;
 
 typedef enum MultiPassModes {
@@ -81,6 +81,8 @@ static EbErrorType allocate_frame_buffer(EbConfig *config, uint8_t *p_buffer) {
         (1 << ten_bit_packed_mode);
 
     const size_t chroma_8bit_size = luma_8bit_size >> (3 - color_format);
+    // P010 carries both chroma components in one interleaved plane passed in cb
+    const uint8_t p010 = ten_bit_packed_mode && cfg->p010_input;
 
     const size_t luma_10bit_size = (cfg->encoder_bit_depth > 8 && ten_bit_packed_mode == 0)
         ? luma_8bit_size >> 2
@@ -94,7 +96,7 @@ static EbErrorType allocate_frame_buffer(EbConfig *config, uint8_t *p_buffer) {
     EbSvtIOFormat *input_ptr = (EbSvtIOFormat *)p_buffer;
     input_ptr->y_stride      = config->input_padded_width;
     input_ptr->cr_stride     = config->input_padded_width >> subsampling_x;
-    input_ptr->cb_stride     = config->input_padded_width >> subsampling_x;
+    input_ptr->cb_stride     = config->input_padded_width >> (p010 ? 0 : subsampling_x);
 
     if (luma_8bit_size) {
         EB_APP_MALLOC(
@@ -104,13 +106,16 @@ static EbErrorType allocate_frame_buffer(EbConfig *config, uint8_t *p_buffer) {
     }
 
     if (chroma_8bit_size) {
-        EB_APP_MALLOC(
-            uint8_t *, input_ptr->cb, chroma_8bit_size, EB_N_PTR, EB_ErrorInsufficientResources);
+        EB_APP_MALLOC(uint8_t *,
+                      input_ptr->cb,
+                      chroma_8bit_size << p010,
+                      EB_N_PTR,
+                      EB_ErrorInsufficientResources);
     } else {
         input_ptr->cb = 0;
     }
 
-    if (chroma_8bit_size) {
+    if (chroma_8bit_size && !p010) {
         EB_APP_MALLOC(
             uint8_t *, input_ptr->cr, chroma_8bit_size, EB_N_PTR, EB_ErrorInsufficientResources);
     } else {
@@ -106,6 +106,9 @@ void init_memory_file_map(EbConfig* config) {
 
     if (config->input_file == stdin || config->input_file_is_fifo)
         config->mmap.enable = 0;
+    // Ladder pictures are rescaled from the source buffer after it was sent to the encoder
+    if (config->ladder_source || config->is_ladder_source)
+        config->mmap.enable = 0;
 
     if (config->mmap.enable) {
         if (config->input_file) {
@@ -117,7 +120,8 @@ void init_memory_file_map(EbConfig* config) {
             config->mmap.fd = fileno(config->input_file);
 #endif
         }
-        config->mmap.file_frame_it = 0;
+        // The frames located before a chunk were skipped while parsing the command line
+        config->mmap.file_frame_it = config->config.chunk_start_frame;
 #ifndef _WIN32
         config->mmap.align_mask = sysconf(_SC_PAGESIZE) - 1;
 #endif
@@ -424,6 +428,10 @@ static void enc_channel_start(EncChannel* c) {
         c->exit_cond_recon  = config->recon_file ? APP_ExitConditionNone : APP_ExitConditionError;
         c->exit_cond_input  = APP_ExitConditionNone;
         c->active           = EB_TRUE;
+        // The source header loses its picture when it signals the end of stream
+        if (c->ladder_source && c->ladder_source->return_error == EB_ErrorNone)
+            c->ladder_picture = (const EbSvtIOFormat*)
+                                    c->ladder_source->app_callback->input_buffer_pool->p_buffer;
         app_svt_av1_get_time(&config->performance_context.encode_start_time[0],
                              &config->performance_context.encode_start_time[1]);
     }
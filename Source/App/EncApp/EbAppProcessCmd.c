@@ -162,9 +162,12 @@ static void release_memory_mapped_file(EbConfig *config, uint8_t is_16bit,
         << (config->config.compressed_ten_bit_format ? 0 : is_16bit);
     const uint8_t  color_format = config->config.encoder_color_format;
     EbSvtIOFormat *input_ptr    = (EbSvtIOFormat *)header_ptr->p_buffer;
+    // P010 has one interleaved chroma plane mapped in cb
+    const uint8_t  p010         = is_16bit && config->config.p010_input;
     svt_munmap(&config->mmap, input_ptr->luma, luma_read_size);
-    svt_munmap(&config->mmap, input_ptr->cb, luma_read_size >> (3 - color_format));
-    svt_munmap(&config->mmap, input_ptr->cr, luma_read_size >> (3 - color_format));
+    svt_munmap(&config->mmap, input_ptr->cb, (luma_read_size >> (3 - color_format)) << p010);
+    if (!p010)
+        svt_munmap(&config->mmap, input_ptr->cr, luma_read_size >> (3 - color_format));
 
     if (config->config.compressed_ten_bit_format) {
         uint32_t nbit_luma_read_size   = (input_padded_width / 4) * input_padded_height;
@@ -184,10 +187,12 @@ void read_input_frames(EbConfig *config, uint8_t is_16bit, EbBufferHeaderType *h
 
     const uint8_t color_format  = config->config.encoder_color_format;
     const uint8_t subsampling_x = (color_format == EB_YUV444 ? 1 : 2) - 1;
+    // P010 carries both chroma components in one interleaved plane passed in cb
+    const uint8_t p010 = is_16bit && config->config.p010_input;
 
     input_ptr->y_stride  = input_padded_width;
     input_ptr->cr_stride = input_padded_width >> subsampling_x;
-    input_ptr->cb_stride = input_padded_width >> subsampling_x;
+    input_ptr->cb_stride = input_padded_width >> (p010 ? 0 : subsampling_x);
 
     if (config->buffered_input == -1) {
         uint64_t read_size;
@@ -210,6 +215,8 @@ void read_input_frames(EbConfig *config, uint8_t is_16bit, EbBufferHeaderType *h
             uint64_t luma_read_size = (uint64_t)input_padded_width * input_padded_height
                 << is_16bit;
             uint32_t chroma_read_size = ((uint32_t)luma_read_size >> (3 - color_format));
+            uint32_t cb_read_size     = chroma_read_size << p010;
+            uint32_t cr_read_size     = p010 ? 0 : chroma_read_size;
             uint8_t *eb_input_ptr     = input_ptr->luma;
             if (!config->y4m_input && config->processed_frame_count == 0 &&
                 (config->input_file == stdin || config->input_file_is_fifo)) {
@@ -233,17 +240,19 @@ void read_input_frames(EbConfig *config, uint8_t is_16bit, EbBufferHeaderType *h
                 int64_t offset = get_mmap_offset(config, read_size);
 
                 offset += luma_read_size;
-                input_ptr->cb = svt_mmap(&config->mmap, offset, chroma_read_size);
-                header_ptr->n_filled_len += (input_ptr->cb ? chroma_read_size : 0);
+                input_ptr->cb = svt_mmap(&config->mmap, offset, cb_read_size);
+                header_ptr->n_filled_len += (input_ptr->cb ? cb_read_size : 0);
 
-                offset += chroma_read_size;
-                input_ptr->cr = svt_mmap(&config->mmap, offset, chroma_read_size);
-                header_ptr->n_filled_len += (input_ptr->cr ? chroma_read_size : 0);
+                if (cr_read_size) {
+                    offset += cb_read_size;
+                    input_ptr->cr = svt_mmap(&config->mmap, offset, cr_read_size);
+                    header_ptr->n_filled_len += (input_ptr->cr ? cr_read_size : 0);
+                }
             } else {
                 header_ptr->n_filled_len += (uint32_t)fread(
-                    input_ptr->cb, 1, luma_read_size >> (3 - color_format), input_file);
+                    input_ptr->cb, 1, cb_read_size, input_file);
                 header_ptr->n_filled_len += (uint32_t)fread(
-                    input_ptr->cr, 1, luma_read_size >> (3 - color_format), input_file);
+                    input_ptr->cr, 1, cr_read_size, input_file);
             }
 
             if (read_size != header_ptr->n_filled_len) {
@@ -255,12 +264,14 @@ void read_input_frames(EbConfig *config, uint8_t is_16bit, EbBufferHeaderType *h
                     header_ptr->n_filled_len += (input_ptr->luma ? (uint32_t)luma_read_size : 0);
 
                     offset += luma_read_size;
-                    input_ptr->cb = svt_mmap(&config->mmap, offset, chroma_read_size);
-                    header_ptr->n_filled_len += (input_ptr->cb ? chroma_read_size : 0);
+                    input_ptr->cb = svt_mmap(&config->mmap, offset, cb_read_size);
+                    header_ptr->n_filled_len += (input_ptr->cb ? cb_read_size : 0);
 
-                    offset += chroma_read_size;
-                    input_ptr->cr = svt_mmap(&config->mmap, offset, chroma_read_size);
-                    header_ptr->n_filled_len += (input_ptr->cr ? chroma_read_size : 0);
+                    if (cr_read_size) {
+                        offset += cb_read_size;
+                        input_ptr->cr = svt_mmap(&config->mmap, offset, cr_read_size);
+                        header_ptr->n_filled_len += (input_ptr->cr ? cr_read_size : 0);
+                    }
                 } else if (!config->input_file_is_fifo) {
                     fseek(input_file, 0, SEEK_SET);
                     if (config->y4m_input == EB_TRUE) {
@@ -270,9 +281,9 @@ void read_input_frames(EbConfig *config, uint8_t is_16bit, EbBufferHeaderType *h
                     header_ptr->n_filled_len = (uint32_t)fread(
                         input_ptr->luma, 1, luma_read_size, input_file);
                     header_ptr->n_filled_len += (uint32_t)fread(
-                        input_ptr->cb, 1, luma_read_size >> (3 - color_format), input_file);
+                        input_ptr->cb, 1, cb_read_size, input_file);
                     header_ptr->n_filled_len += (uint32_t)fread(
-                        input_ptr->cr, 1, luma_read_size >> (3 - color_format), input_file);
+                        input_ptr->cr, 1, cr_read_size, input_file);
                 }
             }
         } else {
@@ -430,10 +441,11 @@ void read_input_frames(EbConfig *config, uint8_t is_16bit, EbBufferHeaderType *h
 
             input_ptr->y_stride  = input_padded_width;
             input_ptr->cr_stride = input_padded_width >> subsampling_x;
-            input_ptr->cb_stride = input_padded_width >> subsampling_x;
+            input_ptr->cb_stride = input_padded_width >> (p010 ? 0 : subsampling_x);
 
             input_ptr->luma =
                 config->sequence_buffer[config->processed_frame_count % config->buffered_input];
+            // With P010 the interleaved chroma plane starts at cb and cr is not used
             input_ptr->cb =
                 config->sequence_buffer[config->processed_frame_count % config->buffered_input] +
                 luma_size;
@@ -448,6 +460,96 @@ void read_input_frames(EbConfig *config, uint8_t is_16bit, EbBufferHeaderType *h
     return;
 }
 
+// Box filter resampling of one plane, each output sample is the average of the source samples it
+// covers (nearest neighbour when upscaling)
+static void scale_ladder_plane(const uint8_t *src, uint32_t src_stride, uint32_t src_width,
+                               uint32_t src_height, uint8_t *dst, uint32_t dst_stride,
+                               uint32_t dst_width, uint32_t dst_height, uint8_t is_16bit) {
+    const uint16_t *src16 = (const uint16_t *)src;
+    uint16_t       *dst16 = (uint16_t *)dst;
+    for (uint32_t y = 0; y < dst_height; y++) {
+        const uint32_t y0 = (uint32_t)((uint64_t)y * src_height / dst_height);
+        uint32_t       y1 = (uint32_t)((uint64_t)(y + 1) * src_height / dst_height);
+        y1                = y1 > y0 ? y1 : y0 + 1;
+        for (uint32_t x = 0; x < dst_width; x++) {
+            const uint32_t x0 = (uint32_t)((uint64_t)x * src_width / dst_width);
+            uint32_t       x1 = (uint32_t)((uint64_t)(x + 1) * src_width / dst_width);
+            x1                = x1 > x0 ? x1 : x0 + 1;
+            uint32_t sum      = 0;
+            for (uint32_t i = y0; i < y1; i++) {
+                for (uint32_t j = x0; j < x1; j++)
+                    sum += is_16bit ? src16[i * src_stride + j] : src[i * src_stride + j];
+            }
+            const uint32_t count = (y1 - y0) * (x1 - x0);
+            const uint32_t val   = (sum + (count >> 1)) / count;
+            if (is_16bit)
+                dst16[y * dst_stride + x] = (uint16_t)val;
+            else
+                dst[y * dst_stride + x] = (uint8_t)val;
+        }
+    }
+}
+
+// ABR ladder: fills the input buffer with the last picture read by the source channel, rescaled
+// to the resolution of this channel, so the input is read and decoded only once for the ladder
+static void read_ladder_input_frame(EncChannel *channel, uint8_t is_16bit,
+                                    EbBufferHeaderType *header_ptr) {
+    EbConfig            *config        = channel->config;
+    const EbConfig      *src_config    = channel->ladder_source->config;
+    const EbSvtIOFormat *src           = channel->ladder_picture;
+    EbSvtIOFormat       *dst           = (EbSvtIOFormat *)header_ptr->p_buffer;
+    const uint8_t        color_format  = config->config.encoder_color_format;
+    const uint8_t        subsampling_x = color_format == EB_YUV444 ? 0 : 1;
+    const uint8_t        subsampling_y = color_format == EB_YUV420 ? 1 : 0;
+    const uint32_t       src_width     = src_config->input_padded_width;
+    const uint32_t       src_height    = src_config->input_padded_height;
+    const uint32_t       dst_width     = config->input_padded_width;
+    const uint32_t       dst_height    = config->input_padded_height;
+
+    header_ptr->n_filled_len = 0;
+    // The frame count of a pipe is only known at the end of the stream
+    config->frames_to_be_encoded = src_config->frames_to_be_encoded;
+    if (src_config->processed_frame_count <= config->processed_frame_count) {
+        // The source stopped (interrupted or failed), end the rendition with it
+        if (channel->ladder_source->exit_cond_input != APP_ExitConditionNone)
+            config->frames_to_be_encoded = config->processed_frame_count;
+        return;
+    }
+
+    dst->y_stride  = dst_width;
+    dst->cb_stride = dst_width >> subsampling_x;
+    dst->cr_stride = dst_width >> subsampling_x;
+    scale_ladder_plane(src->luma,
+                       src->y_stride,
+                       src_width,
+                       src_height,
+                       dst->luma,
+                       dst->y_stride,
+                       dst_width,
+                       dst_height,
+                       is_16bit);
+    scale_ladder_plane(src->cb,
+                       src->cb_stride,
+                       src_width >> subsampling_x,
+                       src_height >> subsampling_y,
+                       dst->cb,
+                       dst->cb_stride,
+                       dst_width >> subsampling_x,
+                       dst_height >> subsampling_y,
+                       is_16bit);
+    scale_ladder_plane(src->cr,
+                       src->cr_stride,
+                       src_width >> subsampling_x,
+                       src_height >> subsampling_y,
+                       dst->cr,
+                       dst->cr_stride,
+                       dst_width >> subsampling_x,
+                       dst_height >> subsampling_y,
+                       is_16bit);
+    header_ptr->n_filled_len = (uint32_t)SIZE_OF_ONE_FRAME_IN_BYTES(
+        dst_width, dst_height, color_format, is_16bit);
+}
+
 /**
  * Reads and extracts one qp from the qp_file
  * @param qp_file file to read a value from
@@ -563,7 +665,10 @@ void process_input_buffer(EncChannel *channel) {
 
     // If there are bytes left to encode, configure the header
     if (remaining_byte_count != 0 && config->stop_encoder == EB_FALSE) {
-        read_input_frames(config, is_16bit, header_ptr);
+        if (channel->ladder_source)
+            read_ladder_input_frame(channel, is_16bit, header_ptr);
+        else
+            read_input_frames(config, is_16bit, header_ptr);
         if (header_ptr->n_filled_len) {
             // Update the context parameters
             config->processed_byte_count += header_ptr->n_filled_len;
@@ -740,6 +845,9 @@ void process_output_statistics_buffer(EbBufferHeaderType *header_ptr, EbConfig *
 
     // Write statistic Data to file
     if (config->stat_file) {
+        // the preset varies per picture under speed control
+        if (config->config.target_fps)
+            fprintf(config->stat_file, "Preset: %3d\t ", (int)header_ptr->enc_mode);
         fprintf(config->stat_file,
                 "Picture Number: %4d\t QP: %4d  [ "
                 "PSNR-Y: %.2f dB,\tPSNR-U: %.2f dB,\tPSNR-V: %.2f "
@@ -828,7 +936,12 @@ void process_output_stream_buffer(EncChannel *channel, EncApp *enc_app, int32_t
             if (stream_file) {
                 if (config->performance_context.frame_count == 1 &&
                     !(flags & EB_BUFFERFLAG_IS_ALT_REF)) {
-                    write_ivf_stream_header(config);
+                    // A chunk continues the stream of the previous chunks : no stream header
+                    // so the chunk files can be concatenated, and continuous timestamps
+                    if (config->config.chunk_start_frame)
+                        config->ivf_count = config->config.chunk_start_frame;
+                    else
+                        write_ivf_stream_header(config);
                 }
                 write_ivf_frame_header(config, header_ptr->n_filled_len);
                 fwrite(header_ptr->p_buffer, 1, header_ptr->n_filled_len, stream_file);
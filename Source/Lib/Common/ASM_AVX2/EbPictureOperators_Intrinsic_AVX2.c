@@ -2072,58 +2072,63 @@ void svt_residual_kernel16bit_avx2(uint16_t *input, uint32_t input_stride, uint1
     }
 }
 
+/* Split the 32 10-bit samples of in1 and in2 into 32 8-bit samples and 8 bytes of compressed
+ * 2-bit samples. */
+static INLINE void unpack_and_2bcompress_32x1(__m256i in1, __m256i in2, uint8_t *out8b_buffer,
+                                              uint8_t *out2b_buffer) {
+    const __m256i ymm_00ff = _mm256_set1_epi16(0x00FF);
+    const __m256i msk_2b   = _mm256_set1_epi16(0x0003); //0000.0000.0000.0011
+    const __m256i msk0     = _mm256_set1_epi32(0x000000C0); //1100.0000
+    const __m256i msk1     = _mm256_set1_epi32(0x00000030); //0011.0000
+    const __m256i msk2     = _mm256_set1_epi32(0x0000000C); //0000.1100
+    __m256i       out8_u8;
+    __m256i       tmp_2b1, tmp_2b2, tmp_2b;
+    __m256i       ext0, ext1, ext2, ext3, ext0123, ext0123n, extp;
+
+    tmp_2b1 = _mm256_and_si256(in1, msk_2b); //0000.0011.1111.1111 -> 0000.0000.0000.0011
+    tmp_2b2 = _mm256_and_si256(in2, msk_2b);
+    tmp_2b  = _mm256_permute4x64_epi64(_mm256_packus_epi16(tmp_2b1, tmp_2b2), 0xd8);
+
+    ext0 = _mm256_srli_epi32(
+        tmp_2b,
+        3 * 8); //0000.0011.0000.0000.0000.0000.0000.0000 -> 0000.0000.0000.0000.0000.0000.0000.0011
+    ext1 = _mm256_and_si256(
+        _mm256_srli_epi32(tmp_2b, 1 * 8 + 6),
+        msk2); //0000.0000.0000.0011.0000.0000.0000.0000 -> 0000.0000.0000.0000.0000.0000.0000.1100
+    ext2 = _mm256_and_si256(
+        _mm256_srli_epi32(tmp_2b, 4),
+        msk1); //0000.0000.0000.0000.0000.0011.0000.0000 -> 0000.0000.0000.0000.0000.0000.0011.0000
+    ext3 = _mm256_and_si256(
+        _mm256_slli_epi32(tmp_2b, 6),
+        msk0); //0000.0000.0000.0000.0000.0000.0000.0011 -> 0000.0000.0000.0000.0000.0000.1100.0000
+    ext0123 = _mm256_or_si256(
+        _mm256_or_si256(ext0, ext1),
+        _mm256_or_si256(ext2, ext3)); //0000.0000.0000.0000.0000.0000.1111.1111
+
+    ext0123n = _mm256_castsi128_si256(_mm256_extracti128_si256(ext0123, 1));
+
+    extp = _mm256_packus_epi32(ext0123, ext0123n);
+    extp = _mm256_packus_epi16(extp, extp);
+
+    _mm_storel_epi64((__m128i *)out2b_buffer, _mm256_castsi256_si128(extp));
+
+    out8_u8 = _mm256_packus_epi16(_mm256_and_si256(_mm256_srli_epi16(in1, 2), ymm_00ff),
+                                  _mm256_and_si256(_mm256_srli_epi16(in2, 2), ymm_00ff));
+    /*If we assume that in16b_buffer is 10bit max, then we can do:
+    out8_u8 = _mm256_packus_epi16(_mm256_srli_epi16(in1, 2),
+                                          _mm256_srli_epi16(in2, 2));
+    */
+
+    _mm256_storeu_si256((__m256i *)out8b_buffer, _mm256_permute4x64_epi64(out8_u8, 0xd8));
+}
+
 static INLINE void unpack_and_2bcompress_32(uint16_t *in16b_buffer, uint8_t *out8b_buffer,
                                             uint8_t *out2b_buffer, uint32_t width_rep) {
-    __m256i ymm_00ff = _mm256_set1_epi16(0x00FF);
-    __m256i msk_2b   = _mm256_set1_epi16(0x0003); //0000.0000.0000.0011
-    __m256i in1, in2, out8_u8;
-    __m256i tmp_2b1, tmp_2b2, tmp_2b;
-    __m256i ext0, ext1, ext2, ext3, ext0123, ext0123n, extp;
-    __m256i msk0, msk1, msk2;
-
-    msk0 = _mm256_set1_epi32(0x000000C0); //1100.0000
-    msk1 = _mm256_set1_epi32(0x00000030); //0011.0000
-    msk2 = _mm256_set1_epi32(0x0000000C); //0000.1100
     for (uint32_t w = 0; w < width_rep; w++) {
-        in1 = _mm256_loadu_si256((__m256i *)(in16b_buffer + w * 32));
-        in2 = _mm256_loadu_si256((__m256i *)(in16b_buffer + w * 32 + 16));
-
-        tmp_2b1 = _mm256_and_si256(in1, msk_2b); //0000.0011.1111.1111 -> 0000.0000.0000.0011
-        tmp_2b2 = _mm256_and_si256(in2, msk_2b);
-        tmp_2b  = _mm256_permute4x64_epi64(_mm256_packus_epi16(tmp_2b1, tmp_2b2), 0xd8);
-
-        ext0 = _mm256_srli_epi32(
-            tmp_2b,
-            3 * 8); //0000.0011.0000.0000.0000.0000.0000.0000 -> 0000.0000.0000.0000.0000.0000.0000.0011
-        ext1 = _mm256_and_si256(
-            _mm256_srli_epi32(tmp_2b, 1 * 8 + 6),
-            msk2); //0000.0000.0000.0011.0000.0000.0000.0000 -> 0000.0000.0000.0000.0000.0000.0000.1100
-        ext2 = _mm256_and_si256(
-            _mm256_srli_epi32(tmp_2b, 4),
-            msk1); //0000.0000.0000.0000.0000.0011.0000.0000 -> 0000.0000.0000.0000.0000.0000.0011.0000
-        ext3 = _mm256_and_si256(
-            _mm256_slli_epi32(tmp_2b, 6),
-            msk0); //0000.0000.0000.0000.0000.0000.0000.0011 -> 0000.0000.0000.0000.0000.0000.1100.0000
-        ext0123 = _mm256_or_si256(
-            _mm256_or_si256(ext0, ext1),
-            _mm256_or_si256(ext2, ext3)); //0000.0000.0000.0000.0000.0000.1111.1111
-
-        ext0123n = _mm256_castsi128_si256(_mm256_extracti128_si256(ext0123, 1));
-
-        extp = _mm256_packus_epi32(ext0123, ext0123n);
-        extp = _mm256_packus_epi16(extp, extp);
-
-        _mm_storel_epi64((__m128i *)(out2b_buffer + w * 8), _mm256_castsi256_si128(extp));
-
-        out8_u8 = _mm256_packus_epi16(_mm256_and_si256(_mm256_srli_epi16(in1, 2), ymm_00ff),
-                                      _mm256_and_si256(_mm256_srli_epi16(in2, 2), ymm_00ff));
-        /*If we assume that in16b_buffer is 10bit max, then we can do:
-        out8_u8 = _mm256_packus_epi16(_mm256_srli_epi16(in1, 2),
-                                              _mm256_srli_epi16(in2, 2));
-        */
-
-        _mm256_storeu_si256((__m256i *)(out8b_buffer + w * 32),
-                            _mm256_permute4x64_epi64(out8_u8, 0xd8));
+        unpack_and_2bcompress_32x1(_mm256_loadu_si256((__m256i *)(in16b_buffer + w * 32)),
+                                   _mm256_loadu_si256((__m256i *)(in16b_buffer + w * 32 + 16)),
+                                   out8b_buffer + w * 32,
+                                   out2b_buffer + w * 8);
     }
 }
 
@@ -2236,3 +2241,83 @@ void svt_unpack_and_2bcompress_avx2(uint16_t *in16b_buffer, uint32_t in16b_strid
         }
     }
 }
+
+void svt_unpack_p010_and_2bcompress_avx2(uint16_t *in16b_buffer, uint32_t in16b_stride,
+                                         uint8_t *out8b_buffer, uint32_t out8b_stride,
+                                         uint8_t *out2b_buffer, uint32_t out2b_stride,
+                                         uint32_t width, uint32_t height) {
+    const uint32_t width32 = width & ~31u;
+
+    for (uint32_t h = 0; h < height; h++) {
+        uint16_t *in   = in16b_buffer + h * in16b_stride;
+        uint8_t  *out8 = out8b_buffer + h * out8b_stride;
+        uint8_t  *out2 = out2b_buffer + h * out2b_stride;
+        for (uint32_t w = 0; w < width32; w += 32) {
+            unpack_and_2bcompress_32x1(
+                _mm256_srli_epi16(_mm256_loadu_si256((__m256i *)(in + w)), 6),
+                _mm256_srli_epi16(_mm256_loadu_si256((__m256i *)(in + w + 16)), 6),
+                out8 + w,
+                out2 + w / 4);
+        }
+    }
+    if (width32 < width)
+        svt_unpack_p010_and_2bcompress_c(in16b_buffer + width32,
+                                         in16b_stride,
+                                         out8b_buffer + width32,
+                                         out8b_stride,
+                                         out2b_buffer + width32 / 4,
+                                         out2b_stride,
+                                         width - width32,
+                                         height);
+}
+
+/* Take the Cb (even) or the Cr (odd) 16-bit samples of 16 interleaved pairs, as 10-bit values. */
+static INLINE __m256i p010_deinterleave_16(__m256i in1, __m256i in2, int odd) {
+    __m256i lo, hi;
+    if (odd) {
+        lo = _mm256_srli_epi32(in1, 16 + 6);
+        hi = _mm256_srli_epi32(in2, 16 + 6);
+    } else {
+        lo = _mm256_srli_epi32(_mm256_slli_epi32(in1, 16), 16 + 6);
+        hi = _mm256_srli_epi32(_mm256_slli_epi32(in2, 16), 16 + 6);
+    }
+    return _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xd8);
+}
+
+void svt_unpack_p010_uv_and_2bcompress_avx2(uint16_t *in16b_buffer, uint32_t in16b_stride,
+                                            uint8_t *out8b_cb, uint8_t *out8b_cr,
+                                            uint32_t out8b_stride, uint8_t *out2b_cb,
+                                            uint8_t *out2b_cr, uint32_t out2b_stride,
+                                            uint32_t width, uint32_t height) {
+    const uint32_t width32 = width & ~31u;
+
+    for (uint32_t h = 0; h < height; h++) {
+        uint16_t *in = in16b_buffer + h * in16b_stride;
+        for (uint32_t w = 0; w < width32; w += 32) {
+            const __m256i in0 = _mm256_loadu_si256((__m256i *)(in + 2 * w));
+            const __m256i in1 = _mm256_loadu_si256((__m256i *)(in + 2 * w + 16));
+            const __m256i in2 = _mm256_loadu_si256((__m256i *)(in + 2 * w + 32));
+            const __m256i in3 = _mm256_loadu_si256((__m256i *)(in + 2 * w + 48));
+
+            unpack_and_2bcompress_32x1(p010_deinterleave_16(in0, in1, 0),
+                                       p010_deinterleave_16(in2, in3, 0),
+                                       out8b_cb + h * out8b_stride + w,
+                                       out2b_cb + h * out2b_stride + w / 4);
+            unpack_and_2bcompress_32x1(p010_deinterleave_16(in0, in1, 1),
+                                       p010_deinterleave_16(in2, in3, 1),
+                                       out8b_cr + h * out8b_stride + w,
+                                       out2b_cr + h * out2b_stride + w / 4);
+        }
+    }
+    if (width32 < width)
+        svt_unpack_p010_uv_and_2bcompress_c(in16b_buffer + 2 * width32,
+                                            in16b_stride,
+                                            out8b_cb + width32,
+                                            out8b_cr + width32,
+                                            out8b_stride,
+                                            out2b_cb + width32 / 4,
+                                            out2b_cr + width32 / 4,
+                                            out2b_stride,
+                                            width - width32,
+                                            height);
+}
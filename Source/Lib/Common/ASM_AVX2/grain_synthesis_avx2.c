@@ -0,0 +1,281 @@
+/*
+* Copyright(c) 2022 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include <immintrin.h>
+#include "EbDefinitions.h"
+#include "common_dsp_rtcd.h"
+
+/* All kernels work on 8 samples per iteration in 32-bit lanes, the same
+   precision as the C code, so the result is bit-exact. The scaling function
+   is read with gathers and the columns left over at the right are done by the
+   C kernel. The high bit depth kernels read scaling_lut[256], which has to
+   repeat scaling_lut[255]. */
+
+static INLINE __m256i scale_lut_hbd_avx2(const int32_t *scaling_lut, const __m256i index,
+                                         const int32_t bit_depth) {
+    if (bit_depth == 8)
+        return _mm256_i32gather_epi32((const int *)scaling_lut, index, 4);
+
+    const __m128i shift = _mm_cvtsi32_si128(bit_depth - 8);
+    const __m256i x     = _mm256_srl_epi32(index, shift);
+    const __m256i start = _mm256_i32gather_epi32((const int *)scaling_lut, x, 4);
+    const __m256i end   = _mm256_i32gather_epi32((const int *)scaling_lut + 1, x, 4);
+    const __m256i frac  = _mm256_and_si256(index, _mm256_set1_epi32((1 << (bit_depth - 8)) - 1));
+    const __m256i delta = _mm256_sra_epi32(
+        _mm256_add_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(end, start), frac),
+                         _mm256_set1_epi32(1 << (bit_depth - 9))),
+        shift);
+    return _mm256_add_epi32(start, delta);
+}
+
+// clamp(pixel + ((scale * grain + rounding) >> shift), min, max)
+static INLINE __m256i add_grain_avx2(const __m256i pixel, const __m256i scale,
+                                     const int32_t *grain, const __m256i rounding,
+                                     const __m128i shift, const __m256i min_value,
+                                     const __m256i max_value) {
+    const __m256i noise = _mm256_sra_epi32(
+        _mm256_add_epi32(_mm256_mullo_epi32(scale, _mm256_loadu_si256((const __m256i *)grain)),
+                         rounding),
+        shift);
+    return _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(pixel, noise), min_value),
+                            max_value);
+}
+
+static INLINE __m128i pack_8x32_to_16_avx2(const __m256i v) {
+    return _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi32(v, v), 0x08));
+}
+
+static INLINE void store_8x8bit_avx2(uint8_t *dst, const __m256i v) {
+    const __m128i v16 = pack_8x32_to_16_avx2(v);
+    _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(v16, v16));
+}
+
+// Average luma under 8 chroma samples, either 8 or 16 luma samples wide
+static INLINE __m256i average_luma_avx2(const uint8_t *luma, const int32_t subsamp_x) {
+    if (subsamp_x) {
+        const __m128i sum = _mm_maddubs_epi16(_mm_loadu_si128((const __m128i *)luma),
+                                              _mm_set1_epi8(1));
+        return _mm256_cvtepu16_epi32(_mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(1)), 1));
+    }
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)luma));
+}
+
+static INLINE __m256i average_luma_hbd_avx2(const uint16_t *luma, const int32_t subsamp_x) {
+    if (subsamp_x) {
+        const __m256i sum = _mm256_madd_epi16(_mm256_loadu_si256((const __m256i *)luma),
+                                              _mm256_set1_epi16(1));
+        return _mm256_srli_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(1)), 1);
+    }
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)luma));
+}
+
+// clamp(((average_luma * luma_mult + mult * chroma) >> 6) + offset, 0, max_index)
+static INLINE __m256i chroma_lut_index_avx2(const __m256i average_luma, const __m256i chroma,
+                                            const __m256i luma_mult, const __m256i mult,
+                                            const __m256i offset, const __m256i max_index) {
+    const __m256i combined = _mm256_add_epi32(_mm256_mullo_epi32(average_luma, luma_mult),
+                                              _mm256_mullo_epi32(chroma, mult));
+    const __m256i index    = _mm256_add_epi32(_mm256_srai_epi32(combined, 6), offset);
+    return _mm256_min_epi32(_mm256_max_epi32(index, _mm256_setzero_si256()), max_index);
+}
+
+void svt_av1_add_luma_grain_avx2(uint8_t *luma, int32_t luma_stride, const int32_t *grain,
+                                 int32_t grain_stride, int32_t width, int32_t height,
+                                 const int32_t *scaling_lut, int32_t scaling_shift,
+                                 int32_t min_value, int32_t max_value) {
+    const __m256i rounding = _mm256_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift    = _mm_cvtsi32_si128(scaling_shift);
+    const __m256i min_v    = _mm256_set1_epi32(min_value);
+    const __m256i max_v    = _mm256_set1_epi32(max_value);
+    const int32_t width8   = width & ~7;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint8_t       *luma_row  = luma + i * luma_stride;
+        const int32_t *grain_row = grain + i * grain_stride;
+        for (int32_t j = 0; j < width8; j += 8) {
+            const __m256i pixel = _mm256_cvtepu8_epi32(
+                _mm_loadl_epi64((const __m128i *)(luma_row + j)));
+            const __m256i scale = _mm256_i32gather_epi32((const int *)scaling_lut, pixel, 4);
+            store_8x8bit_avx2(
+                luma_row + j,
+                add_grain_avx2(pixel, scale, grain_row + j, rounding, shift, min_v, max_v));
+        }
+    }
+
+    if (width8 < width)
+        svt_av1_add_luma_grain_c(luma + width8,
+                                 luma_stride,
+                                 grain + width8,
+                                 grain_stride,
+                                 width - width8,
+                                 height,
+                                 scaling_lut,
+                                 scaling_shift,
+                                 min_value,
+                                 max_value);
+}
+
+void svt_av1_add_luma_grain_hbd_avx2(uint16_t *luma, int32_t luma_stride, const int32_t *grain,
+                                     int32_t grain_stride, int32_t width, int32_t height,
+                                     const int32_t *scaling_lut, int32_t scaling_shift,
+                                     int32_t min_value, int32_t max_value, int32_t bit_depth) {
+    const __m256i rounding = _mm256_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift    = _mm_cvtsi32_si128(scaling_shift);
+    const __m256i min_v    = _mm256_set1_epi32(min_value);
+    const __m256i max_v    = _mm256_set1_epi32(max_value);
+    const int32_t width8   = width & ~7;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint16_t      *luma_row  = luma + i * luma_stride;
+        const int32_t *grain_row = grain + i * grain_stride;
+        for (int32_t j = 0; j < width8; j += 8) {
+            const __m256i pixel = _mm256_cvtepu16_epi32(
+                _mm_loadu_si128((const __m128i *)(luma_row + j)));
+            const __m256i scale = scale_lut_hbd_avx2(scaling_lut, pixel, bit_depth);
+            _mm_storeu_si128(
+                (__m128i *)(luma_row + j),
+                pack_8x32_to_16_avx2(
+                    add_grain_avx2(pixel, scale, grain_row + j, rounding, shift, min_v, max_v)));
+        }
+    }
+
+    if (width8 < width)
+        svt_av1_add_luma_grain_hbd_c(luma + width8,
+                                     luma_stride,
+                                     grain + width8,
+                                     grain_stride,
+                                     width - width8,
+                                     height,
+                                     scaling_lut,
+                                     scaling_shift,
+                                     min_value,
+                                     max_value,
+                                     bit_depth);
+}
+
+void svt_av1_add_chroma_grain_avx2(uint8_t *chroma, int32_t chroma_stride, const uint8_t *luma,
+                                   int32_t luma_stride, const int32_t *grain,
+                                   int32_t grain_stride, int32_t width, int32_t height,
+                                   int32_t subsamp_x, int32_t subsamp_y,
+                                   const int32_t *scaling_lut, int32_t scaling_shift,
+                                   int32_t mult, int32_t luma_mult, int32_t offset,
+                                   int32_t min_value, int32_t max_value, int32_t bit_depth) {
+    const __m256i rounding    = _mm256_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift       = _mm_cvtsi32_si128(scaling_shift);
+    const __m256i min_v       = _mm256_set1_epi32(min_value);
+    const __m256i max_v       = _mm256_set1_epi32(max_value);
+    const __m256i mult_v      = _mm256_set1_epi32(mult);
+    const __m256i luma_mult_v = _mm256_set1_epi32(luma_mult);
+    const __m256i offset_v    = _mm256_set1_epi32(offset);
+    const __m256i max_index   = _mm256_set1_epi32((256 << (bit_depth - 8)) - 1);
+    const int32_t width8      = width & ~7;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint8_t       *chroma_row = chroma + i * chroma_stride;
+        const uint8_t *luma_row   = luma + (i << subsamp_y) * luma_stride;
+        const int32_t *grain_row  = grain + i * grain_stride;
+        for (int32_t j = 0; j < width8; j += 8) {
+            const __m256i pixel = _mm256_cvtepu8_epi32(
+                _mm_loadl_epi64((const __m128i *)(chroma_row + j)));
+            const __m256i index = chroma_lut_index_avx2(
+                average_luma_avx2(luma_row + (j << subsamp_x), subsamp_x),
+                pixel,
+                luma_mult_v,
+                mult_v,
+                offset_v,
+                max_index);
+            const __m256i scale = _mm256_i32gather_epi32((const int *)scaling_lut, index, 4);
+            store_8x8bit_avx2(
+                chroma_row + j,
+                add_grain_avx2(pixel, scale, grain_row + j, rounding, shift, min_v, max_v));
+        }
+    }
+
+    if (width8 < width)
+        svt_av1_add_chroma_grain_c(chroma + width8,
+                                   chroma_stride,
+                                   luma + (width8 << subsamp_x),
+                                   luma_stride,
+                                   grain + width8,
+                                   grain_stride,
+                                   width - width8,
+                                   height,
+                                   subsamp_x,
+                                   subsamp_y,
+                                   scaling_lut,
+                                   scaling_shift,
+                                   mult,
+                                   luma_mult,
+                                   offset,
+                                   min_value,
+                                   max_value,
+                                   bit_depth);
+}
+
+void svt_av1_add_chroma_grain_hbd_avx2(uint16_t *chroma, int32_t chroma_stride,
+                                       const uint16_t *luma, int32_t luma_stride,
+                                       const int32_t *grain, int32_t grain_stride, int32_t width,
+                                       int32_t height, int32_t subsamp_x, int32_t subsamp_y,
+                                       const int32_t *scaling_lut, int32_t scaling_shift,
+                                       int32_t mult, int32_t luma_mult, int32_t offset,
+                                       int32_t min_value, int32_t max_value, int32_t bit_depth) {
+    const __m256i rounding    = _mm256_set1_epi32(1 << (scaling_shift - 1));
+    const __m128i shift       = _mm_cvtsi32_si128(scaling_shift);
+    const __m256i min_v       = _mm256_set1_epi32(min_value);
+    const __m256i max_v       = _mm256_set1_epi32(max_value);
+    const __m256i mult_v      = _mm256_set1_epi32(mult);
+    const __m256i luma_mult_v = _mm256_set1_epi32(luma_mult);
+    const __m256i offset_v    = _mm256_set1_epi32(offset);
+    const __m256i max_index   = _mm256_set1_epi32((256 << (bit_depth - 8)) - 1);
+    const int32_t width8      = width & ~7;
+
+    for (int32_t i = 0; i < height; i++) {
+        uint16_t       *chroma_row = chroma + i * chroma_stride;
+        const uint16_t *luma_row   = luma + (i << subsamp_y) * luma_stride;
+        const int32_t  *grain_row  = grain + i * grain_stride;
+        for (int32_t j = 0; j < width8; j += 8) {
+            const __m256i pixel = _mm256_cvtepu16_epi32(
+                _mm_loadu_si128((const __m128i *)(chroma_row + j)));
+            const __m256i index = chroma_lut_index_avx2(
+                average_luma_hbd_avx2(luma_row + (j << subsamp_x), subsamp_x),
+                pixel,
+                luma_mult_v,
+                mult_v,
+                offset_v,
+                max_index);
+            const __m256i scale = scale_lut_hbd_avx2(scaling_lut, index, bit_depth);
+            _mm_storeu_si128(
+                (__m128i *)(chroma_row + j),
+                pack_8x32_to_16_avx2(
+                    add_grain_avx2(pixel, scale, grain_row + j, rounding, shift, min_v, max_v)));
+        }
+    }
+
+    if (width8 < width)
+        svt_av1_add_chroma_grain_hbd_c(chroma + width8,
+                                       chroma_stride,
+                                       luma + (width8 << subsamp_x),
+                                       luma_stride,
+                                       grain + width8,
+                                       grain_stride,
+                                       width - width8,
+                                       height,
+                                       subsamp_x,
+                                       subsamp_y,
+                                       scaling_lut,
+                                       scaling_shift,
+                                       mult,
+                                       luma_mult,
+                                       offset,
+                                       min_value,
+                                       max_value,
+                                       bit_depth);
+}
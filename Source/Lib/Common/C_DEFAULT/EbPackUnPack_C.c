@@ -152,6 +152,52 @@ void svt_unpack_and_2bcompress_c(uint16_t *in16b_buffer, uint32_t in16b_stride,
     }
 }
 
+/* Same as svt_unpack_and_2bcompress_c() for P010 luma, where the 10-bit samples are stored in
+ * the 10 most significant bits of each 16-bit word. */
+void svt_unpack_p010_and_2bcompress_c(uint16_t *in16b_buffer, uint32_t in16b_stride,
+                                      uint8_t *out8b_buffer, uint32_t out8b_stride,
+                                      uint8_t *out2b_buffer, uint32_t out2b_stride, uint32_t width,
+                                      uint32_t height) {
+    for (uint32_t row = 0; row < height; row++) {
+        uint8_t compressed_unpacked_pixel = 0;
+        for (uint32_t col = 0; col < width; col++) {
+            const uint16_t in_pixel = in16b_buffer[col + row * in16b_stride];
+            out8b_buffer[col + row * out8b_stride] = (uint8_t)(in_pixel >> 8);
+            compressed_unpacked_pixel |= ((in_pixel >> 6) & 0x3) << (6 - 2 * (col & 3));
+            if ((col & 3) == 3 || col == width - 1) {
+                out2b_buffer[col / 4 + row * out2b_stride] = compressed_unpacked_pixel;
+                compressed_unpacked_pixel                  = 0;
+            }
+        }
+    }
+}
+
+/* Same as svt_unpack_p010_and_2bcompress_c() for the interleaved CbCr plane of P010: the samples
+ * are deinterleaved into the Cb and Cr planes in the same pass. width is in chroma samples. */
+void svt_unpack_p010_uv_and_2bcompress_c(uint16_t *in16b_buffer, uint32_t in16b_stride,
+                                         uint8_t *out8b_cb, uint8_t *out8b_cr,
+                                         uint32_t out8b_stride, uint8_t *out2b_cb,
+                                         uint8_t *out2b_cr, uint32_t out2b_stride, uint32_t width,
+                                         uint32_t height) {
+    for (uint32_t row = 0; row < height; row++) {
+        uint8_t compressed_cb = 0, compressed_cr = 0;
+        for (uint32_t col = 0; col < width; col++) {
+            const uint16_t cb    = in16b_buffer[2 * col + 0 + row * in16b_stride];
+            const uint16_t cr    = in16b_buffer[2 * col + 1 + row * in16b_stride];
+            const int      shift = 6 - 2 * (col & 3);
+            out8b_cb[col + row * out8b_stride] = (uint8_t)(cb >> 8);
+            out8b_cr[col + row * out8b_stride] = (uint8_t)(cr >> 8);
+            compressed_cb |= ((cb >> 6) & 0x3) << shift;
+            compressed_cr |= ((cr >> 6) & 0x3) << shift;
+            if ((col & 3) == 3 || col == width - 1) {
+                out2b_cb[col / 4 + row * out2b_stride] = compressed_cb;
+                out2b_cr[col / 4 + row * out2b_stride] = compressed_cr;
+                compressed_cb = compressed_cr = 0;
+            }
+        }
+    }
+}
+
 /************************************************
 * convert unpacked nbit (n=2) data to compressedPAcked
 2bit data storage : 4 2bit-pixels in one byte
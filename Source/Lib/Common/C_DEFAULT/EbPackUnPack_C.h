@@ -22,6 +22,17 @@ void svt_unpack_and_2bcompress_c(uint16_t *in16b_buffer, uint32_t in16b_stride,
                                  uint8_t *out2b_buffer, uint32_t out2b_stride, uint32_t width,
                                  uint32_t height);
 
+void svt_unpack_p010_and_2bcompress_c(uint16_t *in16b_buffer, uint32_t in16b_stride,
+                                      uint8_t *out8b_buffer, uint32_t out8b_stride,
+                                      uint8_t *out2b_buffer, uint32_t out2b_stride, uint32_t width,
+                                      uint32_t height);
+
+void svt_unpack_p010_uv_and_2bcompress_c(uint16_t *in16b_buffer, uint32_t in16b_stride,
+                                         uint8_t *out8b_cb, uint8_t *out8b_cr,
+                                         uint32_t out8b_stride, uint8_t *out2b_cb,
+                                         uint8_t *out2b_cr, uint32_t out2b_stride, uint32_t width,
+                                         uint32_t height);
+
 void svt_enc_msb_pack2_d(uint8_t *in8_bit_buffer, uint32_t in8_stride, uint8_t *inn_bit_buffer,
                          uint16_t *out16_bit_buffer, uint32_t inn_stride, uint32_t out_stride,
                          uint32_t width, uint32_t height);
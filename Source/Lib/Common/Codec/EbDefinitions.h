@@ -2011,11 +2011,10 @@ static const EbWarpedMotionParams default_warp_params = {
 
 #define MAX_BITS_PER_FRAME            8000000
 
-#define SC_FRAMES_TO_IGNORE     1000 // The speed control algorith starts after SC_FRAMES_TO_IGNORE number frames.
-#define SC_FRAMES_INTERVAL_SPEED      60 // The speed control Interval To Check the speed
-#define SC_FRAMES_INTERVAL_T1         60 // The speed control Interval Threshold1
-#define SC_FRAMES_INTERVAL_T2        180 // The speed control Interval Threshold2
-#define SC_FRAMES_INTERVAL_T3        120 // The speed control Interval Threshold3
+#define SC_CHECKS_PER_SECOND           4 // The speed control checks the input buffer 4 times per second of input
+#define SC_SPEED_HEADROOM_PCT        120 // The speed control goes to a slower preset when the measured speed is 20% above the target
+#define SC_PROBE_SECONDS               4 // The speed control tries a slower preset after 4 seconds paced by the source
+#define SC_PROBE_SECONDS_MAX          64 // The probe interval doubles each time a slower preset fails to keep up
 
 #define LAST_BWD_FRAME     8
 #define LAST_ALT_FRAME    16
@@ -2181,8 +2180,6 @@ typedef uint8_t EbPartMode;
 #define ENC_M13         13
 
 #define MAX_SUPPORTED_MODES 16
-
-#define SPEED_CONTROL_INIT_MOD ENC_M4;
 /** The EB_TUID type is used to identify a TU within a CU.
 */
 typedef enum EbTuSize
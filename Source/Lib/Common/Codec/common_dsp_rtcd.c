@@ -532,6 +532,11 @@ void setup_common_rtcd_internal(CPU_FLAGS flags) {
 #endif
 #endif
 
+    SET_AVX2(svt_av1_add_luma_grain, svt_av1_add_luma_grain_c, svt_av1_add_luma_grain_avx2);
+    SET_AVX2(svt_av1_add_luma_grain_hbd, svt_av1_add_luma_grain_hbd_c, svt_av1_add_luma_grain_hbd_avx2);
+    SET_AVX2(svt_av1_add_chroma_grain, svt_av1_add_chroma_grain_c, svt_av1_add_chroma_grain_avx2);
+    SET_AVX2(svt_av1_add_chroma_grain_hbd, svt_av1_add_chroma_grain_hbd_c, svt_av1_add_chroma_grain_hbd_avx2);
+
     SET_SSE41(svt_copy_rect8_8bit_to_16bit, svt_copy_rect8_8bit_to_16bit_c, svt_copy_rect8_8bit_to_16bit_sse4_1);
     SET_SSE41_AVX2(svt_av1_highbd_warp_affine, svt_av1_highbd_warp_affine_c, svt_av1_highbd_warp_affine_sse4_1, svt_av1_highbd_warp_affine_avx2);
     SET_AVX2(dec_svt_av1_highbd_warp_affine, dec_svt_av1_highbd_warp_affine_c, dec_svt_av1_highbd_warp_affine_avx2);
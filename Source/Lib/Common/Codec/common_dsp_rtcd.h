@@ -1025,6 +1025,14 @@ extern "C" {
     RTCD_EXTERN void(*svt_cdef_filter_block_8xn_16)(const uint16_t *const in, const int32_t pri_strength, const int32_t sec_strength, const int32_t dir, int32_t pri_damping, int32_t sec_damping, const int32_t coeff_shift, uint16_t *const dst, const int32_t dstride, uint8_t height, uint8_t subsampling_factor);
     void svt_copy_rect8_8bit_to_16bit_c(uint16_t *dst, int32_t dstride, const uint8_t *src, int32_t sstride, int32_t v, int32_t h);
     RTCD_EXTERN void(*svt_copy_rect8_8bit_to_16bit)(uint16_t *dst, int32_t dstride, const uint8_t *src, int32_t sstride, int32_t v, int32_t h);
+    void svt_av1_add_luma_grain_c(uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, const int32_t *scaling_lut, int32_t scaling_shift, int32_t min_value, int32_t max_value);
+    RTCD_EXTERN void(*svt_av1_add_luma_grain)(uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, const int32_t *scaling_lut, int32_t scaling_shift, int32_t min_value, int32_t max_value);
+    void svt_av1_add_luma_grain_hbd_c(uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, const int32_t *scaling_lut, int32_t scaling_shift, int32_t min_value, int32_t max_value, int32_t bit_depth);
+    RTCD_EXTERN void(*svt_av1_add_luma_grain_hbd)(uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, const int32_t *scaling_lut, int32_t scaling_shift, int32_t min_value, int32_t max_value, int32_t bit_depth);
+    void svt_av1_add_chroma_grain_c(uint8_t *chroma, int32_t chroma_stride, const uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t subsamp_x, int32_t subsamp_y, const int32_t *scaling_lut, int32_t scaling_shift, int32_t mult, int32_t luma_mult, int32_t offset, int32_t min_value, int32_t max_value, int32_t bit_depth);
+    RTCD_EXTERN void(*svt_av1_add_chroma_grain)(uint8_t *chroma, int32_t chroma_stride, const uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t subsamp_x, int32_t subsamp_y, const int32_t *scaling_lut, int32_t scaling_shift, int32_t mult, int32_t luma_mult, int32_t offset, int32_t min_value, int32_t max_value, int32_t bit_depth);
+    void svt_av1_add_chroma_grain_hbd_c(uint16_t *chroma, int32_t chroma_stride, const uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t subsamp_x, int32_t subsamp_y, const int32_t *scaling_lut, int32_t scaling_shift, int32_t mult, int32_t luma_mult, int32_t offset, int32_t min_value, int32_t max_value, int32_t bit_depth);
+    RTCD_EXTERN void(*svt_av1_add_chroma_grain_hbd)(uint16_t *chroma, int32_t chroma_stride, const uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t subsamp_x, int32_t subsamp_y, const int32_t *scaling_lut, int32_t scaling_shift, int32_t mult, int32_t luma_mult, int32_t offset, int32_t min_value, int32_t max_value, int32_t bit_depth);
     void svt_av1_highbd_warp_affine_c(const int32_t *mat, const uint8_t *ref8b, const uint8_t *ref2b, int width, int height, int stride8b, int stride2b, uint16_t *pred, int p_col, int p_row, int p_width, int p_height, int p_stride, int subsampling_x, int subsampling_y, int bd, ConvolveParams *conv_params, int16_t alpha, int16_t beta, int16_t gamma, int16_t delta);
     RTCD_EXTERN void(*svt_av1_highbd_warp_affine)(const int32_t *mat, const uint8_t *ref8b, const uint8_t *ref2b, int width, int height, int stride8b, int stride2b, uint16_t *pred, int p_col, int p_row, int p_width, int p_height, int p_stride, int subsampling_x, int subsampling_y, int bd, ConvolveParams *conv_params, int16_t alpha, int16_t beta, int16_t gamma, int16_t delta);
 
@@ -2201,6 +2209,10 @@ extern "C" {
     void svt_cdef_filter_block_8xn_16_avx512(const uint16_t *const in, const int32_t pri_strength, const int32_t sec_strength, const int32_t dir, int32_t pri_damping, int32_t sec_damping, const int32_t coeff_shift, uint16_t *const dst, const int32_t dstride, uint8_t height, uint8_t subsampling_factor);
     void svt_copy_rect8_8bit_to_16bit_sse4_1(uint16_t *dst, int32_t dstride, const uint8_t *src, int32_t sstride, int32_t v, int32_t h);
 
+    void svt_av1_add_luma_grain_avx2(uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, const int32_t *scaling_lut, int32_t scaling_shift, int32_t min_value, int32_t max_value);
+    void svt_av1_add_luma_grain_hbd_avx2(uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, const int32_t *scaling_lut, int32_t scaling_shift, int32_t min_value, int32_t max_value, int32_t bit_depth);
+    void svt_av1_add_chroma_grain_avx2(uint8_t *chroma, int32_t chroma_stride, const uint8_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t subsamp_x, int32_t subsamp_y, const int32_t *scaling_lut, int32_t scaling_shift, int32_t mult, int32_t luma_mult, int32_t offset, int32_t min_value, int32_t max_value, int32_t bit_depth);
+    void svt_av1_add_chroma_grain_hbd_avx2(uint16_t *chroma, int32_t chroma_stride, const uint16_t *luma, int32_t luma_stride, const int32_t *grain, int32_t grain_stride, int32_t width, int32_t height, int32_t subsamp_x, int32_t subsamp_y, const int32_t *scaling_lut, int32_t scaling_shift, int32_t mult, int32_t luma_mult, int32_t offset, int32_t min_value, int32_t max_value, int32_t bit_depth);
     void svt_av1_highbd_warp_affine_sse4_1(const int32_t *mat, const uint8_t *ref8b, const uint8_t *ref2b,  int width, int height, int stride8b, int stride2b, uint16_t *pred, int p_col, int p_row, int p_width, int p_height, int p_stride, int subsampling_x, int subsampling_y, int bd, ConvolveParams *conv_params, int16_t alpha, int16_t beta, int16_t gamma, int16_t delta);
     void svt_av1_highbd_warp_affine_avx2(const int32_t *mat, const uint8_t *ref8b, const uint8_t *ref2b,  int width, int height, int stride8b, int stride2b, uint16_t *pred, int p_col, int p_row, int p_width, int p_height, int p_stride, int subsampling_x, int subsampling_y, int bd, ConvolveParams *conv_params, int16_t alpha, int16_t beta, int16_t gamma, int16_t delta);
     void dec_svt_av1_highbd_warp_affine_avx2(const int32_t *mat, const uint16_t *ref, int width, int height, int stride, uint16_t *pred, int p_col, int p_row, int p_width, int p_height, int p_stride, int subsampling_x, int subsampling_y, int bd, ConvolveParams *conv_params, int16_t alpha, int16_t beta, int16_t gamma, int16_t delta);
@@ -102,6 +102,25 @@ void svt_av1_add_film_grain_run(AomFilmGrain *grain_params, uint8_t *luma, uint8
                                 int32_t chroma_stride, int32_t use_high_bit_depth,
                                 int32_t chroma_subsamp_y, int32_t chroma_subsamp_x);
 
+// Grain is laid out in stripes of this many luma rows
+#define FGN_STRIPE_HEIGHT 32
+
+/*!\brief Add film grain to a range of rows
+     *
+     * Same as svt_av1_add_film_grain_run() restricted to the luma rows
+     * [row_start, row_end). Disjoint ranges of one picture can be processed
+     * at the same time and give the same result as a single call on the whole
+     * picture.
+     *
+     * \param[in]    row_start        first luma row, a multiple of FGN_STRIPE_HEIGHT
+     * \param[in]    row_end          end luma row, clipped to height
+     */
+void svt_av1_add_film_grain_rows(AomFilmGrain *grain_params, uint8_t *luma, uint8_t *cb,
+                                 uint8_t *cr, int32_t height, int32_t width, int32_t luma_stride,
+                                 int32_t chroma_stride, int32_t use_high_bit_depth,
+                                 int32_t chroma_subsamp_y, int32_t chroma_subsamp_x,
+                                 int32_t row_start, int32_t row_end);
+
 /*!\brief Add film grain
      *
      * Add film grain to an image
@@ -0,0 +1,268 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+// SUMMARY
+//   Contains the asynchronous decode API : bounded input/output queues
+//   and the library thread driving the decoder between them
+
+/**************************************
+ * Includes
+ **************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "EbDefinitions.h"
+#include "EbSvtAv1Dec.h"
+#include "EbDecHandle.h"
+#include "EbDecAsync.h"
+#include "EbThreads.h"
+#include "EbLog.h"
+
+EbErrorType decode_temporal_unit(EbDecHandle *dec_handle_ptr, const uint8_t *data,
+                                 const size_t data_size, uint32_t is_annexb);
+int         svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer);
+
+/* Push a picture (or the EOS marker) to the output queue. Called by the
+   decode thread once a free slot has been acquired. */
+static void dec_async_push_output(DecAsyncCtxt *async_ctxt) {
+    svt_block_on_mutex(async_ctxt->out_mutex);
+    async_ctxt->out_wr_idx = (async_ctxt->out_wr_idx + 1) % async_ctxt->queue_size;
+    async_ctxt->out_count++;
+    svt_release_mutex(async_ctxt->out_mutex);
+    svt_post_semaphore(async_ctxt->out_full_semaphore);
+
+    void (*picture_ready_cb)(void *) =
+        async_ctxt->dec_handle_ptr->dec_config.picture_ready_cb;
+    if (picture_ready_cb)
+        picture_ready_cb(async_ctxt->svt_dec_component->p_application_private);
+}
+
+/* Decode thread : consumes temporal units and produces output pictures */
+static void *dec_async_kernel(void *input_ptr) {
+    DecAsyncCtxt *async_ctxt     = (DecAsyncCtxt *)input_ptr;
+    EbDecHandle  *dec_handle_ptr = async_ctxt->dec_handle_ptr;
+
+    while (1) {
+        svt_block_on_semaphore(async_ctxt->in_full_semaphore);
+        if (async_ctxt->abort_flag)
+            break;
+
+        DecAsyncInput *input = &async_ctxt->in_queue[async_ctxt->in_rd_idx];
+        async_ctxt->in_rd_idx = (async_ctxt->in_rd_idx + 1) % async_ctxt->queue_size;
+
+        if (input->eos) {
+            svt_block_on_semaphore(async_ctxt->out_free_semaphore);
+            if (async_ctxt->abort_flag)
+                break;
+            async_ctxt->out_queue[async_ctxt->out_wr_idx].eos = EB_TRUE;
+            dec_async_push_output(async_ctxt);
+            break;
+        }
+
+        EbErrorType return_error = decode_temporal_unit(
+            dec_handle_ptr, input->data, input->data_size, input->is_annexb);
+        if (return_error != EB_ErrorNone)
+            async_ctxt->decode_error = return_error;
+
+        /* Input data is no longer referenced once the temporal unit is decoded */
+        svt_post_semaphore(async_ctxt->in_free_semaphore);
+
+        if (!dec_handle_ptr->show_frame)
+            continue;
+
+        /* Blocks while the application has not consumed queue_size pictures */
+        svt_block_on_semaphore(async_ctxt->out_free_semaphore);
+        if (async_ctxt->abort_flag)
+            break;
+
+        DecAsyncOutput *output = &async_ctxt->out_queue[async_ctxt->out_wr_idx];
+        EbBitDepth bit_depth = (EbBitDepth)dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf->bit_depth;
+        /* Slot buffers may come from the application after a swap :
+           force reallocation when the sample size does not match */
+        if (output->pic.bit_depth != bit_depth) {
+            output->pic.bit_depth = bit_depth;
+            output->pic.width     = 0;
+        }
+        EbBufferHeaderType out_hdr;
+        memset(&out_hdr, 0, sizeof(out_hdr));
+        out_hdr.p_buffer = (uint8_t *)&output->pic;
+        output->eos      = EB_FALSE;
+        if (svt_dec_out_buf(dec_handle_ptr, &out_hdr))
+            dec_async_push_output(async_ctxt);
+        else
+            svt_post_semaphore(async_ctxt->out_free_semaphore);
+    }
+    return NULL;
+}
+
+EbErrorType dec_async_init(EbDecHandle *dec_handle_ptr, EbComponentType *svt_dec_component) {
+    uint32_t queue_size = dec_handle_ptr->dec_config.async_queue_size;
+
+    DecAsyncCtxt *async_ctxt = (DecAsyncCtxt *)calloc(1, sizeof(DecAsyncCtxt));
+    if (async_ctxt == NULL)
+        return EB_ErrorInsufficientResources;
+    dec_handle_ptr->pv_async_ctxt = async_ctxt;
+
+    async_ctxt->dec_handle_ptr    = dec_handle_ptr;
+    async_ctxt->svt_dec_component = svt_dec_component;
+    async_ctxt->queue_size        = queue_size;
+    async_ctxt->decode_error      = EB_ErrorNone;
+
+    async_ctxt->in_queue  = (DecAsyncInput *)calloc(queue_size, sizeof(DecAsyncInput));
+    async_ctxt->out_queue = (DecAsyncOutput *)calloc(queue_size, sizeof(DecAsyncOutput));
+    if (async_ctxt->in_queue == NULL || async_ctxt->out_queue == NULL)
+        return EB_ErrorInsufficientResources;
+
+    /* Output pictures are allocated on first use, once the stream
+       dimensions are known */
+    for (uint32_t i = 0; i < queue_size; i++) {
+        async_ctxt->out_queue[i].pic.color_fmt = dec_handle_ptr->dec_config.max_color_format;
+        async_ctxt->out_queue[i].pic.bit_depth = dec_handle_ptr->dec_config.max_bit_depth;
+    }
+
+    async_ctxt->in_free_semaphore  = svt_create_semaphore(queue_size, queue_size);
+    async_ctxt->in_full_semaphore  = svt_create_semaphore(0, queue_size + 1);
+    async_ctxt->out_free_semaphore = svt_create_semaphore(queue_size, queue_size + 1);
+    async_ctxt->out_full_semaphore = svt_create_semaphore(0, queue_size);
+    async_ctxt->out_mutex          = svt_create_mutex();
+    if (!async_ctxt->in_free_semaphore || !async_ctxt->in_full_semaphore ||
+        !async_ctxt->out_free_semaphore || !async_ctxt->out_full_semaphore ||
+        !async_ctxt->out_mutex)
+        return EB_ErrorInsufficientResources;
+
+    async_ctxt->decode_thread = svt_create_thread(dec_async_kernel, async_ctxt);
+    if (async_ctxt->decode_thread == NULL)
+        return EB_ErrorInsufficientResources;
+    return EB_ErrorNone;
+}
+
+void dec_async_deinit(EbDecHandle *dec_handle_ptr) {
+    DecAsyncCtxt *async_ctxt = (DecAsyncCtxt *)dec_handle_ptr->pv_async_ctxt;
+    if (async_ctxt == NULL)
+        return;
+
+    if (async_ctxt->decode_thread) {
+        /* Wake the decode thread wherever it is blocked */
+        async_ctxt->abort_flag = EB_TRUE;
+        svt_post_semaphore(async_ctxt->in_full_semaphore);
+        svt_post_semaphore(async_ctxt->out_free_semaphore);
+        svt_destroy_thread(async_ctxt->decode_thread);
+    }
+
+    for (uint32_t i = 0; i < async_ctxt->queue_size; i++) {
+        if (async_ctxt->in_queue)
+            free(async_ctxt->in_queue[i].data);
+        if (async_ctxt->out_queue) {
+            free(async_ctxt->out_queue[i].pic.luma);
+            free(async_ctxt->out_queue[i].pic.cb);
+            free(async_ctxt->out_queue[i].pic.cr);
+        }
+    }
+    free(async_ctxt->in_queue);
+    free(async_ctxt->out_queue);
+
+    if (async_ctxt->in_free_semaphore)
+        svt_destroy_semaphore(async_ctxt->in_free_semaphore);
+    if (async_ctxt->in_full_semaphore)
+        svt_destroy_semaphore(async_ctxt->in_full_semaphore);
+    if (async_ctxt->out_free_semaphore)
+        svt_destroy_semaphore(async_ctxt->out_free_semaphore);
+    if (async_ctxt->out_full_semaphore)
+        svt_destroy_semaphore(async_ctxt->out_full_semaphore);
+    if (async_ctxt->out_mutex)
+        svt_destroy_mutex(async_ctxt->out_mutex);
+
+    free(async_ctxt);
+    dec_handle_ptr->pv_async_ctxt = NULL;
+}
+
+EbErrorType dec_async_send_data(EbDecHandle *dec_handle_ptr, const uint8_t *data,
+                                const size_t data_size, uint32_t is_annexb) {
+    DecAsyncCtxt *async_ctxt = (DecAsyncCtxt *)dec_handle_ptr->pv_async_ctxt;
+
+    if (async_ctxt->eos_sent)
+        return EB_ErrorBadParameter;
+    if (async_ctxt->decode_error != EB_ErrorNone)
+        return async_ctxt->decode_error;
+
+    /* Blocks while queue_size temporal units are pending */
+    svt_block_on_semaphore(async_ctxt->in_free_semaphore);
+
+    DecAsyncInput *input = &async_ctxt->in_queue[async_ctxt->in_wr_idx];
+    if (data == NULL || data_size == 0) {
+        input->eos           = EB_TRUE;
+        input->data_size     = 0;
+        async_ctxt->eos_sent = EB_TRUE;
+    } else {
+        if (input->alloc_size < data_size) {
+            free(input->data);
+            input->data = (uint8_t *)malloc(data_size);
+            if (input->data == NULL) {
+                input->alloc_size = 0;
+                svt_post_semaphore(async_ctxt->in_free_semaphore);
+                return EB_ErrorInsufficientResources;
+            }
+            input->alloc_size = data_size;
+        }
+        memcpy(input->data, data, data_size);
+        input->data_size = data_size;
+        input->is_annexb = is_annexb;
+        input->eos       = EB_FALSE;
+    }
+    async_ctxt->in_wr_idx = (async_ctxt->in_wr_idx + 1) % async_ctxt->queue_size;
+    svt_post_semaphore(async_ctxt->in_full_semaphore);
+    return EB_ErrorNone;
+}
+
+EbErrorType dec_async_receive_picture(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer,
+                                      EbAV1StreamInfo *stream_info, EbAV1FrameInfo *frame_info,
+                                      uint8_t wait) {
+    (void)stream_info;
+    (void)frame_info;
+    DecAsyncCtxt *async_ctxt = (DecAsyncCtxt *)dec_handle_ptr->pv_async_ctxt;
+
+    if (async_ctxt->eos_received)
+        return EB_NoErrorFifoShutdown;
+
+    if (wait) {
+        svt_block_on_semaphore(async_ctxt->out_full_semaphore);
+        svt_block_on_mutex(async_ctxt->out_mutex);
+        async_ctxt->out_count--;
+        svt_release_mutex(async_ctxt->out_mutex);
+    } else {
+        svt_block_on_mutex(async_ctxt->out_mutex);
+        if (async_ctxt->out_count == 0) {
+            svt_release_mutex(async_ctxt->out_mutex);
+            return EB_DecNoOutputPicture;
+        }
+        async_ctxt->out_count--;
+        svt_release_mutex(async_ctxt->out_mutex);
+        /* Does not block : one post per queued picture */
+        svt_block_on_semaphore(async_ctxt->out_full_semaphore);
+    }
+
+    DecAsyncOutput *output = &async_ctxt->out_queue[async_ctxt->out_rd_idx];
+    if (output->eos) {
+        async_ctxt->eos_received = EB_TRUE;
+        return EB_NoErrorFifoShutdown;
+    }
+    async_ctxt->out_rd_idx = (async_ctxt->out_rd_idx + 1) % async_ctxt->queue_size;
+
+    /* Hand over the picture by swapping buffers with the application, the
+       previous application buffers are recycled for a later picture */
+    EbSvtIOFormat *out_img = (EbSvtIOFormat *)p_buffer->p_buffer;
+    EbSvtIOFormat  tmp     = *out_img;
+    *out_img               = output->pic;
+    output->pic            = tmp;
+
+    svt_post_semaphore(async_ctxt->out_free_semaphore);
+    return EB_ErrorNone;
+}
@@ -0,0 +1,88 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#ifndef EbDecAsync_h
+#define EbDecAsync_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "EbDecHandle.h"
+
+/* Temporal unit submitted through svt_av1_dec_send_data */
+typedef struct DecAsyncInput {
+    uint8_t *data;
+    size_t   data_size;
+    /* Allocated size of data, reused across temporal units */
+    size_t   alloc_size;
+    uint32_t is_annexb;
+    /* End of stream marker : no data attached */
+    EbBool eos;
+} DecAsyncInput;
+
+/* Decoded picture waiting in the output queue */
+typedef struct DecAsyncOutput {
+    EbSvtIOFormat pic;
+    /* End of stream marker : no picture attached */
+    EbBool eos;
+} DecAsyncOutput;
+
+/* Asynchronous decode context. Temporal units are decoded by a library
+   thread while the application keeps submitting data; both queues are
+   bounded so the library never buffers more than queue_size pictures. */
+typedef struct DecAsyncCtxt {
+    EbDecHandle     *dec_handle_ptr;
+    EbComponentType *svt_dec_component;
+
+    uint32_t queue_size;
+
+    /* Input queue : written by the application, read by the decode thread */
+    DecAsyncInput *in_queue;
+    uint32_t       in_wr_idx;
+    uint32_t       in_rd_idx;
+    EbHandle       in_free_semaphore;
+    EbHandle       in_full_semaphore;
+
+    /* Output queue : written by the decode thread, read by the application */
+    DecAsyncOutput *out_queue;
+    uint32_t        out_wr_idx;
+    uint32_t        out_rd_idx;
+    uint32_t        out_count;
+    EbHandle        out_free_semaphore;
+    EbHandle        out_full_semaphore;
+    EbHandle        out_mutex;
+
+    EbHandle decode_thread;
+
+    /* Set once EOS has been submitted, further data is rejected */
+    EbBool eos_sent;
+    /* Set once EOS has been returned to the application */
+    EbBool eos_received;
+    /* Set on deinit to make the decode thread exit without draining */
+    volatile EbBool abort_flag;
+    /* Status of the last failing temporal unit, reported on receive */
+    EbErrorType decode_error;
+} DecAsyncCtxt;
+
+EbErrorType dec_async_init(EbDecHandle *dec_handle_ptr, EbComponentType *svt_dec_component);
+void        dec_async_deinit(EbDecHandle *dec_handle_ptr);
+
+EbErrorType dec_async_send_data(EbDecHandle *dec_handle_ptr, const uint8_t *data,
+                                const size_t data_size, uint32_t is_annexb);
+EbErrorType dec_async_receive_picture(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer,
+                                      EbAV1StreamInfo *stream_info, EbAV1FrameInfo *frame_info,
+                                      uint8_t wait);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbDecAsync_h
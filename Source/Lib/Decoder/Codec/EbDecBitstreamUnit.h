@@ -17,6 +17,9 @@
 #include "EbBitstreamUnit.h"
 //Added this EbBitstreamUnit.h because OdEcWindow is defined in it, but
 //we also defining it, so it leads to warning,  so i commented our defination & added EbBitstreamUnit.h file.
+#ifdef ARCH_X86_64
+#include <emmintrin.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -37,12 +40,13 @@ extern "C" {
 #define EC_PROB_SHIFT 6
 #define EC_MIN_PROB 4 // must be <= (1<<EC_PROB_SHIFT)/16
 
-/*OPT: OdEcWindow must be at least 32 bits, but if you have fast arithmetic
-   on a larger type, you can speed up the decoder by using it here.*/
-//typedef uint32_t OdEcWindow;
+/*The decoder window is wider than the encoder OdEcWindow : a 64 bit window
+   holds up to 6 bytes of look-ahead, so refills happen several times less
+   often and load a whole word at once.*/
+typedef uint64_t DecEcWindow;
 
-/*The size in bits of OdEcWindow.*/
-//#define OD_EC_WINDOW_SIZE ((int)sizeof(OdEcWindow) * CHAR_BIT)
+/*The size in bits of DecEcWindow.*/
+#define DEC_EC_WINDOW_SIZE ((int)sizeof(DecEcWindow) * CHAR_BIT)
 
 /********************************************************************************************************************************/
 /********************************************************************************************************************************/
@@ -70,6 +74,24 @@ extern int   enable_dump;
   inverse).*/
 #define AOM_ICDF(x) (CDF_PROB_TOP - (x))
 
+#ifdef ARCH_X86_64
+/* CDF adaptation of 8 (or 4) consecutive entries starting at cdf[offset].
+   Entries before val move towards CDF_PROB_TOP, the others towards 0.
+   Entries at or after n are kept, which allows partial vectors. */
+static INLINE __m128i dec_update_cdf_lanes(__m128i cdf, int offset, int val, int n, int rate) {
+    const __m128i lane   = _mm_add_epi16(_mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7),
+                                       _mm_set1_epi16((int16_t)offset));
+    const __m128i rate_v = _mm_cvtsi32_si128(rate);
+    const __m128i up     = _mm_add_epi16(
+        cdf, _mm_srl_epi16(_mm_sub_epi16(_mm_set1_epi16((int16_t)CDF_PROB_TOP), cdf), rate_v));
+    const __m128i down   = _mm_sub_epi16(cdf, _mm_srl_epi16(cdf, rate_v));
+    const __m128i is_up  = _mm_cmplt_epi16(lane, _mm_set1_epi16((int16_t)val));
+    const __m128i keep   = _mm_cmpgt_epi16(lane, _mm_set1_epi16((int16_t)(n - 1)));
+    __m128i       res    = _mm_or_si128(_mm_and_si128(is_up, up), _mm_andnot_si128(is_up, down));
+    return _mm_or_si128(_mm_and_si128(keep, cdf), _mm_andnot_si128(keep, res));
+}
+#endif
+
 static INLINE void dec_update_cdf(AomCdfProb *cdf, int8_t val, int nsymbs) {
     int rate;
     int i, tmp;
@@ -77,6 +99,40 @@ static INLINE void dec_update_cdf(AomCdfProb *cdf, int8_t val, int nsymbs) {
     static const int nsymbs2speed[17] = {0, 0, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
     assert(nsymbs < 17);
     rate = 3 + (cdf[nsymbs] > 15) + (cdf[nsymbs] > 31) + nsymbs2speed[nsymbs]; // + get_msb(nsymbs);
+#ifdef ARCH_X86_64
+    /* n entries are adapted, the array holds n + 2 (last CDF entry and counter).
+       Longer alphabets use two overlapping vectors computed from the original
+       values, shorter ones a single vector that keeps the trailing entries. */
+    const int n = nsymbs - 1;
+    if (n >= 8) {
+        const __m128i lo = _mm_loadu_si128((const __m128i *)cdf);
+        const __m128i hi = _mm_loadu_si128((const __m128i *)(cdf + n - 8));
+        _mm_storeu_si128((__m128i *)(cdf + n - 8), dec_update_cdf_lanes(hi, n - 8, val, n, rate));
+        _mm_storeu_si128((__m128i *)cdf, dec_update_cdf_lanes(lo, 0, val, n, rate));
+        cdf[nsymbs] += (cdf[nsymbs] < 32);
+        return;
+    }
+    if (n >= 6) {
+        const __m128i v = _mm_loadu_si128((const __m128i *)cdf);
+        _mm_storeu_si128((__m128i *)cdf, dec_update_cdf_lanes(v, 0, val, n, rate));
+        cdf[nsymbs] += (cdf[nsymbs] < 32);
+        return;
+    }
+    if (n >= 4) {
+        const __m128i lo = _mm_loadl_epi64((const __m128i *)cdf);
+        const __m128i hi = _mm_loadl_epi64((const __m128i *)(cdf + n - 4));
+        _mm_storel_epi64((__m128i *)(cdf + n - 4), dec_update_cdf_lanes(hi, n - 4, val, n, rate));
+        _mm_storel_epi64((__m128i *)cdf, dec_update_cdf_lanes(lo, 0, val, n, rate));
+        cdf[nsymbs] += (cdf[nsymbs] < 32);
+        return;
+    }
+    if (n >= 2) {
+        const __m128i v = _mm_loadl_epi64((const __m128i *)cdf);
+        _mm_storel_epi64((__m128i *)cdf, dec_update_cdf_lanes(v, 0, val, n, rate));
+        cdf[nsymbs] += (cdf[nsymbs] < 32);
+        return;
+    }
+#endif
     tmp  = AOM_ICDF(0);
 
     // Single loop (faster)
@@ -114,12 +170,12 @@ typedef struct OdEcDec {
 
     /*The difference between the high end of the current range, (low + rng), and
     the coded value, minus 1.
-    This stores up to OD_EC_WINDOW_SIZE bits of that difference, but the
+    This stores up to DEC_EC_WINDOW_SIZE bits of that difference, but the
     decoder only uses the top 16 bits of the window to decode the next symbol.
     As we shift up during renormalization, if we don't have enough bits left in
     the window to fill the top 16, we'll read in more bits of the coded
     value.*/
-    OdEcWindow dif;
+    DecEcWindow dif;
     /*The number of values in the current range.*/
     uint16_t rng;
     /*The number of bits of data in the current value.*/
@@ -136,7 +192,7 @@ static void od_ec_dec_refill(OdEcDec *dec);
   ret: The value to return.
   Return: ret.
           This allows the compiler to jump to this function via a tail-call.*/
-static int od_ec_dec_normalize(OdEcDec *dec, OdEcWindow dif, unsigned rng, int ret) {
+static int od_ec_dec_normalize(OdEcDec *dec, DecEcWindow dif, unsigned rng, int ret) {
     int d;
     assert(rng <= 65535U);
     /*The number of leading zeros in the 16-bit binary representation of rng.*/
@@ -155,8 +211,8 @@ static int od_ec_dec_normalize(OdEcDec *dec, OdEcWindow dif, unsigned rng, int r
   f: The probability that the bit is one, scaled by 32768.
   Return: The value decoded (0 or 1).*/
 static int od_ec_decode_bool_q15(OdEcDec *dec, unsigned f) {
-    OdEcWindow dif;
-    OdEcWindow vw;
+    DecEcWindow dif;
+    DecEcWindow vw;
     unsigned   r;
     unsigned   r_new;
     unsigned   v;
@@ -165,11 +221,11 @@ static int od_ec_decode_bool_q15(OdEcDec *dec, unsigned f) {
     assert(f < 32768U);
     dif = dec->dif;
     r   = dec->rng;
-    assert(dif >> (OD_EC_WINDOW_SIZE - 16) < r);
+    assert(dif >> (DEC_EC_WINDOW_SIZE - 16) < r);
     assert(32768U <= r);
     v = ((r >> 8) * (uint32_t)(f >> EC_PROB_SHIFT) >> (7 - EC_PROB_SHIFT));
     v += EC_MIN_PROB;
-    vw    = (OdEcWindow)v << (OD_EC_WINDOW_SIZE - 16);
+    vw    = (DecEcWindow)v << (DEC_EC_WINDOW_SIZE - 16);
     ret   = 1;
     r_new = v;
     if (dif >= vw) {
@@ -180,6 +236,39 @@ static int od_ec_decode_bool_q15(OdEcDec *dec, unsigned f) {
     return od_ec_dec_normalize(dec, dif, r_new, ret);
 }
 
+#ifdef ARCH_X86_64
+/*Number of entries icdf[i], lo <= i < hi, of the 8 (or 4) loaded from
+   icdf[offset], whose scaled range v[i] is above the coded value c. Since v[]
+   is decreasing, these entries are consecutive. n is the alphabet size - 1.*/
+static INLINE int od_ec_cdf_count_lanes(__m128i icdf, int offset, int lo, int hi, int n,
+                                        unsigned a, unsigned c) {
+    const __m128i zero   = _mm_setzero_si128();
+    const __m128i prob   = _mm_srli_epi16(icdf, EC_PROB_SHIFT);
+    const __m128i a_v    = _mm_set1_epi32((int32_t)a);
+    const __m128i c_v    = _mm_set1_epi32((int32_t)c);
+    const __m128i idx_lo = _mm_add_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(offset));
+    const __m128i idx_hi = _mm_add_epi32(idx_lo, _mm_set1_epi32(4));
+    const __m128i min_lo = _mm_set1_epi32(EC_MIN_PROB * n);
+    /*v = (a * prob >> 1) + EC_MIN_PROB * (n - idx), the products need 17 bits*/
+    __m128i v_lo = _mm_srli_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(prob, zero), a_v),
+                                  7 - EC_PROB_SHIFT - CDF_SHIFT);
+    __m128i v_hi = _mm_srli_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(prob, zero), a_v),
+                                  7 - EC_PROB_SHIFT - CDF_SHIFT);
+    v_lo = _mm_add_epi32(v_lo, _mm_sub_epi32(min_lo, _mm_slli_epi32(idx_lo, 2)));
+    v_hi = _mm_add_epi32(v_hi, _mm_sub_epi32(min_lo, _mm_slli_epi32(idx_hi, 2)));
+    __m128i above_lo = _mm_and_si128(_mm_cmpgt_epi32(v_lo, c_v),
+                                     _mm_cmplt_epi32(idx_lo, _mm_set1_epi32(hi)));
+    __m128i above_hi = _mm_and_si128(_mm_cmpgt_epi32(v_hi, c_v),
+                                     _mm_cmplt_epi32(idx_hi, _mm_set1_epi32(hi)));
+    above_lo = _mm_and_si128(above_lo, _mm_cmpgt_epi32(idx_lo, _mm_set1_epi32(lo - 1)));
+    above_hi = _mm_and_si128(above_hi, _mm_cmpgt_epi32(idx_hi, _mm_set1_epi32(lo - 1)));
+    /*Two mask bits per entry, shifted so that the first counted entry is bit 0*/
+    const unsigned mask = (unsigned)_mm_movemask_epi8(_mm_packs_epi32(above_lo, above_hi)) >>
+        (2 * (lo > offset ? lo - offset : 0));
+    return get_msb(mask + 1) >> 1;
+}
+#endif
+
 /*Decodes a symbol given an inverse cumulative distribution function (CDF)
    table in Q15.
   icdf: CDF_PROB_TOP minus the CDF, such that symbol s falls in the range
@@ -190,34 +279,65 @@ static int od_ec_decode_bool_q15(OdEcDec *dec, unsigned f) {
          This should be at most 16.
   Return: The decoded symbol s.*/
 static int od_ec_decode_cdf_q15(OdEcDec *dec, const uint16_t *icdf, int nsyms) {
-    OdEcWindow dif;
-    unsigned   r;
-    unsigned   c;
-    unsigned   u;
-    unsigned   v;
-    int        ret;
+    DecEcWindow dif;
+    unsigned    r;
+    unsigned    c;
+    unsigned    u;
+    unsigned    v;
+    int         ret;
     (void)nsyms;
     dif         = dec->dif;
     r           = dec->rng;
     const int N = nsyms - 1;
 
-    assert(dif >> (OD_EC_WINDOW_SIZE - 16) < r);
+    assert(dif >> (DEC_EC_WINDOW_SIZE - 16) < r);
     assert(icdf[nsyms - 1] == OD_ICDF(CDF_PROB_TOP));
     assert(32768U <= r);
     assert(7 - EC_PROB_SHIFT - CDF_SHIFT >= 0);
-    c   = (unsigned)(dif >> (OD_EC_WINDOW_SIZE - 16));
-    v   = r;
-    ret = -1;
-    do {
-        u = v;
-        v = ((r >> 8) * (uint32_t)(icdf[++ret] >> EC_PROB_SHIFT) >>
-             (7 - EC_PROB_SHIFT - CDF_SHIFT));
-        v += EC_MIN_PROB * (N - ret);
-    } while (c < v);
+    c = (unsigned)(dif >> (DEC_EC_WINDOW_SIZE - 16));
+#ifdef ARCH_X86_64
+    if (N >= 2) {
+        /*All the candidate ranges are compared at once instead of walking the
+       CDF. The table holds N + 2 entries (last CDF entry and counter), so
+       vector loads never go past it : see dec_update_cdf().*/
+        const unsigned a = r >> 8;
+        if (N >= 8) {
+            ret = od_ec_cdf_count_lanes(_mm_loadu_si128((const __m128i *)icdf), 0, 0, 8, N, a, c);
+            if (ret == 8)
+                ret += od_ec_cdf_count_lanes(
+                    _mm_loadu_si128((const __m128i *)(icdf + N - 8)), N - 8, 8, N, N, a, c);
+        } else if (N >= 6)
+            ret = od_ec_cdf_count_lanes(_mm_loadu_si128((const __m128i *)icdf), 0, 0, N, N, a, c);
+        else if (N >= 4) {
+            ret = od_ec_cdf_count_lanes(_mm_loadl_epi64((const __m128i *)icdf), 0, 0, 4, N, a, c);
+            if (ret == 4)
+                ret += od_ec_cdf_count_lanes(
+                    _mm_loadl_epi64((const __m128i *)(icdf + N - 4)), N - 4, 4, N, N, a, c);
+        } else
+            ret = od_ec_cdf_count_lanes(_mm_loadl_epi64((const __m128i *)icdf), 0, 0, N, N, a, c);
+        v = (a * (uint32_t)(icdf[ret] >> EC_PROB_SHIFT) >> (7 - EC_PROB_SHIFT - CDF_SHIFT)) +
+            EC_MIN_PROB * (N - ret);
+        u = ret ? (a * (uint32_t)(icdf[ret - 1] >> EC_PROB_SHIFT) >>
+                   (7 - EC_PROB_SHIFT - CDF_SHIFT)) +
+                EC_MIN_PROB * (N - ret + 1)
+                : r;
+    } else
+#endif
+    {
+        v   = r;
+        ret = -1;
+        do {
+            u = v;
+            v = ((r >> 8) * (uint32_t)(icdf[++ret] >> EC_PROB_SHIFT) >>
+                 (7 - EC_PROB_SHIFT - CDF_SHIFT));
+            v += EC_MIN_PROB * (N - ret);
+        } while (c < v);
+    }
+    assert(c >= v);
     assert(v < u);
     assert(u <= r);
     r = u - v;
-    dif -= (OdEcWindow)v << (OD_EC_WINDOW_SIZE - 16);
+    dif -= (DecEcWindow)v << (DEC_EC_WINDOW_SIZE - 16);
     return od_ec_dec_normalize(dec, dif, r, ret);
 }
 
@@ -236,7 +356,7 @@ static int od_ec_decode_cdf_q15(OdEcDec *dec, const uint16_t *icdf, int nsyms) {
    call.*/
 static void od_ec_dec_refill(OdEcDec *dec) {
     int                  s;
-    OdEcWindow           dif;
+    DecEcWindow           dif;
     int16_t              cnt;
     const unsigned char *bptr;
     const unsigned char *end;
@@ -244,13 +364,24 @@ static void od_ec_dec_refill(OdEcDec *dec) {
     cnt  = dec->cnt;
     bptr = dec->bptr;
     end  = dec->end;
-    s    = OD_EC_WINDOW_SIZE - 9 - (cnt + 15);
+    s    = DEC_EC_WINDOW_SIZE - 9 - (cnt + 15);
+    if (s >= 0 && end - bptr >= (int)sizeof(DecEcWindow)) {
+        /*Away from the end of the buffer, all the bytes that fit are inserted
+       with a single big-endian word load instead of one byte at a time.*/
+        const int   n    = (s >> 3) + 1;
+        DecEcWindow word = 0;
+        for (int i = 0; i < (int)sizeof(DecEcWindow); i++) word = (word << 8) | bptr[i];
+        dif ^= (word >> (DEC_EC_WINDOW_SIZE - 8 * n)) << (s & 7);
+        bptr += n;
+        cnt += 8 * n;
+        s -= 8 * n;
+    }
     for (; s >= 0 && bptr < end; s -= 8, bptr++) {
         /*Each time a byte is inserted into the window (dif), bptr advances and cnt
        is incremented by 8, so the total number of consumed bits (the return
        value of od_ec_dec_tell) does not change.*/
-        assert(s <= OD_EC_WINDOW_SIZE - 8);
-        dif ^= (OdEcWindow)bptr[0] << s;
+        assert(s <= DEC_EC_WINDOW_SIZE - 8);
+        dif ^= (DecEcWindow)bptr[0] << s;
         cnt += 8;
     }
     if (bptr >= end) {
@@ -278,10 +409,10 @@ static void od_ec_dec_refill(OdEcDec *dec) {
   storage: The size in bytes of the input buffer.*/
 static void od_ec_dec_init(OdEcDec *dec, const unsigned char *buf, uint32_t storage) {
     dec->buf       = buf;
-    dec->tell_offs = 10 - (OD_EC_WINDOW_SIZE - 8);
+    dec->tell_offs = 10 - (DEC_EC_WINDOW_SIZE - 8);
     dec->end       = buf + storage;
     dec->bptr      = buf;
-    dec->dif       = ((OdEcWindow)1 << (OD_EC_WINDOW_SIZE - 1)) - 1;
+    dec->dif       = ((DecEcWindow)1 << (DEC_EC_WINDOW_SIZE - 1)) - 1;
     dec->rng       = 0x8000;
     dec->cnt       = -15;
     od_ec_dec_refill(dec);
@@ -25,6 +25,7 @@
 #include "EbDecHandle.h"
 #include "EbDecMemInit.h"
 #include "EbDecPicMgr.h"
+#include "EbDecAsync.h"
 #include "grainSynthesis.h"
 #include "EbUtility.h"
 
@@ -102,6 +103,7 @@ static EbErrorType svt_dec_handle_ctor(EbDecHandle    **decHandleDblPtr,
     dec_handle_ptr->total_lib_memory = sizeof(EbComponentType) + sizeof(EbDecHandle) +
         sizeof(EbMemoryMapEntry);
     dec_handle_ptr->memory_map_init_address = dec_handle_ptr->memory_map;
+    memset(dec_handle_ptr->mem_usage, 0, sizeof(dec_handle_ptr->mem_usage));
     // Save Memory Map Pointers
     svt_dec_total_lib_memory = &dec_handle_ptr->total_lib_memory;
     svt_dec_memory_map       = dec_handle_ptr->memory_map;
@@ -109,6 +111,7 @@ static EbErrorType svt_dec_handle_ctor(EbDecHandle    **decHandleDblPtr,
     svt_dec_lib_malloc_count = 0;
 
     dec_handle_ptr->start_thread_process = EB_FALSE;
+    dec_handle_ptr->pv_async_ctxt        = NULL;
     memory_map_start_address             = NULL;
     memory_map_end_address               = NULL;
 
@@ -132,6 +135,37 @@ static void copy_even(uint8_t *luma, uint32_t wd, uint32_t ht, uint32_t stride,
                    sizeof(*luma) * (wd << use_hbd));
     }
 }
+/* Box filter downscaling of one plane by (1 << shift), used for reduced
+   size output. Strides are in samples. */
+static void downscale_plane(const void *src, uint32_t src_stride, int32_t src_hbd, void *dst,
+                            uint32_t dst_stride, int32_t dst_hbd, uint32_t wd, uint32_t ht,
+                            uint32_t shift) {
+    const uint32_t step   = 1 << shift;
+    const uint32_t out_wd = (wd + step - 1) >> shift;
+    const uint32_t out_ht = (ht + step - 1) >> shift;
+
+    for (uint32_t i = 0; i < out_ht; i++) {
+        const uint32_t y0 = i << shift;
+        const uint32_t y1 = AOMMIN(y0 + step, ht);
+        for (uint32_t j = 0; j < out_wd; j++) {
+            const uint32_t x0  = j << shift;
+            const uint32_t x1  = AOMMIN(x0 + step, wd);
+            uint32_t       sum = 0;
+            for (uint32_t y = y0; y < y1; y++) {
+                for (uint32_t x = x0; x < x1; x++)
+                    sum += src_hbd ? ((const uint16_t *)src)[y * src_stride + x]
+                                   : ((const uint8_t *)src)[y * src_stride + x];
+            }
+            const uint32_t cnt = (y1 - y0) * (x1 - x0);
+            const uint32_t avg = (sum + (cnt >> 1)) / cnt;
+            if (dst_hbd)
+                ((uint16_t *)dst)[i * dst_stride + j] = (uint16_t)avg;
+            else
+                ((uint8_t *)dst)[i * dst_stride + j] = (uint8_t)avg;
+        }
+    }
+}
+
 /* Copy from recon buffer to out buffer! */
 int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
     EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf;
@@ -146,9 +180,14 @@ int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
         assert(0 == dec_handle_ptr->show_existing_frame);
         return 0;
     }
+    if (dec_handle_ptr->skip_frame_output || dec_handle_ptr->dec_config.parse_only)
+        return 0;
 
-    uint32_t wd = dec_handle_ptr->frame_header.frame_size.superres_upscaled_width;
-    uint32_t ht = dec_handle_ptr->frame_header.frame_size.frame_height;
+    uint32_t shift  = dec_handle_ptr->dec_config.output_downscale;
+    uint32_t src_wd = dec_handle_ptr->frame_header.frame_size.superres_upscaled_width;
+    uint32_t src_ht = dec_handle_ptr->frame_header.frame_size.frame_height;
+    uint32_t wd     = (src_wd + (1 << shift) - 1) >> shift;
+    uint32_t ht     = (src_ht + (1 << shift) - 1) >> shift;
     int      sx = 0, sy = 0;
     /* FilmGrain module req. even dim. for internal operation */
     int even_w = (wd & 1) ? (wd + 1) : wd;
@@ -244,6 +283,48 @@ int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
              << use_high_bit_depth);
     }
 
+    if (shift) {
+        int32_t src_hbd = use_high_bit_depth || dec_handle_ptr->is_16bit_pipeline;
+        downscale_plane(recon_picture_buf->buffer_y +
+                            ((recon_picture_buf->origin_x +
+                              recon_picture_buf->origin_y * recon_picture_buf->stride_y)
+                             << src_hbd),
+                        recon_picture_buf->stride_y,
+                        src_hbd,
+                        luma,
+                        out_img->y_stride,
+                        use_high_bit_depth,
+                        src_wd,
+                        src_ht,
+                        shift);
+        if (recon_picture_buf->color_format != EB_YUV400) {
+            const uint32_t cb_offset = (recon_picture_buf->origin_x >> sx) +
+                ((recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cb);
+            const uint32_t cr_offset = (recon_picture_buf->origin_x >> sx) +
+                ((recon_picture_buf->origin_y >> sy) * recon_picture_buf->stride_cr);
+            downscale_plane(recon_picture_buf->buffer_cb + (cb_offset << src_hbd),
+                            recon_picture_buf->stride_cb,
+                            src_hbd,
+                            cb,
+                            out_img->cb_stride,
+                            use_high_bit_depth,
+                            (src_wd + sx) >> sx,
+                            (src_ht + sy) >> sy,
+                            shift);
+            downscale_plane(recon_picture_buf->buffer_cr + (cr_offset << src_hbd),
+                            recon_picture_buf->stride_cr,
+                            src_hbd,
+                            cr,
+                            out_img->cr_stride,
+                            use_high_bit_depth,
+                            (src_wd + sx) >> sx,
+                            (src_ht + sy) >> sy,
+                            shift);
+        }
+        /* Film grain is meant for the full resolution picture */
+        return 1;
+    }
+
     /* Memcpy to dst buffer */
     {
         if (recon_picture_buf->bit_depth == EB_8BIT) {
@@ -429,6 +510,16 @@ EbErrorType svt_svt_dec_set_default_parameter(EbSvtAv1DecConfiguration *config_p
     config_ptr->threads      = 1;
     config_ptr->num_p_frames = 1;
 
+    /* Asynchronous API */
+    config_ptr->async_queue_size = 0;
+    config_ptr->picture_ready_cb = NULL;
+
+    /* Fast decode modes */
+    config_ptr->keyframes_only       = EB_FALSE;
+    config_ptr->skip_non_ref_filters = EB_FALSE;
+    config_ptr->output_downscale     = 0;
+    config_ptr->parse_only           = EB_FALSE;
+
     return return_error;
 }
 
@@ -510,8 +601,14 @@ EB_API EbErrorType svt_av1_dec_set_parameter(EbComponentType          *svt_dec_c
 
     EbDecHandle *dec_handle_ptr = (EbDecHandle *)svt_dec_component->p_component_private;
 
+    if (config_struct->output_downscale > MAX_OUTPUT_DOWNSCALE)
+        return EB_ErrorBadParameter;
+
     dec_handle_ptr->dec_config        = *config_struct;
     dec_handle_ptr->is_16bit_pipeline = config_struct->is_16bit_pipeline;
+    /* Parse only mode runs the single-threaded parse loop without recon */
+    if (config_struct->parse_only)
+        dec_handle_ptr->dec_config.threads = 1;
 
     return EB_ErrorNone;
 }
@@ -533,6 +630,7 @@ EB_API EbErrorType svt_av1_dec_init(EbComponentType *svt_dec_component) {
         dec_handle_ptr->num_frms_prll = DEC_MAX_NUM_FRM_PRLL;
     dec_handle_ptr->seq_header_done = 0;
     dec_handle_ptr->mem_init_done   = 0;
+    dec_handle_ptr->shown_frame_cnt = 0;
 
     dec_handle_ptr->seen_frame_header   = 0;
     dec_handle_ptr->show_existing_frame = 0;
@@ -559,18 +657,22 @@ EB_API EbErrorType svt_av1_dec_init(EbComponentType *svt_dec_component) {
     if (return_error != EB_ErrorNone)
         return return_error;
 
+    /************************************
+    * Asynchronous Decode Thread
+    ************************************/
+    if (dec_handle_ptr->dec_config.async_queue_size)
+        return_error = dec_async_init(dec_handle_ptr, svt_dec_component);
+
     return return_error;
 }
 
-EB_API EbErrorType svt_av1_dec_frame(EbComponentType *svt_dec_component, const uint8_t *data,
-                                     const size_t data_size, uint32_t is_annexb) {
-    EbErrorType return_error = EB_ErrorNone;
-    if (svt_dec_component == NULL)
-        return EB_ErrorBadParameter;
-
-    EbDecHandle *dec_handle_ptr       = (EbDecHandle *)svt_dec_component->p_component_private;
-    uint8_t     *data_start           = (uint8_t *)data;
-    uint8_t     *data_end             = (uint8_t *)data + data_size;
+/* Decodes all the OBUs of one temporal unit. Shared by the synchronous
+   API and the asynchronous decode thread. */
+EbErrorType decode_temporal_unit(EbDecHandle *dec_handle_ptr, const uint8_t *data,
+                                 const size_t data_size, uint32_t is_annexb) {
+    EbErrorType return_error          = EB_ErrorNone;
+    uint8_t    *data_start            = (uint8_t *)data;
+    uint8_t    *data_end              = (uint8_t *)data + data_size;
     dec_handle_ptr->seen_frame_header = 0;
 
     while (data_start < data_end) {
@@ -607,6 +709,17 @@ EB_API EbErrorType svt_av1_dec_frame(EbComponentType *svt_dec_component, const u
     return return_error;
 }
 
+EB_API EbErrorType svt_av1_dec_frame(EbComponentType *svt_dec_component, const uint8_t *data,
+                                     const size_t data_size, uint32_t is_annexb) {
+    if (svt_dec_component == NULL)
+        return EB_ErrorBadParameter;
+
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)svt_dec_component->p_component_private;
+    if (dec_handle_ptr->pv_async_ctxt)
+        return EB_ErrorBadParameter;
+    return decode_temporal_unit(dec_handle_ptr, data, data_size, is_annexb);
+}
+
 EB_API EbErrorType svt_av1_dec_get_picture(EbComponentType    *svt_dec_component,
                                            EbBufferHeaderType *p_buffer,
                                            EbAV1StreamInfo    *stream_info,
@@ -619,12 +732,39 @@ EB_API EbErrorType svt_av1_dec_get_picture(EbComponentType    *svt_dec_component
         return EB_ErrorBadParameter;
 
     EbDecHandle *dec_handle_ptr = (EbDecHandle *)svt_dec_component->p_component_private;
+    if (dec_handle_ptr->pv_async_ctxt)
+        return EB_ErrorBadParameter;
     /* Copy from recon pointer and return! TODO: Should remove the svt_memcpy! */
     if (0 == svt_dec_out_buf(dec_handle_ptr, p_buffer))
         return_error = EB_DecNoOutputPicture;
     return return_error;
 }
 
+EB_API EbErrorType svt_av1_dec_send_data(EbComponentType *svt_dec_component, const uint8_t *data,
+                                         const size_t data_size, uint32_t is_annexb) {
+    if (svt_dec_component == NULL)
+        return EB_ErrorBadParameter;
+
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)svt_dec_component->p_component_private;
+    if (dec_handle_ptr->pv_async_ctxt == NULL)
+        return EB_ErrorBadParameter;
+    return dec_async_send_data(dec_handle_ptr, data, data_size, is_annexb);
+}
+
+EB_API EbErrorType svt_av1_dec_receive_picture(EbComponentType    *svt_dec_component,
+                                               EbBufferHeaderType *p_buffer,
+                                               EbAV1StreamInfo    *stream_info,
+                                               EbAV1FrameInfo     *frame_info,
+                                               uint8_t             wait) {
+    if (svt_dec_component == NULL || p_buffer == NULL || p_buffer->p_buffer == NULL)
+        return EB_ErrorBadParameter;
+
+    EbDecHandle *dec_handle_ptr = (EbDecHandle *)svt_dec_component->p_component_private;
+    if (dec_handle_ptr->pv_async_ctxt == NULL)
+        return EB_ErrorBadParameter;
+    return dec_async_receive_picture(dec_handle_ptr, p_buffer, stream_info, frame_info, wait);
+}
+
 EB_API EbErrorType svt_av1_dec_deinit(EbComponentType *svt_dec_component) {
     if (svt_dec_component == NULL)
         return EB_ErrorBadParameter;
@@ -633,10 +773,14 @@ EB_API EbErrorType svt_av1_dec_deinit(EbComponentType *svt_dec_component) {
 
     if (!dec_handle_ptr)
         return EB_ErrorNone;
+    /* Stop the asynchronous decode thread before the decoder threads */
+    dec_async_deinit(dec_handle_ptr);
     if (dec_handle_ptr->dec_config.threads > 1)
         dec_sync_all_threads(dec_handle_ptr);
     if (!svt_dec_memory_map)
         return EB_ErrorNone;
+    if (dec_handle_ptr->dec_config.stat_report && dec_handle_ptr->mem_init_done)
+        dec_mem_report(dec_handle_ptr);
 
     // Loop through the ptr table and free all malloc'd pointers per channel
     EbMemoryMapEntry *memory_entry = svt_dec_memory_map;
@@ -34,6 +34,9 @@ extern "C" {
 /** Maximum picture buffers needed **/
 #define MAX_PIC_BUFS (REF_FRAMES + 1 + DEC_MAX_NUM_FRM_PRLL)
 
+/** Maximum output downscaling shift **/
+#define MAX_OUTPUT_DOWNSCALE 3
+
 /** Picture Structure **/
 typedef struct EbDecPicBuf {
     uint8_t is_free;
@@ -147,6 +150,19 @@ typedef struct MainFrameBuf {
 
 } MainFrameBuf;
 
+/* Decoder modules tracked by the per instance memory report */
+typedef enum DecMemModule {
+    DEC_MEM_PIC_MGR,
+    DEC_MEM_PARSE,
+    DEC_MEM_RECON,
+    DEC_MEM_LF,
+    DEC_MEM_LR,
+    DEC_MEM_FRAME_BUFS,
+    DEC_MEM_PIC_BUFS,
+    DEC_MEM_MT,
+    DEC_MEM_MODULES
+} DecMemModule;
+
 /**************************************
  * Component Private Data
  **************************************/
@@ -234,6 +250,8 @@ typedef struct EbDecHandle {
     EbMemoryMapEntry *memory_map;
     uint32_t          memory_map_index;
     uint64_t          total_lib_memory;
+    /* Bytes allocated by each decoder module, see DecMemModule */
+    uint64_t mem_usage[DEC_MEM_MODULES];
     struct Av1Common  cm;
 
     // Loop filter frame level flag
@@ -245,6 +263,17 @@ typedef struct EbDecHandle {
     EbHandle              thread_semaphore;
     struct DecThreadCtxt *thread_ctxt_pa;
 
+    /* Asynchronous API context, NULL when async_queue_size is 0 */
+    void *pv_async_ctxt;
+
+    /* Shown frames in display order, checked against skip_frames
+       and frames_to_be_decoded */
+    uint64_t shown_frame_cnt;
+    /* Current frame is not reconstructed */
+    EbBool skip_frame_decode;
+    /* Current frame is reconstructed but not output */
+    EbBool skip_frame_output;
+
     EbBool
         is_16bit_pipeline; // internal bit-depth: when equals 1 internal bit-depth is 16bits regardless of the input bit-depth
 } EbDecHandle;
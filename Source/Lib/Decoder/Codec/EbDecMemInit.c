@@ -35,6 +35,7 @@
 #include "EbDecLF.h"
 
 #include "EbUtility.h"
+#include "EbLog.h"
 
 /*TODO: Remove and harmonize with encoder. Globals prevent harmonization now! */
 /*****************************************
@@ -451,7 +452,7 @@ static EbErrorType init_lr_ctxt(EbDecHandle  *dec_handle_ptr)
     EB_MALLOC_DEC(RestorationLineBuffers ***, lr_ctxt->rlbs,
         num_instances * sizeof(RestorationLineBuffers**), EB_N_PTR);
     EB_MALLOC_DEC(int32_t **, lr_ctxt->rst_tmpbuf,
-         num_instances * RESTORATION_TMPBUF_SIZE, EB_N_PTR);
+         num_instances * sizeof(int32_t *), EB_N_PTR);
     for (uint32_t i = 0; i < num_instances; i++) {
         RestorationLineBuffers **p_rlbs;
         EB_MALLOC_DEC(RestorationLineBuffers**, lr_ctxt->rlbs[i],
@@ -498,26 +499,44 @@ static EbErrorType init_lr_ctxt(EbDecHandle  *dec_handle_ptr)
     return return_error;
 }
 
+/* Charges the library memory allocated since *mark to the given module */
+static INLINE void dec_mem_track(EbDecHandle *dec_handle_ptr, DecMemModule module,
+                                 uint64_t *mark)
+{
+    dec_handle_ptr->mem_usage[module] += *svt_dec_total_lib_memory - *mark;
+    *mark = *svt_dec_total_lib_memory;
+}
+
 EbErrorType dec_mem_init(EbDecHandle  *dec_handle_ptr) {
     EbErrorType return_error = EB_ErrorNone;
 
+    /* All the buffers are sized from the sequence header,
+       so nothing is allocated before it is parsed */
     if (0 == dec_handle_ptr->seq_header_done)
         return EB_ErrorNone;
 
+    uint64_t mem_mark = *svt_dec_total_lib_memory;
+
     /* init module ctxts */
     return_error |= dec_pic_mgr_init(dec_handle_ptr);
+    dec_mem_track(dec_handle_ptr, DEC_MEM_PIC_MGR, &mem_mark);
 
     return_error |= init_parse_context(dec_handle_ptr);
+    dec_mem_track(dec_handle_ptr, DEC_MEM_PARSE, &mem_mark);
 
     return_error |= init_dec_mod_ctxt(dec_handle_ptr,
                     &dec_handle_ptr->pv_dec_mod_ctxt);
+    dec_mem_track(dec_handle_ptr, DEC_MEM_RECON, &mem_mark);
 
     return_error |= init_lf_ctxt(dec_handle_ptr);
+    dec_mem_track(dec_handle_ptr, DEC_MEM_LF, &mem_mark);
 
     return_error |= init_lr_ctxt(dec_handle_ptr);
+    dec_mem_track(dec_handle_ptr, DEC_MEM_LR, &mem_mark);
 
     /* init frame buffers */
     return_error |= init_main_frame_ctxt(dec_handle_ptr);
+    dec_mem_track(dec_handle_ptr, DEC_MEM_FRAME_BUFS, &mem_mark);
 
     /* Initialize the references to NULL */
     for (int i = 0; i < REF_FRAMES; i++) {
@@ -531,4 +550,21 @@ EbErrorType dec_mem_init(EbDecHandle  *dec_handle_ptr) {
 
     return return_error;
 }
+
+void dec_mem_report(EbDecHandle *dec_handle_ptr) {
+    static const char *const module_names[DEC_MEM_MODULES] = {
+        "Picture manager", "Parse context", "Recon context", "Loop filter",
+        "Loop restoration", "Frame buffers", "Picture buffers", "Multi-thread"};
+    EbDecPicMgr *ps_pic_mgr = (EbDecPicMgr *)dec_handle_ptr->pv_pic_mgr;
+
+    SVT_LOG("SVT [memory] : %dx%d sequence, %u picture buffers\n",
+            dec_handle_ptr->seq_header.max_frame_width,
+            dec_handle_ptr->seq_header.max_frame_height,
+            ps_pic_mgr ? ps_pic_mgr->num_pic_bufs : 0);
+    for (int i = 0; i < DEC_MEM_MODULES; i++)
+        SVT_LOG("SVT [memory] : %-18s %10.3f MB\n", module_names[i],
+                (double)dec_handle_ptr->mem_usage[i] / (1 << 20));
+    SVT_LOG("SVT [memory] : %-18s %10.3f MB\n", "Total",
+            (double)*svt_dec_total_lib_memory / (1 << 20));
+}
 // clang-format on
@@ -98,6 +98,9 @@ EbErrorType dec_eb_recon_picture_buffer_desc_ctor(EbPtr *object_dbl_ptr, EbPtr o
 
 EbErrorType dec_mem_init(EbDecHandle *dec_handle_ptr);
 
+/* Logs the memory allocated by each decoder module of this instance */
+void dec_mem_report(EbDecHandle *dec_handle_ptr);
+
 EbErrorType init_dec_mod_ctxt(EbDecHandle *dec_handle_ptr, void **dec_mod_ctxt);
 
 #ifdef __cplusplus
@@ -272,7 +272,16 @@ EbErrorType parse_tile(EbDecHandle *dec_handle_ptr, ParseCtxt *parse_ctx, TilesI
             // Bit-stream parsing of the superblock
             parse_super_block(dec_handle_ptr, parse_ctx, mi_row, mi_col, sb_info);
 
-            if (!is_mt) {
+            if (is_mt) {
+                /* Publish SB level parse progress so that recon of this
+                   SB row can start without waiting for the full row */
+                DecMtFrameData *dec_mt_frame_data =
+                    &dec_handle_ptr->main_frame_buf.cur_frame_bufs[0]
+                         .dec_mt_frame_data; //multi frame Parallel 0 -> idx
+                assert(sb_row >= sb_row_tile_start);
+                dec_mt_frame_data->parse_recon_tile_info_array[tile_num]
+                    .sb_recon_row_parsed[sb_row - sb_row_tile_start] = (uint32_t)(sb_col + 1);
+            } else if (!dec_handle_ptr->dec_config.parse_only) {
                 /* Init DecModCtxt */
                 DecModCtxt *dec_mod_ctxt = (DecModCtxt *)dec_handle_ptr->pv_dec_mod_ctxt;
                 dec_mod_ctxt->cur_coeff[AOM_PLANE_Y] = sb_info->sb_coeff[AOM_PLANE_Y];
@@ -286,14 +295,6 @@ EbErrorType parse_tile(EbDecHandle *dec_handle_ptr, ParseCtxt *parse_ctx, TilesI
                 decode_super_block(dec_mod_ctxt, mi_row, mi_col, sb_info);
             }
         }
-        if (is_mt) {
-            DecMtFrameData *dec_mt_frame_data =
-                &dec_handle_ptr->main_frame_buf.cur_frame_bufs[0]
-                     .dec_mt_frame_data; //multi frame Parallel 0 -> idx
-            assert(sb_row >= sb_row_tile_start);
-            dec_mt_frame_data->parse_recon_tile_info_array[tile_num]
-                .sb_recon_row_parsed[sb_row - sb_row_tile_start] = 1;
-        }
     }
 
     return status;
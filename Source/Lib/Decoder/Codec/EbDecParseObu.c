@@ -1732,6 +1732,31 @@ static void check_mt_support(EbDecHandle *dec_handle_ptr) {
     }
 }
 
+/* Fast decode modes : frames that do not contribute to the requested
+   output are not reconstructed */
+static void set_frame_skip_flags(EbDecHandle *dec_handle_ptr) {
+    EbSvtAv1DecConfiguration *config     = &dec_handle_ptr->dec_config;
+    FrameHeader              *frame_info = &dec_handle_ptr->frame_header;
+    EbBool                    out_of_range = EB_FALSE;
+
+    if (frame_info->show_frame) {
+        uint64_t frame_idx = dec_handle_ptr->shown_frame_cnt++;
+        out_of_range       = frame_idx < config->skip_frames ||
+            (config->frames_to_be_decoded &&
+             frame_idx >= config->skip_frames + config->frames_to_be_decoded);
+    }
+
+    if (config->keyframes_only) {
+        dec_handle_ptr->skip_frame_decode = frame_info->frame_type != KEY_FRAME;
+        dec_handle_ptr->skip_frame_output = out_of_range || dec_handle_ptr->skip_frame_decode;
+    } else {
+        /* Frames not used as reference are only needed for their own output */
+        dec_handle_ptr->skip_frame_decode = frame_info->refresh_frame_flags == 0 &&
+            (!frame_info->show_frame || out_of_range);
+        dec_handle_ptr->skip_frame_output = out_of_range;
+    }
+}
+
 void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeader *obu_header,
                               int num_planes) {
     SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
@@ -1789,6 +1814,7 @@ void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeade
             dec_handle_ptr->show_existing_frame = frame_info->show_existing_frame;
             dec_handle_ptr->show_frame          = frame_info->show_frame;
             dec_handle_ptr->showable_frame      = frame_info->showable_frame;
+            set_frame_skip_flags(dec_handle_ptr);
             return;
         }
 
@@ -2163,10 +2189,11 @@ void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeade
     dec_handle_ptr->show_existing_frame = frame_info->show_existing_frame;
     dec_handle_ptr->show_frame          = frame_info->show_frame;
     dec_handle_ptr->showable_frame      = frame_info->showable_frame;
+    set_frame_skip_flags(dec_handle_ptr);
 
     /* TODO: Should be moved to caller */
     if (dec_handle_ptr->dec_config.threads == 1) {
-        if (!frame_info->show_existing_frame)
+        if (!frame_info->show_existing_frame && !dec_handle_ptr->skip_frame_decode)
             svt_setup_motion_field(dec_handle_ptr, NULL);
     }
 }
@@ -2257,6 +2284,10 @@ EbErrorType read_tile_group_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, TilesI
     header_bytes = (end_position - start_position) / 8;
     obu_header->payload_size -= header_bytes;
 
+    /* The tile data is skipped by the caller */
+    if (dec_handle_ptr->skip_frame_decode)
+        return status;
+
     dec_handle_ptr->cm.mi_cols       = dec_handle_ptr->frame_header.mi_cols;
     dec_handle_ptr->cm.mi_rows       = dec_handle_ptr->frame_header.mi_rows;
     dec_handle_ptr->cm.mi_stride     = dec_handle_ptr->frame_header.mi_stride;
@@ -2273,23 +2304,32 @@ EbErrorType read_tile_group_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, TilesI
     uint32_t num_threads = dec_handle_ptr->dec_config.threads;
     int      is_mt       = num_threads != 1;
 
+    /* In-loop filters only matter for the output of non reference frames */
+    EbBool skip_filters = !is_mt &&
+        ((dec_handle_ptr->dec_config.skip_non_ref_filters &&
+          frame_header->refresh_frame_flags == 0) ||
+         dec_handle_ptr->dec_config.parse_only);
+    if (skip_filters)
+        dec_handle_ptr->is_lf_enabled = 0;
+
     /* PPF flags derivation */
     EbBool no_ibc = !dec_handle_ptr->frame_header.allow_intrabc;
     /* LF */
-    EbBool do_lf_flag = no_ibc &&
+    EbBool do_lf_flag = no_ibc && !skip_filters &&
         (dec_handle_ptr->frame_header.loop_filter_params.filter_level[0] ||
          dec_handle_ptr->frame_header.loop_filter_params.filter_level[1]);
     /* CDEF */
-    EbBool do_cdef = no_ibc &&
+    EbBool do_cdef = no_ibc && !skip_filters &&
         (!frame_header->coded_lossless &&
          (frame_header->cdef_params.cdef_bits || frame_header->cdef_params.cdef_y_strength[0] ||
           frame_header->cdef_params.cdef_uv_strength[0]));
 
-    EbBool do_upscale = no_ibc && !av1_superres_unscaled(&dec_handle_ptr->frame_header.frame_size);
+    EbBool do_upscale = no_ibc && !dec_handle_ptr->dec_config.parse_only &&
+        !av1_superres_unscaled(&dec_handle_ptr->frame_header.frame_size);
     /* LR */
     //EbBool opt_lr = !do_cdef && !do_upscale;
     LrParams *lr_param = dec_handle_ptr->frame_header.lr_params;
-    EbBool    do_lr    = no_ibc &&
+    EbBool    do_lr    = no_ibc && !skip_filters &&
         (lr_param[AOM_PLANE_Y].frame_restoration_type != RESTORE_NONE ||
          lr_param[AOM_PLANE_U].frame_restoration_type != RESTORE_NONE ||
          lr_param[AOM_PLANE_V].frame_restoration_type != RESTORE_NONE);
@@ -2458,7 +2498,7 @@ EbErrorType read_tile_group_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, TilesI
     if (frame_header->disable_frame_end_update_cdf)
         dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx = main_parse_ctxt->init_frm_ctx;
 
-    if (!is_mt) {
+    if (!is_mt && !dec_handle_ptr->dec_config.parse_only) {
         pad_pic(dec_handle_ptr);
     }
 
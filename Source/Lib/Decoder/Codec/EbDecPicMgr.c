@@ -51,9 +51,6 @@
 
 EbErrorType dec_pic_mgr_init(EbDecHandle *dec_handle_ptr) {
     EbDecPicMgr **pps_pic_mgr = (EbDecPicMgr **)&dec_handle_ptr->pv_pic_mgr;
-    uint32_t      mi_cols     = 2 * ((dec_handle_ptr->seq_header.max_frame_width + 7) >> 3);
-    uint32_t      mi_rows     = 2 * ((dec_handle_ptr->seq_header.max_frame_height + 7) >> 3);
-    int           size        = mi_cols * mi_rows;
 
     EbErrorType return_error = EB_ErrorNone;
     int32_t     i;
@@ -68,9 +65,8 @@ EbErrorType dec_pic_mgr_init(EbDecHandle *dec_handle_ptr) {
         ps_pic_mgr->as_dec_pic[i].size       = 0;
         ps_pic_mgr->as_dec_pic[i].ref_count  = 0;
         ps_pic_mgr->as_dec_pic[i].mvs        = NULL;
-        EB_MALLOC_DEC(
-            uint8_t *, ps_pic_mgr->as_dec_pic[i].segment_maps, size * sizeof(uint8_t), EB_N_PTR);
-        memset(ps_pic_mgr->as_dec_pic[i].segment_maps, 0, size);
+        /* Allocated along with the picture buffer, only for the pictures in use */
+        ps_pic_mgr->as_dec_pic[i].segment_maps = NULL;
     }
 
     ps_pic_mgr->num_pic_bufs = 0;
@@ -88,6 +84,17 @@ static INLINE EbErrorType mvs_8x8_memory_alloc(TemporalMvRef **mvs, FrameHeader
     return EB_ErrorNone;
 }
 
+static INLINE EbErrorType segment_maps_memory_alloc(uint8_t **segment_maps, SeqHeader *seq_header) {
+    const uint32_t mi_cols = 2 * ((seq_header->max_frame_width + 7) >> 3);
+    const uint32_t mi_rows = 2 * ((seq_header->max_frame_height + 7) >> 3);
+    const size_t   size    = mi_cols * mi_rows;
+
+    EB_MALLOC_DEC(uint8_t *, *segment_maps, size * sizeof(uint8_t), EB_N_PTR);
+    memset(*segment_maps, 0, size);
+
+    return EB_ErrorNone;
+}
+
 /**
 *******************************************************************************
 *
@@ -136,6 +143,7 @@ EbDecPicBuf *dec_pic_mgr_get_cur_pic(EbDecHandle *dec_handle_ptr) {
     size_t         frame_size = y_size + uv_size;
 
     if (ps_pic_mgr->as_dec_pic[i].size < frame_size) {
+        uint64_t mem_start = *svt_dec_total_lib_memory;
         /* allocate the buffer. TODO: Should add free and allocate logic */
 
         EbPictureBufferDescInitData input_pic_buf_desc_init_data;
@@ -171,6 +179,14 @@ EbDecPicBuf *dec_pic_mgr_get_cur_pic(EbDecHandle *dec_handle_ptr) {
         if (ret_err != EB_ErrorNone)
             return NULL;
 
+        if (ps_pic_mgr->as_dec_pic[i].segment_maps == NULL) {
+            ret_err = segment_maps_memory_alloc(&ps_pic_mgr->as_dec_pic[i].segment_maps,
+                                                seq_header);
+            if (ret_err != EB_ErrorNone)
+                return NULL;
+        }
+
+        dec_handle_ptr->mem_usage[DEC_MEM_PIC_BUFS] += *svt_dec_total_lib_memory - mem_start;
         ps_pic_mgr->num_pic_bufs++;
     } else
         assert(ps_pic_mgr->as_dec_pic[i].ps_pic_buf != NULL);
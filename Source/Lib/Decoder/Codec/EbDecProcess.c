@@ -133,6 +133,7 @@ EbErrorType dec_system_resource_init(EbDecHandle *dec_handle_ptr, TilesInfo *til
         &dec_handle_ptr->main_frame_buf.cur_frame_bufs[0].dec_mt_frame_data;
 
     memory_map_start_address = svt_dec_memory_map;
+    uint64_t mem_start       = *svt_dec_total_lib_memory;
     memset(&dec_mt_frame_data->prev_frame_info, 0, sizeof(PrevFrameMtCheck));
 
     int32_t num_tiles = tiles_info->tile_cols * tiles_info->tile_rows;
@@ -398,6 +399,8 @@ EbErrorType dec_system_resource_init(EbDecHandle *dec_handle_ptr, TilesInfo *til
                                    dec_all_stage_kernel,
                                    (void **)&thread_ctxt_pa);
         }
+        /* Re-init on a frame size change re-creates the same set of resources */
+        dec_handle_ptr->mem_usage[DEC_MEM_MT] = *svt_dec_total_lib_memory - mem_start;
     } else {
         for (uint32_t i = 0; i < num_lib_threads; i++) {
             dec_handle_ptr->thread_ctxt_pa[i].dec_mod_ctxt = dec_mod_ctxt_arr[i];
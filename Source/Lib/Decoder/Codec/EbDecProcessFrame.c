@@ -72,6 +72,7 @@ EbErrorType decode_tile_row(DecModCtxt *dec_mod_ctxt, TilesInfo *tile_info,
     MainFrameBuf     *main_frame_buf           = &dec_handle_ptr->main_frame_buf;
     CurFrameBuf      *frame_buf                = &main_frame_buf->cur_frame_bufs[0];
     volatile int32_t *sb_completed_in_prev_row = NULL;
+    volatile int32_t *sb_parsed_in_row;
     uint32_t         *sb_completed_in_row;
     int32_t           tile_wd_in_sb;
     int32_t           sb_mi_size_log2 = dec_mod_ctxt->seq_header->sb_size_log2 - MI_SIZE_LOG2;
@@ -88,6 +89,8 @@ EbErrorType decode_tile_row(DecModCtxt *dec_mod_ctxt, TilesInfo *tile_info,
     }
 
     sb_completed_in_row = &parse_recon_tile_info_array->sb_recon_completed_in_row[sb_row_in_tile];
+    sb_parsed_in_row    = (volatile int32_t *)&parse_recon_tile_info_array
+                           ->sb_recon_row_parsed[sb_row_in_tile];
 
     tile_wd_in_sb = (AOMMIN(tile_info->tile_col_start_mi[tile_col + 1],
                             dec_handle_ptr->frame_header.mi_cols) +
@@ -104,6 +107,11 @@ EbErrorType decode_tile_row(DecModCtxt *dec_mod_ctxt, TilesInfo *tile_info,
     {
         int32_t sb_col = (mi_col << MI_SIZE_LOG2) >> dec_mod_ctxt->seq_header->sb_size_log2;
 
+        /* Wait for parse of the current SB. Parse publishes progress per SB,
+           so recon of a row trails the parse thread instead of the full row */
+        while (*sb_parsed_in_row < sb_col + 1)
+            ;
+
         SBInfo *sb_info = frame_buf->sb_info + (sb_row * main_frame_buf->sb_cols) + sb_col;
 
         dec_mod_ctxt->cur_coeff[AOM_PLANE_Y] = sb_info->sb_coeff[AOM_PLANE_Y];
@@ -149,13 +157,8 @@ EbErrorType decode_tile(DecModCtxt *dec_mod_ctxt, TilesInfo *tile_info,
         //unlock mutex
         svt_release_mutex(parse_recon_tile_info_array->tile_sbrow_mutex);
 
-        //wait for parse
+        /* Parse progress is checked per SB in decode_tile_row */
         if (-1 != sb_row_in_tile) {
-            volatile int32_t *sb_row_parsed = (volatile int32_t *)&parse_recon_tile_info_array
-                                                  ->sb_recon_row_parsed[sb_row_in_tile];
-            while (0 == *sb_row_parsed)
-                ;
-
             int32_t sb_row = sb_row_in_tile + sb_row_tile_start;
 
             int32_t mi_row = (sb_row << dec_mod_ctxt->seq_header->sb_size_log2) >> MI_SIZE_LOG2;
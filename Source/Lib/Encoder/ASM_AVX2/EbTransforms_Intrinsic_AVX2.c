@@ -247,3 +247,54 @@ void downsample_2d_avx2(uint8_t *input_samples, // input parameter, input sample
                         decim_step);
     }
 }
+
+// 2x2 filtering of one pair of lines, width is the input width
+static INLINE void downsample_line_pair_avx2(const uint8_t *prev_in_line, const uint8_t *in_line,
+                                             uint32_t width, uint8_t *out_line) {
+    const uint32_t width_align32 = width - (width % 32);
+    __m256i        in, prev_in;
+    __m128i        sum_epu8;
+    DECLARE_ALIGNED(16, uint8_t, tmp_buf[16]);
+
+    for (uint32_t horiz_idx = 0; horiz_idx < width_align32; horiz_idx += 32) {
+        prev_in  = _mm256_loadu_si256((__m256i *)(prev_in_line + horiz_idx));
+        in       = _mm256_loadu_si256((__m256i *)(in_line + horiz_idx));
+        sum_epu8 = compute_sum(&in, &prev_in);
+        _mm_storeu_si128((__m128i *)(out_line + (horiz_idx >> 1)), sum_epu8);
+    }
+    //complement when width is not multiple of 32
+    if (width_align32 < width) {
+        prev_in   = _mm256_loadu_si256((__m256i *)(prev_in_line + width_align32));
+        in        = _mm256_loadu_si256((__m256i *)(in_line + width_align32));
+        sum_epu8  = compute_sum(&in, &prev_in);
+        int count = (width - width_align32) >> 1;
+        _mm_storeu_si128((__m128i *)(tmp_buf), sum_epu8);
+        memcpy(out_line + (width_align32 >> 1), tmp_buf, count * sizeof(uint8_t));
+    }
+}
+
+void downsample_2d_pyramid_avx2(uint8_t *input_samples, // input parameter, input samples Ptr
+                                uint32_t input_stride, // input parameter, input stride
+                                uint32_t input_area_width, // input parameter, input area width
+                                uint32_t input_area_height, // input parameter, input area height
+                                uint8_t *quarter_samples, // output parameter, 1/4 samples Ptr
+                                uint32_t quarter_stride, // input parameter, 1/4 stride
+                                uint8_t *sixteenth_samples, // output parameter, 1/16 samples Ptr
+                                uint32_t sixteenth_stride) // input parameter, 1/16 stride
+{
+    const uint32_t quarter_width  = input_area_width >> 1;
+    const uint32_t quarter_height = input_area_height >> 1;
+
+    for (uint32_t vert_idx = 0; vert_idx < quarter_height; vert_idx++) {
+        const uint8_t *prev_in_line = input_samples + 2 * vert_idx * input_stride;
+        uint8_t       *quarter_line = quarter_samples + vert_idx * quarter_stride;
+        downsample_line_pair_avx2(
+            prev_in_line, prev_in_line + input_stride, input_area_width, quarter_line);
+        // The two 1/4 lines of the 1/16 line are still in cache
+        if (vert_idx & 1)
+            downsample_line_pair_avx2(quarter_line - quarter_stride,
+                                      quarter_line,
+                                      quarter_width,
+                                      sixteenth_samples + (vert_idx >> 1) * sixteenth_stride);
+    }
+}
@@ -0,0 +1,97 @@
+/*
+* Copyright(c) 2022 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include <immintrin.h>
+#include "EbDefinitions.h"
+
+/* Same as svt_aom_noise_tx_filter_block_c(). tx_block holds interleaved
+   (real, imaginary) pairs, so each 256-bit register covers 4 coefficients.
+   The power of a coefficient is computed as r * r + i * i in both lanes of the
+   pair, and the divide is done in IEEE single precision like the C code, so
+   the result is bit-exact. */
+void svt_aom_noise_tx_filter_block_avx2(int32_t block_size, float *tx_block, const float psd) {
+    const float   k_beta               = 1.1f;
+    const float   k_beta_m1_div_k_beta = (k_beta - 1.0f) / k_beta;
+    const int32_t n                    = 2 * block_size * block_size;
+    const __m256  psd_v                = _mm256_set1_ps(psd);
+    const __m256  psd_mul_k_beta       = _mm256_set1_ps(k_beta * psd);
+    // p > 1e-6 done in double in the C code is the same as p > 1e-6f for a float p
+    const __m256 k_eps   = _mm256_set1_ps(1e-6f);
+    const __m256 k_atten = _mm256_set1_ps(k_beta_m1_div_k_beta);
+    int32_t      i       = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256 coeff = _mm256_loadu_ps(tx_block + i);
+        const __m256 sq    = _mm256_mul_ps(coeff, coeff);
+        const __m256 p     = _mm256_add_ps(sq, _mm256_permute_ps(sq, 0xB1));
+        const __m256 mask  = _mm256_and_ps(_mm256_cmp_ps(p, psd_mul_k_beta, _CMP_GT_OQ),
+                                          _mm256_cmp_ps(p, k_eps, _CMP_GT_OQ));
+        // When the mask is set p > k_eps, so AOMMAX(p, k_eps) is p
+        const __m256 val   = _mm256_div_ps(_mm256_sub_ps(p, psd_v), _mm256_max_ps(p, k_eps));
+        const __m256 scale = _mm256_blendv_ps(k_atten, val, mask);
+        _mm256_storeu_ps(tx_block + i, _mm256_mul_ps(coeff, scale));
+    }
+    for (; i < n; i += 2) {
+        const float p = tx_block[i] * tx_block[i] + tx_block[i + 1] * tx_block[i + 1];
+        if (p > k_beta * psd && p > 1e-6) {
+            const float val = (p - psd) / AOMMAX(p, 1e-6f);
+            tx_block[i] *= val;
+            tx_block[i + 1] *= val;
+        } else {
+            tx_block[i] *= k_beta_m1_div_k_beta;
+            tx_block[i + 1] *= k_beta_m1_div_k_beta;
+        }
+    }
+}
+
+/* Same as svt_aom_noise_model_add_observation_c(). Each element of b and A is
+   updated with one multiply and one add, in the same order as the C code. */
+void svt_aom_noise_model_add_observation_avx2(const double *buffer, double val,
+                                              double recp_sqr_norm, double *buffer_norm,
+                                              double *A, double *b, int32_t n) {
+    const __m256d recp_v = _mm256_set1_pd(recp_sqr_norm);
+    const __m256d val_v  = _mm256_set1_pd(val);
+    int32_t       i      = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const __m256d norm = _mm256_mul_pd(_mm256_loadu_pd(buffer + i), recp_v);
+        _mm256_storeu_pd(buffer_norm + i, norm);
+        _mm256_storeu_pd(b + i, _mm256_add_pd(_mm256_loadu_pd(b + i), _mm256_mul_pd(norm, val_v)));
+    }
+    for (; i < n; ++i) {
+        buffer_norm[i] = buffer[i] * recp_sqr_norm;
+        b[i] += buffer_norm[i] * val;
+    }
+
+    for (i = 0; i < n; ++i) {
+        const __m256d buffer_norm_i = _mm256_set1_pd(buffer_norm[i]);
+        double       *a_row         = A + i * n;
+        int32_t       j             = 0;
+
+        for (; j + 8 <= n; j += 8) {
+            const __m256d a0 = _mm256_add_pd(
+                _mm256_loadu_pd(a_row + j),
+                _mm256_mul_pd(buffer_norm_i, _mm256_loadu_pd(buffer + j)));
+            const __m256d a1 = _mm256_add_pd(
+                _mm256_loadu_pd(a_row + j + 4),
+                _mm256_mul_pd(buffer_norm_i, _mm256_loadu_pd(buffer + j + 4)));
+            _mm256_storeu_pd(a_row + j, a0);
+            _mm256_storeu_pd(a_row + j + 4, a1);
+        }
+        for (; j + 4 <= n; j += 4) {
+            _mm256_storeu_pd(a_row + j,
+                             _mm256_add_pd(_mm256_loadu_pd(a_row + j),
+                                           _mm256_mul_pd(buffer_norm_i,
+                                                         _mm256_loadu_pd(buffer + j))));
+        }
+        for (; j < n; ++j) a_row[j] += buffer_norm[i] * buffer[j];
+    }
+}
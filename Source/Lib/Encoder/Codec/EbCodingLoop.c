@@ -683,7 +683,11 @@ static void av1_encode_loop_16bit(PictureControlSet *pcs_ptr, EncDecContext *con
     //    uint32_t                 temporal_layer_index = sb_ptr->pcs_ptr->temporal_layer_index;
     uint32_t             qindex             = blk_ptr->qindex;
     uint32_t             bit_depth          = context_ptr->bit_depth;
-    EbPictureBufferDesc *input_samples16bit = context_ptr->input_sample16bit_buffer;
+    // with hbd_16bit_source the source is read in place from the input frame 16 bit
+    EbBool               src_in_frame = pcs_ptr->parent_pcs_ptr->scs_ptr->static_config
+                              .hbd_16bit_source;
+    EbPictureBufferDesc *input_samples16bit = src_in_frame ? pcs_ptr->input_frame16bit
+                                                           : context_ptr->input_sample16bit_buffer;
     EbPictureBufferDesc *pred_samples16bit  = pred_samples;
     uint32_t             round_origin_x = (origin_x >> 3) << 3; // for Chroma blocks with size of 4
     uint32_t             round_origin_y = (origin_y >> 3) << 3; // for Chroma blocks with size of 4
@@ -691,24 +695,36 @@ static void av1_encode_loop_16bit(PictureControlSet *pcs_ptr, EncDecContext *con
     int32_t        is_inter = (blk_ptr->prediction_mode_flag == INTER_MODE || blk_ptr->use_intrabc)
                ? EB_TRUE
                : EB_FALSE;
-    const uint32_t input_luma_offset =
-        context_ptr->blk_geom->tx_org_x[is_inter][blk_ptr->tx_depth][context_ptr->txb_itr] +
-        context_ptr->blk_geom->tx_org_y[is_inter][blk_ptr->tx_depth][context_ptr->txb_itr] *
-            SB_STRIDE_Y;
-    const uint32_t input_cb_offset =
-        ROUND_UV(
-            context_ptr->blk_geom->tx_org_x[is_inter][blk_ptr->tx_depth][context_ptr->txb_itr]) /
-            2 +
-        ROUND_UV(
-            context_ptr->blk_geom->tx_org_y[is_inter][blk_ptr->tx_depth][context_ptr->txb_itr]) /
-            2 * SB_STRIDE_UV;
-    const uint32_t input_cr_offset =
-        ROUND_UV(
-            context_ptr->blk_geom->tx_org_x[is_inter][blk_ptr->tx_depth][context_ptr->txb_itr]) /
-            2 +
-        ROUND_UV(
-            context_ptr->blk_geom->tx_org_y[is_inter][blk_ptr->tx_depth][context_ptr->txb_itr]) /
-            2 * SB_STRIDE_UV;
+    uint32_t input_luma_offset, input_cb_offset, input_cr_offset;
+
+    if (src_in_frame) {
+        input_luma_offset = ((origin_y + input_samples16bit->origin_y) *
+                             input_samples16bit->stride_y) +
+            (origin_x + input_samples16bit->origin_x);
+        input_cb_offset = (((round_origin_y + input_samples16bit->origin_y) >> 1) *
+                           input_samples16bit->stride_cb) +
+            ((round_origin_x + input_samples16bit->origin_x) >> 1);
+        input_cr_offset = (((round_origin_y + input_samples16bit->origin_y) >> 1) *
+                           input_samples16bit->stride_cr) +
+            ((round_origin_x + input_samples16bit->origin_x) >> 1);
+    } else {
+        input_luma_offset =
+            context_ptr->blk_geom->tx_org_x[is_inter][blk_ptr->tx_depth][context_ptr->txb_itr] +
+            context_ptr->blk_geom->tx_org_y[is_inter][blk_ptr->tx_depth][context_ptr->txb_itr] *
+                SB_STRIDE_Y;
+        input_cb_offset = ROUND_UV(context_ptr->blk_geom->tx_org_x[is_inter][blk_ptr->tx_depth]
+                                                                  [context_ptr->txb_itr]) /
+                2 +
+            ROUND_UV(context_ptr->blk_geom
+                         ->tx_org_y[is_inter][blk_ptr->tx_depth][context_ptr->txb_itr]) /
+                2 * SB_STRIDE_UV;
+        input_cr_offset = ROUND_UV(context_ptr->blk_geom->tx_org_x[is_inter][blk_ptr->tx_depth]
+                                                                  [context_ptr->txb_itr]) /
+                2 +
+            ROUND_UV(context_ptr->blk_geom
+                         ->tx_org_y[is_inter][blk_ptr->tx_depth][context_ptr->txb_itr]) /
+                2 * SB_STRIDE_UV;
+    }
     const uint32_t pred_luma_offset = ((pred_samples16bit->origin_y + origin_y) *
                                        pred_samples16bit->stride_y) +
         (pred_samples16bit->origin_x + origin_x);
@@ -1325,6 +1341,97 @@ void store16bit_input_src(EbPictureBufferDesc *input_sample16bit_buffer, Picture
                    from_ptr + row_it * input_sample16bit_buffer->stride_cr,
                    sb_w * 2);
 }
+/*
+ * Pack the 10-bit source of the SB in place in the input frame 16 bit, which is the 16-bit copy
+ * of the source kept with hbd_16bit_source, unless that copy is already up to date. The SB is
+ * then padded up to the SB size the same way as the SB copy of the source.
+ */
+void pack_input_frame16bit_sb(SequenceControlSet *scs, PictureControlSet *pcs,
+                              EbPictureBufferDesc *input_pic, uint32_t sb_org_x,
+                              uint32_t sb_org_y) {
+    EbPictureBufferDesc *out_pic   = pcs->input_frame16bit;
+    uint32_t             sb_width  = MIN(scs->sb_size_pix,
+                                  pcs->parent_pcs_ptr->aligned_width - sb_org_x);
+    uint32_t             sb_height = MIN(scs->sb_size_pix,
+                                   pcs->parent_pcs_ptr->aligned_height - sb_org_y);
+    uint16_t            *out_y     = (uint16_t *)out_pic->buffer_y +
+        (sb_org_y + out_pic->origin_y) * out_pic->stride_y + (sb_org_x + out_pic->origin_x);
+    uint16_t *out_cb = (uint16_t *)out_pic->buffer_cb +
+        ((sb_org_y + out_pic->origin_y) >> 1) * out_pic->stride_cb +
+        ((sb_org_x + out_pic->origin_x) >> 1);
+    uint16_t *out_cr = (uint16_t *)out_pic->buffer_cr +
+        ((sb_org_y + out_pic->origin_y) >> 1) * out_pic->stride_cr +
+        ((sb_org_x + out_pic->origin_x) >> 1);
+
+    if (!pcs->parent_pcs_ptr->enhanced_picture16bit_valid) {
+        const uint32_t input_luma_offset = ((sb_org_y + input_pic->origin_y) *
+                                            input_pic->stride_y) +
+            (sb_org_x + input_pic->origin_x);
+        const uint32_t input_cb_offset = (((sb_org_y + input_pic->origin_y) >> 1) *
+                                          input_pic->stride_cb) +
+            ((sb_org_x + input_pic->origin_x) >> 1);
+        const uint32_t input_cr_offset = (((sb_org_y + input_pic->origin_y) >> 1) *
+                                          input_pic->stride_cr) +
+            ((sb_org_x + input_pic->origin_x) >> 1);
+
+        //sb_width is n*8 so the 2bit-decompression kernel works properly
+        uint32_t comp_stride_y           = input_pic->stride_y / 4;
+        uint32_t comp_luma_buffer_offset = comp_stride_y * input_pic->origin_y +
+            input_pic->origin_x / 4;
+        comp_luma_buffer_offset += sb_org_x / 4 + sb_org_y * comp_stride_y;
+
+        compressed_pack_sb(input_pic->buffer_y + input_luma_offset,
+                           input_pic->stride_y,
+                           input_pic->buffer_bit_inc_y + comp_luma_buffer_offset,
+                           comp_stride_y,
+                           out_y,
+                           out_pic->stride_y,
+                           sb_width,
+                           sb_height);
+
+        uint32_t comp_stride_uv            = input_pic->stride_cb / 4;
+        uint32_t comp_chroma_buffer_offset = comp_stride_uv * (input_pic->origin_y / 2) +
+            input_pic->origin_x / 2 / 4;
+        comp_chroma_buffer_offset += sb_org_x / 4 / 2 + sb_org_y / 2 * comp_stride_uv;
+
+        compressed_pack_sb(input_pic->buffer_cb + input_cb_offset,
+                           input_pic->stride_cb,
+                           input_pic->buffer_bit_inc_cb + comp_chroma_buffer_offset,
+                           comp_stride_uv,
+                           out_cb,
+                           out_pic->stride_cb,
+                           sb_width / 2,
+                           sb_height / 2);
+        compressed_pack_sb(input_pic->buffer_cr + input_cr_offset,
+                           input_pic->stride_cr,
+                           input_pic->buffer_bit_inc_cr + comp_chroma_buffer_offset,
+                           comp_stride_uv,
+                           out_cr,
+                           out_pic->stride_cr,
+                           sb_width / 2,
+                           sb_height / 2);
+    }
+
+    // PAD the packed source in incomplete sb up to max SB size
+    pad_input_picture_16bit(out_y,
+                            out_pic->stride_y,
+                            sb_width,
+                            sb_height,
+                            scs->sb_size_pix - sb_width,
+                            scs->sb_size_pix - sb_height);
+    pad_input_picture_16bit(out_cb,
+                            out_pic->stride_cb,
+                            sb_width >> 1,
+                            sb_height >> 1,
+                            (scs->sb_size_pix - sb_width) >> 1,
+                            (scs->sb_size_pix - sb_height) >> 1);
+    pad_input_picture_16bit(out_cr,
+                            out_pic->stride_cr,
+                            sb_width >> 1,
+                            sb_height >> 1,
+                            (scs->sb_size_pix - sb_width) >> 1,
+                            (scs->sb_size_pix - sb_height) >> 1);
+}
 void update_mi_map_enc_dec(BlkStruct *blk_ptr, ModeDecisionContext *md_ctx);
 void move_blk_data(PictureControlSet *pcs, EncDecContext *context_ptr, BlkStruct *src_cu,
                    BlkStruct *dst_cu);
@@ -2318,7 +2425,16 @@ void prepare_input_picture(SequenceControlSet *scs, PictureControlSet *pcs, EncD
     uint32_t sb_width  = MIN(scs->sb_size_pix, pcs->parent_pcs_ptr->aligned_width - sb_org_x);
     uint32_t sb_height = MIN(scs->sb_size_pix, pcs->parent_pcs_ptr->aligned_height - sb_org_y);
 
-    if (is_16bit && scs->static_config.encoder_bit_depth > EB_8BIT) {
+    // mode decision packs and pads the SB in the buffer it shares with the encode pass
+    EbBool sb_packed_by_md = ctx->md_context->hbd_pack_done &&
+        ctx->md_context->input_sample16bit_buffer == ctx->input_sample16bit_buffer;
+
+    if (is_16bit && scs->static_config.encoder_bit_depth > EB_8BIT &&
+        scs->static_config.hbd_16bit_source) {
+        // the encode pass reads the source in place from the input frame 16 bit
+        if (!ctx->md_context->hbd_pack_done)
+            pack_input_frame16bit_sb(scs, pcs, input_pic, sb_org_x, sb_org_y);
+    } else if (is_16bit && scs->static_config.encoder_bit_depth > EB_8BIT && !sb_packed_by_md) {
         //SB128_TODO change 10bit SB creation
 
         const uint32_t input_luma_offset = ((sb_org_y + input_pic->origin_y) *
@@ -47,6 +47,9 @@ extern EbErrorType av1_encdec_update(SequenceControlSet *scs_ptr, PictureControl
 
 void store16bit_input_src(EbPictureBufferDesc *input_sample16bit_buffer, PictureControlSet *pcs_ptr,
                           uint32_t sb_x, uint32_t sb_y, uint32_t sb_w, uint32_t sb_h);
+void pack_input_frame16bit_sb(SequenceControlSet *scs, PictureControlSet *pcs,
+                              EbPictureBufferDesc *input_pic, uint32_t sb_org_x,
+                              uint32_t sb_org_y);
 
 void residual_kernel(uint8_t *input, uint32_t input_offset, uint32_t input_stride, uint8_t *pred,
                      uint32_t pred_offset, uint32_t pred_stride, int16_t *residual,
@@ -172,7 +172,8 @@ EbErrorType enc_dec_context_ctor(EbThreadContext   *thread_context_ptr,
            0,
            0,
            enable_hbd_mode_decision == DEFAULT ? 2 : enable_hbd_mode_decision,
-           static_config->screen_content_mode);
+           static_config->screen_content_mode,
+           (uint8_t)enc_handle_ptr->scs_instance_array[0]->scs_ptr->speed_control_flag);
     if (enable_hbd_mode_decision)
         context_ptr->md_context->input_sample16bit_buffer = context_ptr->input_sample16bit_buffer;
 
@@ -5598,6 +5599,12 @@ void signal_derivation_enc_dec_kernel_oq_light_pd1(PictureControlSet   *pcs_ptr,
     context_ptr->rate_est_ctrls.update_skip_ctx_dc_sign_ctx = 0;
     context_ptr->rate_est_ctrls.update_skip_coeff_ctx       = 0;
     context_ptr->subres_ctrls.odd_to_even_deviation_th      = 0;
+
+    // Static SBs have no residual, so the chroma TX is skipped along with the luma TX
+    if (context_ptr->static_sb) {
+        context_ptr->lpd1_tx_ctrls.zero_y_coeff_exit     = 1;
+        context_ptr->lpd1_tx_ctrls.chroma_detector_level = 0;
+    }
 }
 EbErrorType signal_derivation_enc_dec_kernel_oq(SequenceControlSet *scs, PictureControlSet *pcs_ptr,
                                                 ModeDecisionContext *context_ptr) {
@@ -6488,6 +6495,7 @@ void recode_loop_update_q(PictureParentControlSet *ppcs_ptr, int *const loop, in
 void sb_qp_derivation_tpl_la(PictureControlSet *pcs_ptr);
 void mode_decision_configuration_init_qp_update(PictureControlSet *pcs_ptr);
 void init_enc_dec_segement(PictureParentControlSet *parentpicture_control_set_ptr);
+void svt_av1_rc_inflight_encdec_estimate(PictureParentControlSet *ppcs_ptr);
 
 static void recode_loop_decision_maker(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr,
                                        EbBool *do_recode) {
@@ -6821,6 +6829,27 @@ uint8_t is_vlpd0_safe(PictureControlSet *pcs_ptr, ModeDecisionContext *md_ctx) {
 
     return is_vlpd0_safe;
 }
+/*
+* Check whether the SB is coded with the static SB shortcut. Static SBs did not change relative to the
+* closest reference (detected at ME) and are coded as a single zero-MV 64x64 inter block without residual
+* through the light-PD1 path. The MD recon must be the final recon (bypass_encdec), otherwise the EncDec
+* pass would code the residual.
+*/
+static EbBool is_static_sb(SequenceControlSet *scs_ptr, PictureControlSet *pcs_ptr,
+                           ModeDecisionContext *md_ctx) {
+    PictureParentControlSet *ppcs = pcs_ptr->parent_pcs_ptr;
+
+    if (pcs_ptr->slice_type == I_SLICE || !ppcs->static_sb[md_ctx->sb_index])
+        return EB_FALSE;
+    // Features that are assumed off in the light-PD1 path
+    if (md_ctx->hbd_mode_decision || ppcs->disallow_nsq == EB_FALSE ||
+        md_ctx->disallow_4x4 == EB_FALSE || ppcs->frm_hdr.tx_mode == TX_MODE_SELECT ||
+        ppcs->frm_hdr.allow_warped_motion || ppcs->frm_hdr.is_motion_mode_switchable)
+        return EB_FALSE;
+
+    return md_ctx->bypass_encdec && scs_ptr->super_block_size == 64 &&
+        ppcs->sb_params_array[md_ctx->sb_index].is_complete_sb;
+}
 /* EncDec (Encode Decode) Kernel */
 /*********************************************************************************
 *
@@ -6921,6 +6950,7 @@ void *mode_decision_kernel(void *input_ptr) {
                                               .tile_group_width_in_sb;
         context_ptr->tot_intra_coded_area = 0;
         context_ptr->tot_skip_coded_area  = 0;
+        context_ptr->tot_static_sb_count  = 0;
         // Bypass encdec for the first pass
         if (scs_ptr->static_config.pass == ENC_FIRST_PASS ||
             (!pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag &&
@@ -7117,11 +7147,22 @@ void *mode_decision_kernel(void *input_ptr) {
                         // signals set once per SB (i.e. not per PD)
                         signal_derivation_enc_dec_kernel_common(
                             scs_ptr, pcs_ptr, context_ptr->md_context);
+                        // Static SBs only test the 64x64 block with the most aggressive light-PD1 level;
+                        // PD0 and the light-PD1 detectors are skipped
+                        md_ctx->static_sb = is_static_sb(scs_ptr, pcs_ptr, md_ctx);
+                        if (md_ctx->static_sb) {
+                            md_ctx->depth_removal_ctrls.enabled              = 1;
+                            md_ctx->depth_removal_ctrls.disallow_below_64x64 = 1;
+                            md_ctx->lpd1_ctrls.pd1_level                     = LPD1_LEVELS - 1;
+                            context_ptr->tot_static_sb_count++;
+                        }
 
-                        if (pcs_ptr->parent_pcs_ptr->palette_level)
+                        if (pcs_ptr->parent_pcs_ptr->palette_level) {
                             // Status of palette info alloc
                             for (int i = 0; i < scs_ptr->max_block_cnt; ++i)
                                 context_ptr->md_context->md_blk_arr_nsq[i].palette_mem = 0;
+                            context_ptr->md_context->palette_unit_colors_ready = 0;
+                        }
 
                         // Initialize is_subres_safe
                         context_ptr->md_context->is_subres_safe = (uint8_t)~0;
@@ -7243,8 +7284,9 @@ void *mode_decision_kernel(void *input_ptr) {
                         context_ptr->md_context->pd_pass = PD_PASS_1;
                         // This classifier is used for the case PD0 is bypassed and for pd0_level 2
                         // where the count_non_zero_coeffs is not derived @ PD0
-                        if (skip_pd_pass_0 ||
-                            context_ptr->md_context->pd0_level == VERY_LIGHT_PD0) {
+                        if ((skip_pd_pass_0 ||
+                             context_ptr->md_context->pd0_level == VERY_LIGHT_PD0) &&
+                            !md_ctx->static_sb) {
                             lpd1_detector_skip_pd0(pcs_ptr, md_ctx, pic_width_in_sb);
                         }
 
@@ -7327,6 +7369,7 @@ void *mode_decision_kernel(void *input_ptr) {
             svt_block_on_mutex(pcs_ptr->intra_mutex);
             pcs_ptr->intra_coded_area += (uint32_t)context_ptr->tot_intra_coded_area;
             pcs_ptr->skip_coded_area += (uint32_t)context_ptr->tot_skip_coded_area;
+            pcs_ptr->static_sb_count += context_ptr->tot_static_sb_count;
             // Accumulate block selection
             pcs_ptr->enc_dec_coded_sb_count += (uint32_t)context_ptr->coded_sb_count;
             EbBool last_sb_flag = (pcs_ptr->sb_total_count_pix == pcs_ptr->enc_dec_coded_sb_count);
@@ -7337,7 +7380,9 @@ void *mode_decision_kernel(void *input_ptr) {
                 if ((scs_ptr->static_config.pass == ENC_MIDDLE_PASS ||
                      scs_ptr->static_config.pass == ENC_LAST_PASS || scs_ptr->lap_enabled ||
                      scs_ptr->static_config.max_bit_rate != 0) &&
-                    scs_ptr->encode_context_ptr->recode_loop != DISALLOW_RECODE) {
+                    scs_ptr->encode_context_ptr->recode_loop != DISALLOW_RECODE &&
+                    !(pcs_ptr->parent_pcs_ptr->ext_rc_params &&
+                      pcs_ptr->parent_pcs_ptr->ext_rc_params->qindex)) {
                     recode_loop_decision_maker(pcs_ptr, scs_ptr, &do_recode);
                 }
 
@@ -7367,6 +7412,7 @@ void *mode_decision_kernel(void *input_ptr) {
 
                 } else {
                     EB_FREE_ARRAY(pcs_ptr->ec_ctx_array);
+                    svt_av1_rc_inflight_encdec_estimate(pcs_ptr->parent_pcs_ptr);
                     // Copy film grain data from parent picture set to the reference object for further reference
                     if (scs_ptr->seq_header.film_grain_params_present) {
                         if (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE &&
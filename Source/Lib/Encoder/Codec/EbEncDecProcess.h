@@ -70,6 +70,7 @@ typedef struct EncDecContext {
     EbColorFormat color_format;
     uint64_t      tot_intra_coded_area;
     uint64_t      tot_skip_coded_area;
+    uint32_t      tot_static_sb_count;
     uint64_t      three_quad_energy;
 
     // Needed for DC prediction
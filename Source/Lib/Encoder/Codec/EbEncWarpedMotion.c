@@ -99,6 +99,12 @@ static INLINE int highbd_error_measure(int err, int bd) {
     return error_measure_lut[255 + e1] * (v - e2) + error_measure_lut[256 + e1] * e2;
 }
 
+// When sampling, only the WARP_ERROR_BLOCKs of a checkerboard are visited: each
+// row of blocks starts one block to the right of the previous one.
+static INLINE int block_row_offset(int row) {
+    return (row / WARP_ERROR_BLOCK) & 1 ? WARP_ERROR_BLOCK : 0;
+}
+
 static int64_t highbd_frame_error(const uint16_t *const ref, int stride, const uint16_t *const dst,
                                   int p_width, int p_height, int p_stride, int bd) {
     int64_t sum_error = 0;
@@ -114,16 +120,18 @@ static int64_t highbd_warp_error(EbWarpedMotionParams *wm, const uint8_t *const
                                  const uint8_t *const ref_2b, int width, int height, int stride,
                                  const uint8_t *const dst8, int p_col, int p_row, int p_width,
                                  int p_height, int p_stride, int subsampling_x, int subsampling_y,
-                                 int bd, int64_t best_error) {
+                                 int bd, int64_t best_error, int sample_blocks) {
     int64_t   gm_sumerr     = 0;
     const int error_bsize_w = AOMMIN(p_width, WARP_ERROR_BLOCK);
     const int error_bsize_h = AOMMIN(p_height, WARP_ERROR_BLOCK);
+    const int col_step      = sample_blocks ? 2 * WARP_ERROR_BLOCK : WARP_ERROR_BLOCK;
     uint16_t  tmp[WARP_ERROR_BLOCK * WARP_ERROR_BLOCK];
 
     ConvolveParams conv_params   = get_conv_params(0, 0, 0, bd);
     conv_params.use_jnt_comp_avg = 0;
     for (int i = p_row; i < p_row + p_height; i += WARP_ERROR_BLOCK) {
-        for (int j = p_col; j < p_col + p_width; j += WARP_ERROR_BLOCK) {
+        const int col_start = sample_blocks ? block_row_offset(i - p_row) : 0;
+        for (int j = p_col + col_start; j < p_col + p_width; j += col_step) {
             // avoid warping extra 8x8 blocks in the padded region of the frame
             // when p_width and p_height are not multiples of WARP_ERROR_BLOCK
             const int warp_w = AOMMIN(error_bsize_w, p_col + p_width - j);
@@ -173,17 +181,19 @@ int64_t svt_av1_calc_frame_error_c(const uint8_t *const ref, int stride, const u
 static int64_t warp_error(EbWarpedMotionParams *wm, const uint8_t *const ref, int width, int height,
                           int stride, const uint8_t *const dst, int p_col, int p_row, int p_width,
                           int p_height, int p_stride, int subsampling_x, int subsampling_y,
-                          int64_t best_error) {
+                          int64_t best_error, int sample_blocks) {
     int64_t        gm_sumerr = 0;
     int            warp_w, warp_h;
     int            error_bsize_w = AOMMIN(p_width, WARP_ERROR_BLOCK);
     int            error_bsize_h = AOMMIN(p_height, WARP_ERROR_BLOCK);
+    const int      col_step      = sample_blocks ? 2 * WARP_ERROR_BLOCK : WARP_ERROR_BLOCK;
     uint8_t        tmp[WARP_ERROR_BLOCK * WARP_ERROR_BLOCK];
     ConvolveParams conv_params   = get_conv_params(0, 0, 0, 8);
     conv_params.use_jnt_comp_avg = 0;
 
     for (int i = p_row; i < p_row + p_height; i += WARP_ERROR_BLOCK) {
-        for (int j = p_col; j < p_col + p_width; j += WARP_ERROR_BLOCK) {
+        const int col_start = sample_blocks ? block_row_offset(i - p_row) : 0;
+        for (int j = p_col + col_start; j < p_col + p_width; j += col_step) {
             // avoid warping extra 8x8 blocks in the padded region of the frame
             // when p_width and p_height are not multiples of WARP_ERROR_BLOCK
             warp_w = AOMMIN(error_bsize_w, p_col + p_width - j);
@@ -213,7 +223,24 @@ static int64_t warp_error(EbWarpedMotionParams *wm, const uint8_t *const ref, in
 }
 
 int64_t svt_av1_frame_error(int use_hbd, int bd, const uint8_t *ref, int stride, uint8_t *dst,
-                            int p_width, int p_height, int p_stride) {
+                            int p_width, int p_height, int p_stride, int sample_blocks) {
+    if (sample_blocks) {
+        int64_t sum_error = 0;
+        for (int i = 0; i < p_height; i += WARP_ERROR_BLOCK) {
+            for (int j = block_row_offset(i); j < p_width; j += 2 * WARP_ERROR_BLOCK) {
+                sum_error += svt_av1_frame_error(use_hbd,
+                                                 bd,
+                                                 ref + i * stride + j,
+                                                 stride,
+                                                 dst + i * p_stride + j,
+                                                 AOMMIN(WARP_ERROR_BLOCK, p_width - j),
+                                                 AOMMIN(WARP_ERROR_BLOCK, p_height - i),
+                                                 p_stride,
+                                                 0);
+            }
+        }
+        return sum_error;
+    }
     if (use_hbd) {
         return highbd_frame_error(CONVERT_TO_SHORTPTR(ref),
                                   stride,
@@ -229,7 +256,8 @@ int64_t svt_av1_frame_error(int use_hbd, int bd, const uint8_t *ref, int stride,
 int64_t svt_av1_warp_error(EbWarpedMotionParams *wm, int use_hbd, int bd, const uint8_t *ref,
                            const uint8_t *ref_2b, int width, int height, int stride, uint8_t *dst,
                            int p_col, int p_row, int p_width, int p_height, int p_stride,
-                           int subsampling_x, int subsampling_y, int64_t best_error) {
+                           int subsampling_x, int subsampling_y, int64_t best_error,
+                           int sample_blocks) {
     if (wm->wmtype <= AFFINE)
         if (!svt_get_shear_params(wm))
             return 1;
@@ -249,7 +277,8 @@ int64_t svt_av1_warp_error(EbWarpedMotionParams *wm, int use_hbd, int bd, const
                                  subsampling_x,
                                  subsampling_y,
                                  bd,
-                                 best_error);
+                                 best_error,
+                                 sample_blocks);
     return warp_error(wm,
                       ref,
                       width,
@@ -263,5 +292,6 @@ int64_t svt_av1_warp_error(EbWarpedMotionParams *wm, int use_hbd, int bd, const
                       p_stride,
                       subsampling_x,
                       subsampling_y,
-                      best_error);
+                      best_error,
+                      sample_blocks);
 }
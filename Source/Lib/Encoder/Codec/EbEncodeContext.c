@@ -58,6 +58,8 @@ static void encode_context_dctor(EbPtr p) {
     EB_DESTROY_MUTEX(obj->shared_reference_mutex);
     EB_DESTROY_MUTEX(obj->stat_file_mutex);
     EB_DESTROY_MUTEX(obj->frame_updated_mutex);
+    EB_DESTROY_MUTEX(obj->inflight_mutex);
+    EB_DESTROY_MUTEX(obj->dyn_superres_mutex);
     EB_DELETE(obj->prediction_structure_group_ptr);
     EB_DELETE_PTR_ARRAY(obj->picture_decision_reorder_queue,
                         PICTURE_DECISION_REORDER_QUEUE_MAX_DEPTH);
@@ -85,6 +87,10 @@ EbErrorType encode_context_ctor(EncodeContext *encode_context_ptr, EbPtr object_
 
     EB_CREATE_MUTEX(encode_context_ptr->total_number_of_recon_frame_mutex);
     EB_CREATE_MUTEX(encode_context_ptr->frame_updated_mutex);
+    EB_CREATE_MUTEX(encode_context_ptr->inflight_mutex);
+    encode_context_ptr->inflight_size_ratio = 1.0;
+    EB_CREATE_MUTEX(encode_context_ptr->dyn_superres_mutex);
+    encode_context_ptr->dyn_superres_denom = SCALE_NUMERATOR;
     EB_ALLOC_PTR_ARRAY(encode_context_ptr->picture_decision_reorder_queue,
                        PICTURE_DECISION_REORDER_QUEUE_MAX_DEPTH);
 
@@ -152,7 +158,7 @@ EbErrorType encode_context_ctor(EncodeContext *encode_context_ptr, EbPtr object_
     encode_context_ptr->td_needed = EB_TRUE;
 
     EB_CREATE_MUTEX(encode_context_ptr->sc_buffer_mutex);
-    encode_context_ptr->enc_mode                      = SPEED_CONTROL_INIT_MOD;
+    encode_context_ptr->enc_mode                      = ENC_M0;
     encode_context_ptr->previous_selected_ref_qp      = 32;
     encode_context_ptr->max_coded_poc_selected_ref_qp = 32;
     encode_context_ptr->recode_tolerance              = 25;
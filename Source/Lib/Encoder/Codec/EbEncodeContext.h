@@ -191,6 +191,7 @@ typedef struct EncodeContext {
     int               num_lap_buffers;
     STATS_BUFFER_CTX  stats_buf_context;
     SvtAv1FixedBuf    rc_stats_buffer; // replaced oxcf->two_pass_cfg.stats_in in aom
+    EbBool            rc_stats_scaled; // rc_stats_buffer rescaled from stats_source_width/height
     FirstPassStatsOut stats_out;
     RecodeLoopType    recode_loop;
     // This feature controls the tolerence vs target used in deciding whether to
@@ -198,6 +199,28 @@ typedef struct EncodeContext {
     int      recode_tolerance;
     int32_t  frame_updated;
     EbHandle frame_updated_mutex;
+    // CBR in-flight accounting: bits charged to the buffer model by pictures that
+    // have passed rate control but not packetization yet, and the running ratio
+    // between the actual frame sizes and the mode decision rate estimates
+    int64_t  inflight_bits;
+    double   inflight_size_ratio;
+    EbHandle inflight_mutex;
+    // Number of SBs coded through the static SB path and number of SBs in inter
+    // pictures, only updated by the packetization process
+    uint64_t static_sb_count;
+    uint64_t inter_sb_count;
+    // Dynamic super-res (SUPERRES_DYNAMIC): denominator applied to the next mini-GOPs, set by
+    // the packetization process and read by the picture decision process
+    uint8_t  dyn_superres_denom;
+    EbHandle dyn_superres_mutex;
+    // Load tracking of the packetization process: real time reference point, frames output
+    // since then, and the lag / max q counts of the current decision window
+    uint64_t dyn_superres_start_s;
+    uint64_t dyn_superres_start_us;
+    uint64_t dyn_superres_frames;
+    double   dyn_superres_last_lag_ms;
+    uint32_t dyn_superres_window_frames;
+    uint32_t dyn_superres_max_q_frames;
 } EncodeContext;
 
 typedef struct EncodeContextInitData {
@@ -243,6 +243,7 @@ void compute_global_motion(PictureParentControlSet *pcs_ptr, EbPictureBufferDesc
                         input_pic->height,
                         input_pic->stride_y,
                         pcs_ptr->gm_ctrls.params_refinement_steps,
+                        pcs_ptr->gm_ctrls.sample_error_blocks,
                         best_warp_error);
                     if (warp_error < best_warp_error) {
                         best_warp_error = warp_error;
@@ -269,14 +270,16 @@ void compute_global_motion(PictureParentControlSet *pcs_ptr, EbPictureBufferDesc
             if (global_motion.wmtype == IDENTITY)
                 continue;
 
-            const int64_t ref_frame_error = svt_av1_frame_error(EB_FALSE,
-                                                                EB_8BIT,
-                                                                ref_buffer,
-                                                                ref_pic->stride_y,
-                                                                frm_buffer,
-                                                                input_pic->width,
-                                                                input_pic->height,
-                                                                input_pic->stride_y);
+            const int64_t ref_frame_error = svt_av1_frame_error(
+                EB_FALSE,
+                EB_8BIT,
+                ref_buffer,
+                ref_pic->stride_y,
+                frm_buffer,
+                input_pic->width,
+                input_pic->height,
+                input_pic->stride_y,
+                pcs_ptr->gm_ctrls.sample_error_blocks);
 
             if (ref_frame_error == 0)
                 continue;
@@ -564,10 +564,11 @@ void *initial_rate_control_kernel(void *input_ptr) {
             // Release Pa Ref pictures when not needed
             // Release Pa ref when
             //   1. TPL is OFF and
-            //   2. super-res mode is NONE or FIXED or RANDOM.
+            //   2. super-res mode is NONE or FIXED or RANDOM or DYNAMIC.
             //     For other super-res modes, pa_ref_objs are needed in TASK_SUPERRES_RE_ME task
             if (pcs_ptr->tpl_ctrls.enable == 0 &&
-                scs_ptr->static_config.superres_mode <= SUPERRES_RANDOM)
+                scs_ptr->static_config.superres_mode != SUPERRES_QTHRESH &&
+                scs_ptr->static_config.superres_mode != SUPERRES_AUTO)
                 release_pa_reference_objects(scs_ptr, pcs_ptr);
 
             /*In case Look-Ahead is zero there is no need to place pictures in the
@@ -5553,6 +5553,42 @@ void inject_zz_backup_candidate(
     (*candidate_total_cnt) = cand_total_cnt;
     }
 }
+/*
+   Inject the (0,0) MV of the closest reference for static SBs: GLOBALMV when the global motion of
+   the reference is the identity (cheapest to signal), else a zero NEWMV
+*/
+void inject_static_sb_candidate(
+    PictureControlSet          *pcs_ptr,
+    struct ModeDecisionContext *context_ptr,
+    uint32_t                   *candidate_total_cnt) {
+    ModeDecisionCandidate *cand_array = context_ptr->fast_candidate_array;
+    EbWarpedMotionParams  *gm_params = &pcs_ptr->parent_pcs_ptr->global_motion[LAST_FRAME];
+    uint32_t               cand_total_cnt = (*candidate_total_cnt);
+
+    if (gm_params->wmtype != IDENTITY) {
+        inject_zz_backup_candidate(pcs_ptr, context_ptr, candidate_total_cnt);
+        return;
+    }
+    cand_array[cand_total_cnt].type = INTER_MODE;
+    cand_array[cand_total_cnt].pred_mode = GLOBALMV;
+    cand_array[cand_total_cnt].motion_mode = SIMPLE_TRANSLATION;
+    cand_array[cand_total_cnt].wm_params_l0 = *gm_params;
+    cand_array[cand_total_cnt].wm_params_l1 = *gm_params;
+    cand_array[cand_total_cnt].is_compound = 0;
+    cand_array[cand_total_cnt].use_intrabc = 0;
+    cand_array[cand_total_cnt].skip_mode_allowed = EB_FALSE;
+    cand_array[cand_total_cnt].prediction_direction[0] = (EbPredDirection)0;
+    cand_array[cand_total_cnt].motion_vector_xl0 = 0;
+    cand_array[cand_total_cnt].motion_vector_yl0 = 0;
+    cand_array[cand_total_cnt].drl_index = 0;
+    cand_array[cand_total_cnt].ref_frame_type = LAST_FRAME;
+    cand_array[cand_total_cnt].transform_type[0] = DCT_DCT;
+    cand_array[cand_total_cnt].transform_type_uv = DCT_DCT;
+    cand_array[cand_total_cnt].is_interintra_used = 0;
+    INC_MD_CAND_CNT(cand_total_cnt, pcs_ptr->parent_pcs_ptr->max_can_count);
+    // update the total number of candidates injected
+    (*candidate_total_cnt) = cand_total_cnt;
+}
 int svt_av1_allow_palette(int allow_palette,
     BlockSize sb_type) {
     assert(sb_type < BlockSizeS_ALL);
@@ -5729,6 +5765,12 @@ void generate_md_stage_0_cand_light_pd1(
     context_ptr->injected_mv_count_l1 = 0;
     context_ptr->injected_mv_count_bipred = 0;
     context_ptr->inject_new_me = 1;
+    // Static SBs only test the (0,0) MV of the closest reference
+    if (context_ptr->static_sb) {
+        inject_static_sb_candidate(pcs_ptr, context_ptr, &cand_total_cnt);
+        *candidate_total_count_ptr = cand_total_cnt;
+        return;
+    }
     //----------------------
     // Intra
     if (context_ptr->intra_ctrls.enable_intra && context_ptr->blk_geom->sq_size < 128) {
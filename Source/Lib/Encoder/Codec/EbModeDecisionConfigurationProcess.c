@@ -309,6 +309,7 @@ void mode_decision_configuration_init_qp_update(PictureControlSet *pcs_ptr) {
     FrameHeader *frm_hdr      = &pcs_ptr->parent_pcs_ptr->frm_hdr;
     pcs_ptr->intra_coded_area = 0;
     pcs_ptr->skip_coded_area  = 0;
+    pcs_ptr->static_sb_count  = 0;
     // Init block selection
     // Set reference sg ep
     set_reference_sg_ep(pcs_ptr);
@@ -1388,6 +1389,8 @@ void *mode_decision_configuration_kernel(void *input_ptr) {
 
         pcs_ptr->intra_coded_area = 0;
         pcs_ptr->skip_coded_area  = 0;
+        pcs_ptr->static_sb_count  = 0;
+    pcs_ptr->static_sb_count  = 0;
         // Init block selection
         // Set reference sg ep
         set_reference_sg_ep(pcs_ptr);
@@ -1479,8 +1482,11 @@ void *mode_decision_configuration_kernel(void *input_ptr) {
                 svt_av1_crc_calculator_init(&pcs_ptr->crc_calculator1, 24, 0x5D6DCB);
                 svt_av1_crc_calculator_init(&pcs_ptr->crc_calculator2, 24, 0x864CFB);
 
-                svt_av1_generate_block_2x2_hash_value(
-                    &cpi_source, block_hash_values[0], is_block_same[0], pcs_ptr);
+                svt_av1_generate_block_2x2_hash_value(&cpi_source,
+                                                      block_hash_values[0],
+                                                      is_block_same[0],
+                                                      &pcs_ptr->crc_calculator1,
+                                                      &pcs_ptr->crc_calculator2);
                 uint8_t       src_idx = 0;
                 const uint8_t max_sb_size =
                     pcs_ptr->parent_pcs_ptr->intraBC_ctrls.max_block_size_hash;
@@ -1492,7 +1498,8 @@ void *mode_decision_configuration_kernel(void *input_ptr) {
                                                       block_hash_values[dst_idx],
                                                       is_block_same[src_idx],
                                                       is_block_same[dst_idx],
-                                                      pcs_ptr);
+                                                      &pcs_ptr->crc_calculator1,
+                                                      &pcs_ptr->crc_calculator2);
                     if (size != 4 || pcs_ptr->parent_pcs_ptr->intraBC_ctrls.hash_4x4_blocks)
                         rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(
                             &pcs_ptr->hash_table,
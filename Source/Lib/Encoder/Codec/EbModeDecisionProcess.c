@@ -32,6 +32,8 @@ static void mode_decision_context_dctor(EbPtr p) {
         EB_FREE_ARRAY(obj->palette_size_array_0);
     if (obj->palette_size_array_1)
         EB_FREE_ARRAY(obj->palette_size_array_1);
+    if (obj->palette_unit_colors)
+        EB_FREE_ARRAY(obj->palette_unit_colors);
     EB_FREE_ARRAY(obj->ref_best_ref_sq_table);
     EB_FREE_ARRAY(obj->ref_best_cost_sq_table);
     for (CandClass cand_class_it = CAND_CLASS_0; cand_class_it < CAND_CLASS_TOTAL; cand_class_it++)
@@ -132,7 +134,8 @@ EbErrorType mode_decision_context_ctor(ModeDecisionContext *context_ptr, EbColor
                                        uint32_t encoder_bit_depth,
                                        EbFifo  *mode_decision_configuration_input_fifo_ptr,
                                        EbFifo  *mode_decision_output_fifo_ptr,
-                                       uint8_t enable_hbd_mode_decision, uint8_t cfg_palette) {
+                                       uint8_t enable_hbd_mode_decision, uint8_t cfg_palette,
+                                       uint8_t speed_control) {
     uint32_t buffer_index;
     uint32_t cand_index;
 
@@ -220,6 +223,12 @@ EbErrorType mode_decision_context_ctor(ModeDecisionContext *context_ptr, EbColor
     // MD palette search
     EB_MALLOC_ARRAY(context_ptr->palette_size_array_0, MAX_PAL_CAND);
     EB_MALLOC_ARRAY(context_ptr->palette_size_array_1, MAX_PAL_CAND);
+    if (cfg_palette)
+        EB_MALLOC_ARRAY(context_ptr->palette_unit_colors,
+                        (sb_size >> 3) * (sb_size >> 3) *
+                            ((1 << MAX(encoder_bit_depth, EB_8BIT)) >> 6));
+    else
+        context_ptr->palette_unit_colors = NULL;
 
     // Transform and Quantization Buffers
     EB_NEW(context_ptr->trans_quant_buffers_ptr, svt_trans_quant_buffers_ctor, sb_size);
@@ -318,7 +327,11 @@ EbErrorType mode_decision_context_ctor(ModeDecisionContext *context_ptr, EbColor
         context_ptr->md_blk_arr_nsq[coded_leaf_index].segment_id = 0;
         const BlockGeom *blk_geom = get_blk_geom_mds(coded_leaf_index);
 
-        if (get_bypass_encdec(enc_mode, context_ptr->hbd_mode_decision, encoder_bit_depth)) {
+        // Speed control may move pictures up to the fastest preset, which bypasses EncDec
+        if (get_bypass_encdec(enc_mode, context_ptr->hbd_mode_decision, encoder_bit_depth) ||
+            (speed_control &&
+             get_bypass_encdec(
+                 MAX_ENC_PRESET, context_ptr->hbd_mode_decision, encoder_bit_depth))) {
             EbPictureBufferDescInitData init_data;
 
             init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK;
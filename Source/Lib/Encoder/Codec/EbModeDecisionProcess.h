@@ -596,6 +596,10 @@ typedef struct ModeDecisionContext {
     // MD palette search
     uint8_t *palette_size_array_0;
     uint8_t *palette_size_array_1;
+    // Colour presence bitmaps of the 8x8 units of the current SB, built by the first palette
+    // search of the SB and used to count the colours of the 8x8-aligned blocks
+    uint64_t *palette_unit_colors;
+    uint8_t   palette_unit_colors_ready;
     // Entropy Coder
     MdEncPassCuData *md_ep_pipe_sb;
 
@@ -878,6 +882,8 @@ typedef struct ModeDecisionContext {
     COMPONENT_TYPE lpd1_chroma_comp; // chroma components to compensate at MDS3 of LPD1
     uint8_t        corrupted_mv_check;
     uint8_t        skip_pd0;
+    uint8_t
+        static_sb; // the SB did not change relative to the closest reference; coded as a single zero-MV 64x64 block without residual
     uint8_t
         scale_palette; //   when MD is done on 8bit, scale  palette colors to 10bit (valid when bypass is 1)
 
@@ -894,7 +900,7 @@ extern EbErrorType mode_decision_context_ctor(
     ModeDecisionContext *context_ptr, EbColorFormat color_format, uint8_t sb_size, uint8_t enc_mode,
     uint16_t max_block_cnt, uint32_t encoder_bit_depth,
     EbFifo *mode_decision_configuration_input_fifo_ptr, EbFifo *mode_decision_output_fifo_ptr,
-    uint8_t enable_hbd_mode_decision, uint8_t cfg_palette);
+    uint8_t enable_hbd_mode_decision, uint8_t cfg_palette, uint8_t speed_control);
 
 extern const EbAv1LambdaAssignFunc av1_lambda_assignment_function_table[4];
 
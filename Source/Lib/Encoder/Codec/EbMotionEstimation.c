@@ -1352,7 +1352,11 @@ void integer_search_b64(PictureParentControlSet *pcs_ptr, uint32_t b64_index, ui
             int16_t search_area_height_before_sr_reduction = search_area_height;
             int16_t search_area_width_before_sr_reduction  = search_area_width;
             uint64_t best_hme_sad = (uint64_t)~0;
-            if (context_ptr->me_early_exit_th) {
+            if (context_ptr->hash_me_hit[list_index][ref_pic_index]) {
+                // All the blocks of the 64x64 have a zero SAD at the search centre
+                search_area_width  = 1;
+                search_area_height = 1;
+            } else if (context_ptr->me_early_exit_th) {
                 if (context_ptr->zz_sad[list_index][ref_pic_index] <
                     (context_ptr->me_early_exit_th / 6)) {
                     search_area_width  = 1;
@@ -1783,6 +1787,16 @@ static void prehme_b64(PictureParentControlSet *pcs, uint32_t origin_x, uint32_t
             EbPictureBufferDesc *sixteenth_ref_pic = get_me_reference(
                 pcs, ctx, list_i, ref_i, 0, &dist, input_ptr->width, input_ptr->height);
 
+            if (ctx->hash_me_hit[list_i][ref_i]) {
+                // an exact hash match was found, no need to search
+                for (uint8_t sr_i = 0; sr_i < SEARCH_REGION_COUNT; sr_i++) {
+                    SearchInfo *prehme_data = &ctx->prehme_data[list_i][ref_i][sr_i];
+                    prehme_data->best_mv.as_mv.col = ctx->hash_me_mv_x[list_i][ref_i];
+                    prehme_data->best_mv.as_mv.row = ctx->hash_me_mv_y[list_i][ref_i];
+                    prehme_data->sad               = 0;
+                }
+                continue;
+            }
             if (ctx->temporal_layer_index > 0 || list_i == 0) {
 
                 uint32_t hme_sr_factor = get_scaled_picture_distance(dist);
@@ -1912,6 +1926,9 @@ static void hme_level0_b64(PictureParentControlSet *pcs, uint32_t origin_x, uint
         // Ref Picture Loop
         const uint8_t num_of_ref_pic_to_search = ctx->num_of_ref_pic_to_search[list_index];
         for (uint8_t ref_pic_index = 0; ref_pic_index < num_of_ref_pic_to_search; ++ref_pic_index) {
+            // The search centre of an exact hash match is set in set_final_seach_centre_sb()
+            if (ctx->hash_me_hit[list_index][ref_pic_index])
+                continue;
             // If me_early_exit_th is enabled, skip HME L0 for the current block if the zero-zero SAD is low
             if (ctx->me_early_exit_th) {
                 if (ctx->zz_sad[list_index][ref_pic_index] < (ctx->me_early_exit_th >> 2)) {
@@ -2017,6 +2034,8 @@ void hme_level1_b64(PictureParentControlSet *pcs, uint32_t origin_x, uint32_t or
         // Ref Picture Loop
         const uint8_t num_of_ref_pic_to_search = ctx->num_of_ref_pic_to_search[list_index];
         for (uint8_t ref_pic_index = 0; ref_pic_index < num_of_ref_pic_to_search; ++ref_pic_index) {
+            if (ctx->hash_me_hit[list_index][ref_pic_index])
+                continue;
             uint16_t             dist            = 0;
             EbPictureBufferDesc *quarter_ref_pic = get_me_reference(
                 pcs, ctx, list_index, ref_pic_index, 1, &dist, input_ptr->width, input_ptr->height);
@@ -2080,6 +2099,8 @@ static void hme_level2_b64(PictureParentControlSet *pcs, uint32_t origin_x, uint
         // Ref Picture Loop
         const uint8_t num_of_ref_pic_to_search = ctx->num_of_ref_pic_to_search[list_index];
         for (uint8_t ref_pic_index = 0; ref_pic_index < num_of_ref_pic_to_search; ++ref_pic_index) {
+            if (ctx->hash_me_hit[list_index][ref_pic_index])
+                continue;
             uint16_t             dist    = 0;
             EbPictureBufferDesc *ref_pic = get_me_reference(
                 pcs, ctx, list_index, ref_pic_index, 2, &dist, input_ptr->width, input_ptr->height);
@@ -2297,6 +2318,12 @@ void set_final_seach_centre_sb(PictureParentControlSet *pcs_ptr, MeContext *cont
                 x_search_center = 0;
                 y_search_center = 0;
             }
+            // An exact hash match cannot be beaten by the HME result
+            if (context_ptr->hash_me_hit[list_index][ref_pic_index]) {
+                x_search_center = context_ptr->hash_me_mv_x[list_index][ref_pic_index];
+                y_search_center = context_ptr->hash_me_mv_y[list_index][ref_pic_index];
+                hmeMvSad        = 0;
+            }
 
             //sc valid for all cases. 0,0 if hme not done.
             context_ptr->search_results[list_index][ref_pic_index].hme_sc_x = x_search_center;
@@ -2331,6 +2358,73 @@ void init_zz_sad(MeContext *ctx, uint32_t origin_x, uint32_t origin_y) {
         }
     }
 }
+/*******************************************
+ * Looks the 64x64 block up in the hash table of every reference and keeps the
+ * exact match with the shortest MV as the search centre of that reference
+ *******************************************/
+static void hash_me_b64(uint32_t origin_x, uint32_t origin_y, MeContext *ctx) {
+    if (ctx->me_type != ME_OPEN_LOOP || !ctx->hash_me_ctrls.enabled ||
+        ctx->block_width != BLOCK_SIZE_64 || ctx->block_height != BLOCK_SIZE_64)
+        return;
+    uint32_t hash_value1, hash_value2;
+    svt_av1_compute_block_hash_value(ctx->b64_src_ptr,
+                                     ctx->b64_src_stride,
+                                     BLOCK_SIZE_64,
+                                     &hash_value1,
+                                     &hash_value2,
+                                     0,
+                                     &ctx->crc_calculator1,
+                                     &ctx->crc_calculator2,
+                                     ctx->hash_value_buffer);
+    for (int list_i = REF_LIST_0; list_i < ctx->num_of_list_to_search; ++list_i) {
+        for (uint8_t ref_i = 0; ref_i < ctx->num_of_ref_pic_to_search[list_i]; ++ref_i) {
+            HashTable *ref_hash_table = ctx->ref_hash_table[list_i][ref_i];
+            if (ref_hash_table == NULL)
+                continue;
+            const int32_t count = MIN(svt_av1_hash_table_count(ref_hash_table, hash_value1),
+                                      ctx->hash_me_ctrls.max_cands);
+            if (count == 0)
+                continue;
+            Iterator iterator = svt_av1_hash_get_first_iterator(ref_hash_table, hash_value1);
+            int32_t  best_len = INT32_MAX;
+            for (int32_t i = 0; i < count && best_len; i++, iterator_increment(&iterator)) {
+                const BlockHash *ref_block_hash = (BlockHash *)iterator_get(&iterator);
+                if (ref_block_hash->hash_value2 != hash_value2)
+                    continue;
+                const int16_t mv_x = ref_block_hash->x - (int16_t)origin_x;
+                const int16_t mv_y = ref_block_hash->y - (int16_t)origin_y;
+                const int32_t len  = ABS(mv_x) + ABS(mv_y);
+                if (len < best_len && check_mv_validity(mv_x, mv_y, 3)) {
+                    best_len                         = len;
+                    ctx->hash_me_mv_x[list_i][ref_i] = mv_x;
+                    ctx->hash_me_mv_y[list_i][ref_i] = mv_y;
+                    ctx->hash_me_hit[list_i][ref_i]  = 1;
+                }
+            }
+        }
+    }
+}
+/*******************************************
+ * Check whether the current 64x64 block did not change relative to the
+ * co-located block of the closest reference (list 0, index 0)
+ *******************************************/
+static EbBool is_static_b64(PictureParentControlSet *pcs_ptr, uint32_t origin_x, uint32_t origin_y,
+                            MeContext *ctx, EbPictureBufferDesc *input_ptr) {
+    if (ctx->block_width != BLOCK_SIZE_64 || ctx->block_height != BLOCK_SIZE_64)
+        return EB_FALSE;
+    uint16_t             dist    = 0;
+    EbPictureBufferDesc *ref_pic = get_me_reference(
+        pcs_ptr, ctx, REF_LIST_0, 0, 2, &dist, input_ptr->width, input_ptr->height);
+    const uint32_t ref_offset = (ref_pic->origin_x + origin_x) +
+        (ref_pic->origin_y + origin_y) * ref_pic->stride_y;
+    const uint32_t sad = svt_nxm_sad_kernel(ctx->b64_src_ptr,
+                                            ctx->b64_src_stride,
+                                            ref_pic->buffer_y + ref_offset,
+                                            ref_pic->stride_y,
+                                            BLOCK_SIZE_64,
+                                            BLOCK_SIZE_64);
+    return sad <= ctx->static_sb_ctrls.sad_th;
+}
 /*******************************************
  * performs hierarchical ME for a 64x64 block for every ref frame
  *******************************************/
@@ -2340,6 +2434,9 @@ void hme_b64(PictureParentControlSet *pcs_ptr, uint32_t origin_x, uint32_t origi
     if (context_ptr->me_early_exit_th)
         init_zz_sad(context_ptr, origin_x, origin_y);
 
+    if (!context_ptr->static_b64)
+        hash_me_b64(origin_x, origin_y, context_ptr);
+
     if (context_ptr->prehme_ctrl.enable) {
         // perform pre-HME
         prehme_b64(pcs_ptr, origin_x, origin_y, context_ptr, input_ptr);
@@ -2919,6 +3016,7 @@ static INLINE void init_me_hme_data(MeContext *context_ptr) {
             context_ptr->search_results[li][ri].hme_sad  = 0xFFFFFFFF;
             context_ptr->reduce_me_sr_divisor[li][ri] = 1;
             context_ptr->zz_sad[li][ri] = (uint32_t)~0;
+            context_ptr->hash_me_hit[li][ri] = 0;
         }
     }
 }
@@ -2952,8 +3050,26 @@ EbErrorType motion_estimation_b64(
     uint8_t prune_ref = context_ptr->enable_hme_flag && context_ptr->me_type != ME_MCTF;
     // Initialize ME/HME buffers
     init_me_hme_data(context_ptr);
+    // A static block is only evaluated at the (0,0) MV of the closest reference; it is coded as a
+    // zero-MV skip block at MD, so the other references are not searched
+    context_ptr->static_b64 = context_ptr->me_type == ME_OPEN_LOOP &&
+        context_ptr->static_sb_ctrls.enabled &&
+        is_static_b64(pcs_ptr, b64_origin_x, b64_origin_y, context_ptr, input_ptr);
+    if (context_ptr->me_type == ME_OPEN_LOOP)
+        pcs_ptr->static_sb[b64_index] = context_ptr->static_b64;
+    if (context_ptr->static_b64) {
+        // Use the exact-match path of the hash ME to skip pre-HME/HME and use a 1x1 ME search area
+        memset(context_ptr->hash_me_hit, 1, sizeof(context_ptr->hash_me_hit));
+        memset(context_ptr->hash_me_mv_x, 0, sizeof(context_ptr->hash_me_mv_x));
+        memset(context_ptr->hash_me_mv_y, 0, sizeof(context_ptr->hash_me_mv_y));
+    }
     // HME: Perform Hierachical Motion Estimation for all refrence frames for the current 64x64 block.
     hme_b64(pcs_ptr, b64_origin_x, b64_origin_y, context_ptr, input_ptr);
+    if (context_ptr->static_b64) {
+        for (uint32_t li = 0; li < MAX_NUM_OF_REF_PIC_LIST; li++)
+            for (uint32_t ri = 0; ri < REF_LIST_MAX_DEPTH; ri++)
+                context_ptr->search_results[li][ri].do_ref = (li == REF_LIST_0 && ri == 0);
+    }
 
     if (context_ptr->me_type == ME_MCTF &&
         context_ptr->search_results[0][0].hme_sad < context_ptr->tf_me_exit_th) {
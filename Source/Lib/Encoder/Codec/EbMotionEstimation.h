@@ -53,6 +53,16 @@ extern "C" {
         uint32_t                   decim_stride,
         uint32_t                   decim_step);
 
+    extern void downsample_2d_pyramid_c(
+        uint8_t                   *input_samples,
+        uint32_t                   input_stride,
+        uint32_t                   input_area_width,
+        uint32_t                   input_area_height,
+        uint8_t                   *quarter_samples,
+        uint32_t                   quarter_stride,
+        uint8_t                   *sixteenth_samples,
+        uint32_t                   sixteenth_stride);
+
     extern EbErrorType open_loop_intra_search_sb(
         PictureParentControlSet   *pcs_ptr,
         uint32_t                       sb_index,
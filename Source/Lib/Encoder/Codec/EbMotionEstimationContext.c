@@ -20,12 +20,20 @@ static void me_context_dctor(EbPtr p) {
 
     EB_FREE_ARRAY(obj->mvd_bits_array);
     EB_FREE_ARRAY(obj->p_eight_pos_sad16x16);
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++) EB_FREE_ARRAY(obj->hash_value_buffer[i][j]);
 }
 EbErrorType me_context_ctor(MeContext *object_ptr) {
     object_ptr->dctor = me_context_dctor;
 
     EB_MALLOC_ARRAY(object_ptr->p_eight_pos_sad16x16,
                     8 * 16); //16= 16 16x16 blocks in a SB.       8=8search points
+    for (int i = 0; i < 2; i++)
+        for (int j = 0; j < 2; j++)
+            EB_MALLOC_ARRAY(object_ptr->hash_value_buffer[i][j], AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
+    // same CRCs as the intra block copy hash tables
+    svt_av1_crc_calculator_init(&object_ptr->crc_calculator1, 24, 0x5D6DCB);
+    svt_av1_crc_calculator_init(&object_ptr->crc_calculator2, 24, 0x864CFB);
 
     // Initialize Alt-Ref parameters
     object_ptr->me_type                     = ME_CLOSE_LOOP;
@@ -16,6 +16,7 @@
 #include "EbMdRateEstimation.h"
 #include "EbCodingUnit.h"
 #include "EbObject.h"
+#include "hash_motion.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -327,6 +328,15 @@ typedef struct MeHmeSearchAreaCtrls {
     SearchArea       hme_l2_sa[SEARCH_REGION_COUNT];
     SearchAreaMinMax me_sa[SEARCH_REGION_COUNT];
 } MeHmeSearchAreaCtrls;
+typedef struct HashMeCtrls {
+    uint8_t enabled; // use exact 64x64 hash matches in the references as ME search centres
+    uint8_t incremental_build; // build a reference's hashes from an older reference's where the source did not change
+    uint16_t max_cands; // max number of hash table entries checked per reference and 64x64 block
+} HashMeCtrls;
+typedef struct StaticSbCtrls {
+    uint8_t  enabled; // detect the 64x64 blocks that did not change relative to the closest reference
+    uint32_t sad_th; // max 64x64 SAD vs. the co-located block of the closest reference; 0: bit-identical only
+} StaticSbCtrls;
 typedef struct SearchResults {
     uint8_t  list_i; // list index of this ref
     uint8_t  ref_i; // ref list index of this ref
@@ -476,6 +486,18 @@ typedef struct MeContext {
     uint8_t      bypass_blk_step;
     uint32_t     block_width;
     uint32_t     block_height;
+    // hash based ME (screen content)
+    HashMeCtrls    hash_me_ctrls;
+    HashTable     *ref_hash_table[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+    uint8_t        hash_me_hit[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+    int16_t        hash_me_mv_x[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+    int16_t        hash_me_mv_y[MAX_NUM_OF_REF_PIC_LIST][REF_LIST_MAX_DEPTH];
+    CRC_CALCULATOR crc_calculator1;
+    CRC_CALCULATOR crc_calculator2;
+    uint32_t      *hash_value_buffer[2][2];
+    // static 64x64 block detection (screen content)
+    StaticSbCtrls static_sb_ctrls;
+    uint8_t       static_b64; // the current 64x64 block is static relative to the closest reference
 } MeContext;
 
 typedef uint64_t (*EB_ME_DISTORTION_FUNC)(uint8_t *src, uint32_t src_stride, uint8_t *ref,
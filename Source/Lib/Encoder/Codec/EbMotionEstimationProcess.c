@@ -422,6 +422,41 @@ void set_prehme_ctrls(MeContext *context, uint8_t level) {
     default: assert(0); break;
     }
 }
+/*configure hash based ME control*/
+void set_hash_me_ctrls(MeContext *context, uint8_t level) {
+    HashMeCtrls *ctrl = &context->hash_me_ctrls;
+
+    switch (level) {
+    case 0: ctrl->enabled = 0; break;
+    case 1:
+        ctrl->enabled           = 1;
+        ctrl->incremental_build = 0;
+        ctrl->max_cands         = 256;
+        break;
+    case 2:
+        ctrl->enabled           = 1;
+        ctrl->incremental_build = 1;
+        ctrl->max_cands         = 256;
+        break;
+    default: assert(0); break;
+    }
+}
+void set_static_sb_ctrls(MeContext *context, uint8_t level) {
+    StaticSbCtrls *ctrl = &context->static_sb_ctrls;
+
+    switch (level) {
+    case 0: ctrl->enabled = 0; break;
+    case 1:
+        ctrl->enabled = 1;
+        ctrl->sad_th  = 0;
+        break;
+    case 2:
+        ctrl->enabled = 1;
+        ctrl->sad_th  = BLOCK_SIZE_64 * BLOCK_SIZE_64 / 8;
+        break;
+    default: assert(0); break;
+    }
+}
 /******************************************************
 * Derive ME Settings for OQ
   Input   : encoder mode and tune
@@ -483,6 +518,14 @@ EbErrorType signal_derivation_me_kernel_oq(SequenceControlSet *       scs_ptr,
         prehme_level = 0;
 
     set_prehme_ctrls(context_ptr->me_context_ptr, prehme_level);
+    // Set hash based ME level (0-2)
+    set_hash_me_ctrls(context_ptr->me_context_ptr, pcs_ptr->sc_class1 ? 2 : 0);
+    // Set static SB detection level (0-2); only bit-identical blocks are skipped in reference pictures
+    // so that the small changes of near-identical blocks do not propagate
+    uint8_t static_sb_level = 0;
+    if (pcs_ptr->sc_class1 && !pcs_ptr->frame_superres_enabled)
+        static_sb_level = pcs_ptr->is_used_as_reference_flag ? 1 : 2;
+    set_static_sb_ctrls(context_ptr->me_context_ptr, static_sb_level);
 
     // Set hme/me based reference pruning level (0-4)
     if (pcs_ptr->sc_class1) {
@@ -661,6 +704,215 @@ EbErrorType motion_estimation_context_ctor(EbThreadContext *  thread_context_ptr
  * to the prediction structure pattern.  The Motion Analysis process is multithreaded,
  * so pictures can be processed out of order as long as all inputs are available.
  ************************************************/
+#define HASH_ME_UNIT 8 // size of the units compared by the incremental hash build
+#define HASH_ME_BLOCK ((int)BLOCK_SIZE_64)
+/* Flag the 8x8 units of pic that differ from base, return the number of changed units */
+static uint32_t get_changed_units(EbPictureBufferDesc *pic, EbPictureBufferDesc *base,
+                                  uint8_t *changed, uint32_t unit_cols, uint32_t unit_rows) {
+    uint32_t changed_count = 0;
+    for (uint32_t uy = 0; uy < unit_rows; uy++) {
+        const uint32_t y = uy * HASH_ME_UNIT;
+        const uint32_t h = MIN(HASH_ME_UNIT, pic->height - y);
+        for (uint32_t ux = 0; ux < unit_cols; ux++) {
+            const uint32_t x     = ux * HASH_ME_UNIT;
+            const uint32_t w     = MIN(HASH_ME_UNIT, pic->width - x);
+            const uint8_t *src   = pic->buffer_y + (pic->origin_y + y) * pic->stride_y +
+                pic->origin_x + x;
+            const uint8_t *ref   = base->buffer_y + (base->origin_y + y) * base->stride_y +
+                base->origin_x + x;
+            uint8_t        is_changed = 0;
+            for (uint32_t i = 0; i < h && !is_changed; i++)
+                is_changed = memcmp(src + i * pic->stride_y, ref + i * base->stride_y, w) != 0;
+            changed[uy * unit_cols + ux] = is_changed;
+            changed_count += is_changed;
+        }
+    }
+    return changed_count;
+}
+/* Hash again the 64x64 blocks at the positions [x0, x1] x [y0, y1] of ref */
+static EbErrorType update_hash_rect(EbPaReferenceObject *ref, MeContext *me_ctx, int x0, int y0,
+                                    int x1, int y1) {
+    EbPictureBufferDesc *pic = ref->input_padded_picture_ptr;
+    // Keep the positions aligned as in a full build, the aligned positions of flat areas
+    // are the only ones added to the table
+    x0 &= ~(HASH_ME_BLOCK - 1);
+    y0 &= ~(HASH_ME_BLOCK - 1);
+    const int        cols = x1 - x0 + 1;
+    const int        rows = y1 - y0 + 1;
+    Yv12BufferConfig rect;
+    link_eb_to_aom_buffer_desc_8bit(pic, &rect);
+    rect.y_buffer += y0 * rect.y_stride + x0;
+    rect.y_crop_width  = cols + HASH_ME_BLOCK - 1;
+    rect.y_crop_height = rows + HASH_ME_BLOCK - 1;
+
+    const size_t size    = (size_t)rect.y_crop_width * rect.y_crop_height;
+    uint32_t    *hash[2] = {malloc(sizeof(uint32_t) * size), malloc(sizeof(uint32_t) * size)};
+    int8_t      *added   = malloc(sizeof(int8_t) * size);
+    EbErrorType  return_error = EB_ErrorInsufficientResources;
+    if (hash[0] && hash[1] && added)
+        return_error = rtime_alloc_svt_av1_generate_pic_block_hash(
+            &rect, HASH_ME_BLOCK, hash, added, &me_ctx->crc_calculator1, &me_ctx->crc_calculator2);
+    if (return_error == EB_ErrorNone) {
+        for (int y = 0; y < rows; y++) {
+            const size_t dst = (size_t)(y0 + y) * pic->width + x0;
+            const size_t src = (size_t)y * rect.y_crop_width;
+            memcpy(ref->block_hash[0] + dst, hash[0] + src, sizeof(uint32_t) * cols);
+            memcpy(ref->block_hash[1] + dst, hash[1] + src, sizeof(uint32_t) * cols);
+            memcpy(ref->block_hash_added + dst, added + src, sizeof(int8_t) * cols);
+        }
+    }
+    free(hash[0]);
+    free(hash[1]);
+    free(added);
+    return return_error;
+}
+/* Build the 64x64 block hash table of ref. When base, an older reference with valid
+   hashes, is given only the blocks covering a change between the two sources are hashed */
+static EbErrorType build_pa_ref_hash(EbPaReferenceObject *ref, EbPaReferenceObject *base,
+                                     MeContext *me_ctx) {
+    EbPictureBufferDesc *pic  = ref->input_padded_picture_ptr;
+    const int            w    = pic->width;
+    const int            h    = pic->height;
+    const size_t         size = (size_t)w * h;
+    EbErrorType          return_error = EB_ErrorNone;
+
+    if (w < HASH_ME_BLOCK || h < HASH_ME_BLOCK)
+        return EB_ErrorBadParameter;
+    if (ref->block_hash_added == NULL) {
+        ref->block_hash[0]    = malloc(sizeof(uint32_t) * size);
+        ref->block_hash[1]    = malloc(sizeof(uint32_t) * size);
+        ref->block_hash_added = malloc(sizeof(int8_t) * size);
+        if (!ref->block_hash[0] || !ref->block_hash[1] || !ref->block_hash_added) {
+            free(ref->block_hash[0]);
+            free(ref->block_hash[1]);
+            free(ref->block_hash_added);
+            ref->block_hash[0] = ref->block_hash[1] = NULL;
+            ref->block_hash_added                   = NULL;
+            return EB_ErrorInsufficientResources;
+        }
+    }
+    EbBool full_build = base == NULL;
+    if (!full_build) {
+        const uint32_t unit_cols = (w + HASH_ME_UNIT - 1) / HASH_ME_UNIT;
+        const uint32_t unit_rows = (h + HASH_ME_UNIT - 1) / HASH_ME_UNIT;
+        uint8_t       *changed   = malloc(unit_cols * unit_rows);
+        // Past a quarter of the picture the rectangles cost about as much as a full build
+        if (changed == NULL ||
+            get_changed_units(pic, base->input_padded_picture_ptr, changed, unit_cols, unit_rows) *
+                    4 >
+                unit_cols * unit_rows)
+            full_build = EB_TRUE;
+        else {
+            memcpy(ref->block_hash[0], base->block_hash[0], sizeof(uint32_t) * size);
+            memcpy(ref->block_hash[1], base->block_hash[1], sizeof(uint32_t) * size);
+            memcpy(ref->block_hash_added, base->block_hash_added, sizeof(int8_t) * size);
+            // Merge the positions touched by the changed units of consecutive unit rows into
+            // rectangles
+            int rect_x0 = 0, rect_x1 = 0, rect_y0 = -1, rect_y1 = 0;
+            for (uint32_t uy = 0; uy < unit_rows && return_error == EB_ErrorNone; uy++) {
+                int col_min = (int)unit_cols, col_max = -1;
+                for (uint32_t ux = 0; ux < unit_cols; ux++) {
+                    if (changed[uy * unit_cols + ux]) {
+                        col_min = MIN(col_min, (int)ux);
+                        col_max = (int)ux;
+                    }
+                }
+                if (col_max < 0)
+                    continue;
+                const int y0 = MAX(0, (int)uy * HASH_ME_UNIT - HASH_ME_BLOCK + 1);
+                const int y1 = MIN(h - HASH_ME_BLOCK, (int)uy * HASH_ME_UNIT + HASH_ME_UNIT - 1);
+                const int x0 = MAX(0, col_min * HASH_ME_UNIT - HASH_ME_BLOCK + 1);
+                const int x1 = MIN(w - HASH_ME_BLOCK, col_max * HASH_ME_UNIT + HASH_ME_UNIT - 1);
+                if (rect_y0 >= 0 && y0 <= rect_y1 + 1) {
+                    rect_x0 = MIN(rect_x0, x0);
+                    rect_x1 = MAX(rect_x1, x1);
+                    rect_y1 = y1;
+                    continue;
+                }
+                if (rect_y0 >= 0)
+                    return_error = update_hash_rect(ref, me_ctx, rect_x0, rect_y0, rect_x1, rect_y1);
+                rect_x0 = x0;
+                rect_x1 = x1;
+                rect_y0 = y0;
+                rect_y1 = y1;
+            }
+            if (rect_y0 >= 0 && return_error == EB_ErrorNone)
+                return_error = update_hash_rect(ref, me_ctx, rect_x0, rect_y0, rect_x1, rect_y1);
+        }
+        free(changed);
+    }
+    if (full_build) {
+        Yv12BufferConfig src;
+        link_eb_to_aom_buffer_desc_8bit(pic, &src);
+        return_error = rtime_alloc_svt_av1_generate_pic_block_hash(&src,
+                                                                   HASH_ME_BLOCK,
+                                                                   ref->block_hash,
+                                                                   ref->block_hash_added,
+                                                                   &me_ctx->crc_calculator1,
+                                                                   &me_ctx->crc_calculator2);
+    }
+    if (return_error == EB_ErrorNone)
+        return_error = rtime_alloc_svt_av1_hash_table_create(&ref->hash_table);
+    if (return_error == EB_ErrorNone)
+        rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(
+            &ref->hash_table, ref->block_hash, ref->block_hash_added, w, h, HASH_ME_BLOCK);
+    return return_error;
+}
+/* Set the hash tables of the PA references used by hash based ME, building the missing ones.
+   The references are built from the oldest so that each one can start from the previous one */
+static void prepare_ref_hash_tables(PictureParentControlSet *pcs_ptr, MeContext *me_ctx,
+                                    EbPictureBufferDesc *input_picture_ptr) {
+    struct {
+        EbPaReferenceObject *obj;
+        uint8_t              list_i;
+        uint8_t              ref_i;
+    } refs[MAX_NUM_OF_REF_PIC_LIST * REF_LIST_MAX_DEPTH], tmp;
+    uint8_t num_refs = 0;
+
+    for (uint8_t list_i = 0; list_i < (pcs_ptr->slice_type == P_SLICE ? 1 : 2); list_i++) {
+        const uint8_t num_of_ref_pic = list_i ? pcs_ptr->ref_list1_count_try
+                                              : pcs_ptr->ref_list0_count_try;
+        for (uint8_t ref_i = 0; ref_i < num_of_ref_pic; ref_i++) {
+            EbPaReferenceObject *obj = (EbPaReferenceObject *)
+                                           pcs_ptr->ref_pa_pic_ptr_array[list_i][ref_i]
+                                               ->object_ptr;
+            me_ctx->ref_hash_table[list_i][ref_i] = NULL;
+            if (obj->input_padded_picture_ptr->width != input_picture_ptr->width ||
+                obj->input_padded_picture_ptr->height != input_picture_ptr->height)
+                continue;
+            int i = num_refs++;
+            for (; i > 0 && refs[i - 1].obj->picture_number > obj->picture_number; i--)
+                refs[i] = refs[i - 1];
+            tmp.obj    = obj;
+            tmp.list_i = list_i;
+            tmp.ref_i  = ref_i;
+            refs[i]    = tmp;
+        }
+    }
+    EbPaReferenceObject *base = NULL;
+    for (uint8_t i = 0; i < num_refs; i++) {
+        EbPaReferenceObject *obj = refs[i].obj;
+        svt_block_on_mutex(obj->hash_mutex);
+        if (obj->hash_picture_number != obj->picture_number) {
+            // Always lock the older picture second
+            EbBool use_base = base && base->picture_number < obj->picture_number &&
+                me_ctx->hash_me_ctrls.incremental_build;
+            if (use_base)
+                svt_block_on_mutex(base->hash_mutex);
+            obj->hash_picture_number = build_pa_ref_hash(obj, use_base ? base : NULL, me_ctx) ==
+                    EB_ErrorNone
+                ? obj->picture_number
+                : (uint64_t)~0;
+            if (use_base)
+                svt_release_mutex(base->hash_mutex);
+        }
+        if (obj->hash_picture_number == obj->picture_number) {
+            me_ctx->ref_hash_table[refs[i].list_i][refs[i].ref_i] = &obj->hash_table;
+            base                                                  = obj;
+        }
+        svt_release_mutex(obj->hash_mutex);
+    }
+}
 void *motion_estimation_kernel(void *input_ptr) {
     EbThreadContext *          thread_context_ptr = (EbThreadContext *)input_ptr;
     MotionEstimationContext_t *context_ptr = (MotionEstimationContext_t *)thread_context_ptr->priv;
@@ -735,6 +987,12 @@ void *motion_estimation_kernel(void *input_ptr) {
                 (!pcs_ptr->is_used_as_reference_flag && scs_ptr->rc_stat_gen_pass_mode &&
                  !pcs_ptr->first_frame_in_minigop))
                 skip_me = EB_TRUE;
+            // The static SB flags are set by motion_estimation_b64(), so clear them when ME is skipped
+            if (skip_me)
+                for (uint32_t y_b64_index = y_b64_start_index; y_b64_index < y_b64_end_index; ++y_b64_index)
+                    memset(&pcs_ptr->static_sb[x_b64_start_index + y_b64_index * pic_width_in_b64],
+                           0,
+                           x_b64_end_index - x_b64_start_index);
             // skip me for the first pass. ME is already performed
             if (!skip_me) {
                 if (pcs_ptr->slice_type != I_SLICE) {
@@ -745,6 +1003,14 @@ void *motion_estimation_kernel(void *input_ptr) {
                                                      &input_padded_picture_ptr,
                                                      &quarter_picture_ptr,
                                                      &sixteenth_picture_ptr);
+                    if (context_ptr->me_context_ptr->hash_me_ctrls.enabled &&
+                        !pcs_ptr->frame_superres_enabled)
+                        prepare_ref_hash_tables(
+                            pcs_ptr, context_ptr->me_context_ptr, input_picture_ptr);
+                    else
+                        memset(context_ptr->me_context_ptr->ref_hash_table,
+                               0,
+                               sizeof(context_ptr->me_context_ptr->ref_hash_table));
 
                     // 64x64 Block Loop
                     for (uint32_t y_b64_index = y_b64_start_index; y_b64_index < y_b64_end_index; ++y_b64_index) {
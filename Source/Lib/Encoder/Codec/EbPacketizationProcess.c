@@ -307,6 +307,69 @@ static void collect_frames_info(PacketizationContext *context_ptr,
     }
 }
 
+// Dynamic super-res: a decision is taken every mini-GOP worth of frames. The
+// denominator is raised by one step when the encoder is falling further behind
+// real time, or when rate control hits the max q on at least half of the frames
+// of the window, and lowered by one step once the lag is gone and the max q was
+// not reached.
+#define DYN_SUPERRES_STEP 2
+#define DYN_SUPERRES_MAX_DENOM 16
+#define DYN_SUPERRES_LAG_DOWN 8 // lag, in frames, above which the resolution is dropped
+#define DYN_SUPERRES_LAG_UP 1 // lag, in frames, below which the resolution is restored
+static void update_dynamic_superres(SequenceControlSet *scs_ptr, PictureControlSet *pcs_ptr,
+                                    EncodeContext *encode_context_ptr) {
+    uint64_t now_s, now_us;
+    svt_av1_get_time(&now_s, &now_us);
+    if (encode_context_ptr->dyn_superres_frames == 0) {
+        encode_context_ptr->dyn_superres_start_s  = now_s;
+        encode_context_ptr->dyn_superres_start_us = now_us;
+    }
+    // Lag of the output against real time; when the encoder is ahead, the reference point
+    // is moved so that the spare time is not banked for later
+    const double frame_ms = 1000.0 * scs_ptr->static_config.frame_rate_denominator /
+        scs_ptr->static_config.frame_rate_numerator;
+    const double lag_ms   = svt_av1_compute_overall_elapsed_time_ms(
+                              encode_context_ptr->dyn_superres_start_s,
+                              encode_context_ptr->dyn_superres_start_us,
+                              now_s,
+                              now_us) -
+        encode_context_ptr->dyn_superres_frames * frame_ms;
+    if (lag_ms < 0) {
+        encode_context_ptr->dyn_superres_start_s  = now_s;
+        encode_context_ptr->dyn_superres_start_us = now_us;
+        encode_context_ptr->dyn_superres_frames   = 0;
+    }
+    encode_context_ptr->dyn_superres_frames++;
+
+    encode_context_ptr->dyn_superres_window_frames++;
+    if (scs_ptr->static_config.rate_control_mode &&
+        pcs_ptr->parent_pcs_ptr->frm_hdr.quantization_params.base_q_idx >=
+            quantizer_to_qindex[scs_ptr->static_config.max_qp_allowed])
+        encode_context_ptr->dyn_superres_max_q_frames++;
+
+    if (encode_context_ptr->dyn_superres_window_frames <
+        (1u << scs_ptr->static_config.hierarchical_levels))
+        return;
+
+    const EbBool behind = lag_ms > DYN_SUPERRES_LAG_DOWN * frame_ms &&
+        lag_ms > encode_context_ptr->dyn_superres_last_lag_ms;
+    const EbBool starved = 2 * encode_context_ptr->dyn_superres_max_q_frames >=
+        encode_context_ptr->dyn_superres_window_frames;
+    uint8_t denom = encode_context_ptr->dyn_superres_denom;
+    if (behind || starved)
+        denom = MIN(denom + DYN_SUPERRES_STEP, DYN_SUPERRES_MAX_DENOM);
+    else if (lag_ms < DYN_SUPERRES_LAG_UP * frame_ms &&
+             encode_context_ptr->dyn_superres_max_q_frames == 0)
+        denom = MAX(denom - DYN_SUPERRES_STEP, SCALE_NUMERATOR);
+    svt_block_on_mutex(encode_context_ptr->dyn_superres_mutex);
+    encode_context_ptr->dyn_superres_denom = denom;
+    svt_release_mutex(encode_context_ptr->dyn_superres_mutex);
+
+    encode_context_ptr->dyn_superres_last_lag_ms   = lag_ms;
+    encode_context_ptr->dyn_superres_window_frames = 0;
+    encode_context_ptr->dyn_superres_max_q_frames  = 0;
+}
+
 #define TD_SIZE 2
 
 //a tu start with a td, + 0 more not displable frame, + 1 display frame
@@ -666,6 +729,15 @@ void *packetization_kernel(void *input_ptr) {
             }
         }
 
+        // Static SB statistics, reported at the end of the encode
+        if (pcs_ptr->slice_type != I_SLICE) {
+            encode_context_ptr->static_sb_count += pcs_ptr->static_sb_count;
+            encode_context_ptr->inter_sb_count += pcs_ptr->sb_total_count;
+        }
+        if (scs_ptr->static_config.superres_mode == SUPERRES_DYNAMIC &&
+            !pcs_ptr->parent_pcs_ptr->is_overlay)
+            update_dynamic_superres(scs_ptr, pcs_ptr, encode_context_ptr);
+
         //****************************************************
         // Input Entropy Results into Reordering Queue
         //****************************************************
@@ -709,7 +781,10 @@ void *packetization_kernel(void *input_ptr) {
                  ? pcs_ptr->parent_pcs_ptr->idr_flag ? EB_AV1_KEY_PICTURE : pcs_ptr->slice_type
                  : EB_AV1_NON_REF_PICTURE;
         output_stream_ptr->p_app_private = pcs_ptr->parent_pcs_ptr->input_ptr->p_app_private;
+        if (pcs_ptr->parent_pcs_ptr->ext_rc_params)
+            EB_FREE(pcs_ptr->parent_pcs_ptr->ext_rc_params);
         output_stream_ptr->qp            = pcs_ptr->parent_pcs_ptr->picture_qp;
+        output_stream_ptr->enc_mode      = pcs_ptr->parent_pcs_ptr->enc_mode;
 
         if (scs_ptr->static_config.stat_report) {
             output_stream_ptr->luma_sse  = pcs_ptr->parent_pcs_ptr->luma_sse;
@@ -892,7 +967,7 @@ void *packetization_kernel(void *input_ptr) {
             pcs_ptr->parent_pcs_ptr->data_ll_head_ptr = app_data_ll_head_temp_ptr;
         }
 
-        if (scs_ptr->speed_control_flag) {
+        if (scs_ptr->speed_control_flag && !pcs_ptr->parent_pcs_ptr->is_overlay) {
             // update speed control variables
             svt_block_on_mutex(encode_context_ptr->sc_buffer_mutex);
             encode_context_ptr->sc_frame_out++;
@@ -62,11 +62,15 @@ typedef struct PictureAnalysisContext {
     EB_ALIGN(64) uint8_t local_cache[64];
     EbFifo *resource_coordination_results_input_fifo_ptr;
     EbFifo *picture_analysis_results_output_fifo_ptr;
+    // Film grain denoiser and noise model, created on first use and kept for
+    // the pictures processed by this thread
+    AomDenoiseAndModel *denoise_and_model;
 } PictureAnalysisContext;
 
 static void picture_analysis_context_dctor(EbPtr p) {
     EbThreadContext        *thread_context_ptr = (EbThreadContext *)p;
     PictureAnalysisContext *obj                = (PictureAnalysisContext *)thread_context_ptr->priv;
+    EB_DELETE(obj->denoise_and_model);
     EB_FREE_ARRAY(obj);
 }
 /************************************************
@@ -218,6 +222,52 @@ void downsample_2d_c(uint8_t *input_samples, // input parameter, input samples P
     return;
 }
 
+/********************************************
+ * downsample_2d_pyramid
+ *      builds the 1/4 and 1/16 pictures in a single pass over the input:
+ *      each 1/16 row is filtered from the two 1/4 rows just produced, while
+ *      they are still in cache. Same output as two cascaded downsample_2d
+ *      calls with a decimation step of 2.
+ ********************************************/
+void downsample_2d_pyramid_c(uint8_t *input_samples, // input parameter, input samples Ptr
+                             uint32_t input_stride, // input parameter, input stride
+                             uint32_t input_area_width, // input parameter, input area width
+                             uint32_t input_area_height, // input parameter, input area height
+                             uint8_t *quarter_samples, // output parameter, 1/4 samples Ptr
+                             uint32_t quarter_stride, // input parameter, 1/4 stride
+                             uint8_t *sixteenth_samples, // output parameter, 1/16 samples Ptr
+                             uint32_t sixteenth_stride) // input parameter, 1/16 stride
+{
+    const uint32_t quarter_width  = input_area_width >> 1;
+    const uint32_t quarter_height = input_area_height >> 1;
+
+    for (uint32_t vertical_index = 0; vertical_index < quarter_height; vertical_index++) {
+        const uint8_t *prev_input_line = input_samples + 2 * vertical_index * input_stride;
+        const uint8_t *input_line      = prev_input_line + input_stride;
+        uint8_t       *quarter_line    = quarter_samples + vertical_index * quarter_stride;
+        for (uint32_t horizontal_index = 0; horizontal_index < quarter_width; horizontal_index++) {
+            const uint32_t sum = (uint32_t)prev_input_line[2 * horizontal_index] +
+                (uint32_t)prev_input_line[2 * horizontal_index + 1] +
+                (uint32_t)input_line[2 * horizontal_index] +
+                (uint32_t)input_line[2 * horizontal_index + 1];
+            quarter_line[horizontal_index] = (sum + 2) >> 2;
+        }
+        if (vertical_index & 1) {
+            const uint8_t *prev_quarter_line = quarter_line - quarter_stride;
+            uint8_t       *sixteenth_line    = sixteenth_samples +
+                (vertical_index >> 1) * sixteenth_stride;
+            for (uint32_t horizontal_index = 0; horizontal_index < (quarter_width >> 1);
+                 horizontal_index++) {
+                const uint32_t sum = (uint32_t)prev_quarter_line[2 * horizontal_index] +
+                    (uint32_t)prev_quarter_line[2 * horizontal_index + 1] +
+                    (uint32_t)quarter_line[2 * horizontal_index] +
+                    (uint32_t)quarter_line[2 * horizontal_index + 1];
+                sixteenth_line[horizontal_index] = (sum + 2) >> 2;
+            }
+        }
+    }
+}
+
 /********************************************
 * calculate_histogram
 *      creates n-bins histogram for the input
@@ -1915,8 +1965,10 @@ EbErrorType compute_block_mean_compute_variance(
 }
 
 static int32_t apply_denoise_2d(SequenceControlSet *scs_ptr, PictureParentControlSet *pcs_ptr,
-                                EbPictureBufferDesc *inputPicturePointer) {
-    AomDenoiseAndModel     *denoise_and_model;
+                                EbPictureBufferDesc *inputPicturePointer,
+                                AomDenoiseAndModel **denoise_and_model_pool) {
+    AomDenoiseAndModel     *denoise_and_model = denoise_and_model_pool ? *denoise_and_model_pool
+                                                                       : NULL;
     DenoiseAndModelInitData fg_init_data;
     fg_init_data.encoder_bit_depth    = pcs_ptr->enhanced_picture_ptr->bit_depth;
     fg_init_data.encoder_color_format = pcs_ptr->enhanced_picture_ptr->color_format;
@@ -1926,20 +1978,34 @@ static int32_t apply_denoise_2d(SequenceControlSet *scs_ptr, PictureParentContro
     fg_init_data.stride_y             = pcs_ptr->enhanced_picture_ptr->stride_y;
     fg_init_data.stride_cb            = pcs_ptr->enhanced_picture_ptr->stride_cb;
     fg_init_data.stride_cr            = pcs_ptr->enhanced_picture_ptr->stride_cr;
-    EB_NEW(denoise_and_model, denoise_and_model_ctor, (EbPtr)&fg_init_data);
+
+    // Reuse the pooled denoiser unless the picture geometry changed
+    if (denoise_and_model &&
+        (denoise_and_model->width != fg_init_data.width ||
+         denoise_and_model->height != fg_init_data.height ||
+         denoise_and_model->y_stride != fg_init_data.stride_y ||
+         denoise_and_model->uv_stride != fg_init_data.stride_cb ||
+         denoise_and_model->bit_depth != (fg_init_data.encoder_bit_depth > EB_8BIT ? 10 : 8)))
+        EB_DELETE(denoise_and_model);
+    if (!denoise_and_model)
+        EB_NEW(denoise_and_model, denoise_and_model_ctor, (EbPtr)&fg_init_data);
 
     if (svt_aom_denoise_and_model_run(denoise_and_model,
                                       inputPicturePointer,
                                       &pcs_ptr->frm_hdr.film_grain_params,
                                       scs_ptr->static_config.encoder_bit_depth > EB_8BIT)) {}
 
-    EB_DELETE(denoise_and_model);
+    if (denoise_and_model_pool)
+        *denoise_and_model_pool = denoise_and_model;
+    else
+        EB_DELETE(denoise_and_model);
 
     return 0;
 }
 
 EbErrorType denoise_estimate_film_grain(SequenceControlSet      *scs_ptr,
-                                        PictureParentControlSet *pcs_ptr) {
+                                        PictureParentControlSet *pcs_ptr,
+                                        AomDenoiseAndModel     **denoise_and_model_pool) {
     EbErrorType return_error = EB_ErrorNone;
 
     FrameHeader *frm_hdr = &pcs_ptr->frm_hdr;
@@ -1948,7 +2014,7 @@ EbErrorType denoise_estimate_film_grain(SequenceControlSet      *scs_ptr,
     frm_hdr->film_grain_params.apply_grain = 0;
 
     if (scs_ptr->static_config.film_grain_denoise_strength) {
-        if (apply_denoise_2d(scs_ptr, pcs_ptr, input_picture_ptr) < 0)
+        if (apply_denoise_2d(scs_ptr, pcs_ptr, input_picture_ptr, denoise_and_model_pool) < 0)
             return 1;
     }
 
@@ -1964,11 +2030,14 @@ EbErrorType denoise_estimate_film_grain(SequenceControlSet      *scs_ptr,
  *** Operations included at this point:
  ***** Borders preprocessing
  ***** Denoising
+ *** denoise_and_model_pool, when not NULL, holds the
+ * denoiser reused across the calls of one thread
  ************************************************/
 void picture_pre_processing_operations(PictureParentControlSet *pcs_ptr,
-                                       SequenceControlSet      *scs_ptr) {
+                                       SequenceControlSet      *scs_ptr,
+                                       AomDenoiseAndModel     **denoise_and_model_pool) {
     if (scs_ptr->static_config.film_grain_denoise_strength)
-        denoise_estimate_film_grain(scs_ptr, pcs_ptr);
+        denoise_estimate_film_grain(scs_ptr, pcs_ptr, denoise_and_model_pool);
     return;
 }
 
@@ -2691,6 +2760,41 @@ void downsample_filtering_input_picture(PictureParentControlSet *pcs_ptr,
                                         EbPictureBufferDesc     *sixteenth_picture_ptr) {
     // Downsample input picture for HME L0 and L1
     if (pcs_ptr->enable_hme_flag || pcs_ptr->tf_enable_hme_flag) {
+        const EbBool level1 = pcs_ptr->enable_hme_level1_flag || pcs_ptr->tf_enable_hme_level1_flag;
+        const EbBool level0 = pcs_ptr->enable_hme_level0_flag || pcs_ptr->tf_enable_hme_level0_flag;
+        // Both levels are built in a single pass over the input when they are cascaded
+        if (level1 && level0 &&
+            quarter_picture_ptr->width == input_padded_picture_ptr->width >> 1 &&
+            quarter_picture_ptr->height == input_padded_picture_ptr->height >> 1) {
+            downsample_2d_pyramid(
+                &input_padded_picture_ptr->buffer_y[input_padded_picture_ptr->origin_x +
+                                                    input_padded_picture_ptr->origin_y *
+                                                        input_padded_picture_ptr->stride_y],
+                input_padded_picture_ptr->stride_y,
+                input_padded_picture_ptr->width,
+                input_padded_picture_ptr->height,
+                &quarter_picture_ptr
+                     ->buffer_y[quarter_picture_ptr->origin_x +
+                                quarter_picture_ptr->origin_x * quarter_picture_ptr->stride_y],
+                quarter_picture_ptr->stride_y,
+                &sixteenth_picture_ptr->buffer_y[sixteenth_picture_ptr->origin_x +
+                                                 sixteenth_picture_ptr->origin_x *
+                                                     sixteenth_picture_ptr->stride_y],
+                sixteenth_picture_ptr->stride_y);
+            generate_padding(&quarter_picture_ptr->buffer_y[0],
+                             quarter_picture_ptr->stride_y,
+                             quarter_picture_ptr->width,
+                             quarter_picture_ptr->height,
+                             quarter_picture_ptr->origin_x,
+                             quarter_picture_ptr->origin_y);
+            generate_padding(&sixteenth_picture_ptr->buffer_y[0],
+                             sixteenth_picture_ptr->stride_y,
+                             sixteenth_picture_ptr->width,
+                             sixteenth_picture_ptr->height,
+                             sixteenth_picture_ptr->origin_x,
+                             sixteenth_picture_ptr->origin_y);
+            return;
+        }
         if (pcs_ptr->enable_hme_level1_flag || pcs_ptr->tf_enable_hme_level1_flag) {
             downsample_2d(
                 &input_padded_picture_ptr->buffer_y[input_padded_picture_ptr->origin_x +
@@ -2882,7 +2986,8 @@ void *picture_analysis_kernel(void *input_ptr) {
                 pad_input_pictures(scs_ptr, input_picture_ptr);
 
                 // Pre processing operations performed on the input picture
-                picture_pre_processing_operations(pcs_ptr, scs_ptr);
+                picture_pre_processing_operations(
+                    pcs_ptr, scs_ptr, &context_ptr->denoise_and_model);
 
                 if (input_picture_ptr->color_format >= EB_YUV422) {
                     // Jing: Do the conversion of 422/444=>420 here since it's multi-threaded kernel
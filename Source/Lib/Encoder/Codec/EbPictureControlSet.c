@@ -495,6 +495,9 @@ EbErrorType picture_control_set_ctor(PictureControlSet *object_ptr, EbPtr object
     }
 
     if ((is_16bit) || (init_data_ptr->is_16bit_pipeline)) {
+        // With hbd_16bit_source the buffers are borrowed from the parent's 16-bit source
+        if (init_data_ptr->hbd_16bit_source)
+            coeff_buffer_desc_init_data.buffer_enable_mask = 0;
         EB_NEW(object_ptr->input_frame16bit,
                svt_picture_buffer_desc_ctor,
                (EbPtr)&coeff_buffer_desc_init_data);
@@ -1302,6 +1305,7 @@ static void picture_parent_control_set_dctor(EbPtr ptr) {
 
     EB_FREE_ARRAY(obj->rc_me_distortion);
     EB_FREE_ARRAY(obj->stationary_block_present_sb);
+    EB_FREE_ARRAY(obj->static_sb);
     EB_FREE_ARRAY(obj->rc_me_allow_gm);
     EB_FREE_ARRAY(obj->me_64x64_distortion);
     EB_FREE_ARRAY(obj->me_32x32_distortion);
@@ -1334,6 +1338,7 @@ static void picture_parent_control_set_dctor(EbPtr ptr) {
     if (obj->frame_superres_enabled) {
         EB_DELETE(obj->enhanced_downscaled_picture_ptr);
     }
+    EB_DELETE(obj->enhanced_picture16bit_ptr);
     EB_DESTROY_SEMAPHORE(obj->tpl_disp_done_semaphore);
     EB_DESTROY_MUTEX(obj->tpl_disp_mutex);
     uint16_t tile_cnt = 1; /*obj->tile_row_count * obj->tile_column_count;*/
@@ -1382,6 +1387,26 @@ EbErrorType picture_parent_control_set_ctor(PictureParentControlSet *object_ptr,
         object_ptr->chroma_downsampled_picture_ptr = NULL;
     } else
         return EB_ErrorBadParameter;
+    object_ptr->enhanced_picture16bit_ptr   = (EbPictureBufferDesc *)NULL;
+    object_ptr->enhanced_picture16bit_valid = EB_FALSE;
+    if (init_data_ptr->hbd_16bit_source) {
+        // Same layout as the input picture so that both can be addressed with the same offsets
+        EbPictureBufferDescInitData input_pic_buf_desc_init_data;
+        input_pic_buf_desc_init_data.max_width          = init_data_ptr->picture_width;
+        input_pic_buf_desc_init_data.max_height         = init_data_ptr->picture_height;
+        input_pic_buf_desc_init_data.bit_depth          = EB_16BIT;
+        input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK;
+        input_pic_buf_desc_init_data.left_padding       = init_data_ptr->left_padding;
+        input_pic_buf_desc_init_data.right_padding      = init_data_ptr->right_padding;
+        input_pic_buf_desc_init_data.top_padding        = init_data_ptr->top_padding;
+        input_pic_buf_desc_init_data.bot_padding        = init_data_ptr->bot_padding;
+        input_pic_buf_desc_init_data.color_format       = init_data_ptr->color_format;
+        input_pic_buf_desc_init_data.split_mode         = EB_FALSE;
+        input_pic_buf_desc_init_data.is_16bit_pipeline  = EB_FALSE;
+        EB_NEW(object_ptr->enhanced_picture16bit_ptr,
+               svt_picture_buffer_desc_ctor,
+               (EbPtr)&input_pic_buf_desc_init_data);
+    }
     // GOP
     object_ptr->pred_struct_index       = 0;
     object_ptr->picture_number          = 0;
@@ -1438,6 +1463,7 @@ EbErrorType picture_parent_control_set_ctor(PictureParentControlSet *object_ptr,
 
     EB_MALLOC_ARRAY(object_ptr->rc_me_distortion, object_ptr->sb_total_count);
     EB_MALLOC_ARRAY(object_ptr->stationary_block_present_sb, object_ptr->sb_total_count);
+    EB_CALLOC_ARRAY(object_ptr->static_sb, object_ptr->sb_total_count);
     EB_MALLOC_ARRAY(object_ptr->rc_me_allow_gm, object_ptr->sb_total_count);
     EB_MALLOC_ARRAY(object_ptr->me_64x64_distortion, object_ptr->sb_total_count);
     EB_MALLOC_ARRAY(object_ptr->me_32x32_distortion, object_ptr->sb_total_count);
@@ -281,6 +281,7 @@ typedef struct PictureControlSet {
     EbHandle          intra_mutex;
     uint32_t          intra_coded_area;
     uint64_t          skip_coded_area;
+    uint32_t          static_sb_count; // number of SBs coded with the static SB shortcut
     uint32_t          tot_seg_searched_cdef;
     EbHandle          cdef_search_mutex;
 
@@ -597,6 +598,8 @@ typedef struct GmControls {
         params_refinement_steps; // The number of refinement steps to use in the GM params refinement
     uint8_t
         downsample_level; // GM_FULL: Exhaustive search mode; GM_DOWN: Downsampled resolution with a downsampling factor of 2 in each dimension; GM_TRAN_ONLY: Translation only using ME MV.
+    uint8_t
+        sample_error_blocks; // 0: measure the warp error of the params refinement on the whole picture, 1: on a checkerboard of half of the 32x32 blocks
 } GmControls;
 typedef struct CdefControls {
     uint8_t enabled;
@@ -675,6 +678,10 @@ typedef struct PictureParentControlSet {
     EbPictureBufferDesc *enhanced_picture_ptr;
     EbPictureBufferDesc *enhanced_downscaled_picture_ptr;
     EbPictureBufferDesc *enhanced_unscaled_picture_ptr;
+    // 16-bit copy of the 10-bit source, only allocated with hbd_16bit_source
+    EbPictureBufferDesc *enhanced_picture16bit_ptr;
+    // set when the 16-bit copy matches the 8-bit + 2-bit source planes, padding included
+    EbBool enhanced_picture16bit_valid;
     EbPictureBufferDesc
           *chroma_downsampled_picture_ptr; //if 422/444 input, down sample to 420 for MD
     EbBool is_chroma_downsampled_picture_ptr_owner;
@@ -730,6 +737,16 @@ typedef struct PictureParentControlSet {
     int                                     frames_in_sw; // used for Look ahead
     struct RateControlIntervalParamContext *rate_control_param_ptr;
     EbBool                                  qp_on_the_fly;
+    // External rate control parameters (FRAME_RC_PARAMS_EVENT), NULL when absent.
+    // Owned by the picture and released in packetization
+    EbFrameRcParams *ext_rc_params;
+    // CBR in-flight accounting (cbr_inflight_estimates): bits this picture currently
+    // charges to EncodeContext::inflight_bits, the buffer budget it earns once shown,
+    // and the raw mode decision size estimate used to calibrate later estimates
+    EbBool  inflight;
+    int64_t inflight_bits;
+    int     inflight_budget;
+    int     inflight_estimate;
     uint64_t                                last_idr_picture;
     uint64_t                                start_time_seconds;
     uint64_t                                start_time_u_seconds;
@@ -770,6 +787,7 @@ typedef struct PictureParentControlSet {
     uint32_t *rc_me_distortion;
     uint8_t      *
         stationary_block_present_sb; // 1 when a % of the SB is stationary relative to reference frame(s) ((0,0) MV: decode order), 0 otherwise
+    uint8_t *static_sb; // 1 when the 64x64 block did not change relative to the closest reference (set at ME), 0 otherwise
     uint8_t *rc_me_allow_gm;
 
     uint32_t *me_8x8_cost_variance;
@@ -980,6 +998,7 @@ typedef struct PictureParentControlSet {
     uint8_t
            superres_denom_array[SCALE_NUMERATOR + 1]; // denom candidate array used in auto supreres
     double superres_rdcost[SCALE_NUMERATOR + 1]; // 9 slots, for denom 8 ~ 16
+    uint8_t dyn_superres_denom; // denominator of the mini-GOP in dynamic superres mode
 
     EbObjectWrapper      *me_data_wrapper_ptr;
     MotionEstimationData *pa_me_data;
@@ -1024,7 +1043,9 @@ typedef struct PictureParentControlSet {
     EbHandle                        first_pass_mutex;
     struct PictureParentControlSet *first_pass_ref_ppcs_ptr[2];
     uint8_t                         first_pass_ref_count;
-    uint8_t                         first_pass_done;
+    uint8_t                         first_pass_done; // 0: pending, 1: in flight, 2: stats written
+    uint8_t                         first_pass_skip_frame;
+    uint8_t                         first_pass_bypass_blk_step;
     uint8_t                         first_frame_in_minigop;
     TplControls                     tpl_ctrls;
     uint8_t                         tpl_is_valid;
@@ -1134,6 +1155,7 @@ typedef struct PictureControlSetInitData {
     uint8_t log2_tile_cols;
     uint8_t log2_sb_sz; //in mi unit
     EbBool  is_16bit_pipeline;
+    uint8_t hbd_16bit_source;
 
     uint16_t   non_m8_pad_w;
     uint16_t   non_m8_pad_h;
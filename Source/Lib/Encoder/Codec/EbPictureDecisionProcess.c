@@ -52,9 +52,14 @@ extern PredictionStructureConfigEntry five_level_hierarchical_pred_struct[];
 extern PredictionStructureConfigEntry six_level_hierarchical_pred_struct[];
 
 void set_tpl_extended_controls(PictureParentControlSet *pcs_ptr, uint8_t tpl_level);
+uint8_t get_tpl_level(int8_t enc_mode, int32_t pass, int32_t lap_enabled, uint8_t pred_structure, uint8_t superres_mode);
+uint8_t get_tpl_synthesizer_block_size(int8_t tpl_level, uint32_t picture_width, uint32_t picture_height);
 
 void  get_max_allocated_me_refs(uint8_t ref_count_used_list0, uint8_t ref_count_used_list1, uint8_t* max_ref_to_alloc, uint8_t* max_cand_to_alloc);
 void init_resize_picture(SequenceControlSet* scs_ptr, PictureParentControlSet* pcs_ptr);
+void first_pass_frame_end(PictureParentControlSet *pcs_ptr, uint8_t skip_frame,
+                          uint8_t bypass_blk_step, const double ts_duration);
+void svt_av1_end_first_pass(PictureParentControlSet *pcs_ptr);
 uint8_t get_disallow_4x4(EbEncMode enc_mode, EB_SLICE slice_type);
 
 uint64_t  get_ref_poc(PictureDecisionContext *context, uint64_t curr_picture_number, int32_t delta_poc)
@@ -290,14 +295,41 @@ EbErrorType picture_decision_context_ctor(
     return EB_ErrorNone;
 }
 
+/* Keep the statistics of the picture consumed by the scene change detector, the next
+ * picture is compared against them so the previous PCS does not need to be held */
+static void update_scene_change_stats(
+    PictureDecisionContext  *context_ptr,
+    SequenceControlSet      *scs_ptr,
+    PictureParentControlSet *pcs_ptr)
+{
+    for (uint32_t region_in_picture_width_index = 0; region_in_picture_width_index < scs_ptr->picture_analysis_number_of_regions_per_width; region_in_picture_width_index++) {
+        for (uint32_t region_in_picture_height_index = 0; region_in_picture_height_index < scs_ptr->picture_analysis_number_of_regions_per_height; region_in_picture_height_index++) {
+            int16_t intensity = (int16_t)pcs_ptr->average_intensity_per_region[region_in_picture_width_index][region_in_picture_height_index][0];
+            context_ptr->prev_intensity_delta[region_in_picture_width_index][region_in_picture_height_index] = context_ptr->prev_stats_valid ?
+                intensity - (int16_t)context_ptr->prev_average_intensity[region_in_picture_width_index][region_in_picture_height_index] :
+                0;
+            context_ptr->prev_average_intensity[region_in_picture_width_index][region_in_picture_height_index] = (uint8_t)intensity;
+            for (int plane = 0; plane < 3; ++plane)
+                svt_memcpy(context_ptr->prev_histogram[region_in_picture_width_index][region_in_picture_height_index][plane],
+                    pcs_ptr->picture_histogram[region_in_picture_width_index][region_in_picture_height_index][plane],
+                    HISTOGRAM_NUMBER_OF_BINS * sizeof(uint32_t));
+        }
+    }
+    context_ptr->prev_pic_avg_variance = pcs_ptr->pic_avg_variance;
+    context_ptr->prev_stats_valid = EB_TRUE;
+}
+
+/* Decide whether the current picture is a cut. The current picture is compared
+ * against the stored statistics of the previous one, and at most scd_look_ahead
+ * future pictures of the window are used to tell flashes and fades from cuts. */
 static EbBool scene_transition_detector(
     PictureDecisionContext *context_ptr,
     SequenceControlSet                 *scs_ptr,
     PictureParentControlSet           **parent_pcs_window)
 {
-    PictureParentControlSet       *prev_pcs_ptr = parent_pcs_window[0];
     PictureParentControlSet       *current_pcs_ptr = parent_pcs_window[1];
-    PictureParentControlSet       *future_pcs_ptr = parent_pcs_window[2];
+    PictureParentControlSet       *future_pcs_ptr = scs_ptr->scd_look_ahead > 0 ? parent_pcs_window[2] : NULL;
+    PictureParentControlSet       *future2_pcs_ptr = scs_ptr->scd_look_ahead > 1 && future_pcs_ptr ? parent_pcs_window[3] : NULL;
 
     // calculating the frame threshold based on the number of 64x64 blocks in the frame
     uint32_t  region_threshhold;
@@ -355,17 +387,17 @@ static EbBool scene_transition_detector(
 
             region_threshhold = (
                 // Noise insertion/removal detection
-                ((ABS((int64_t)current_pcs_ptr->pic_avg_variance - (int64_t)prev_pcs_ptr->pic_avg_variance)) > NOISE_VARIANCE_TH) &&
-                (current_pcs_ptr->pic_avg_variance > HIGH_PICTURE_VARIANCE_TH || prev_pcs_ptr->pic_avg_variance > HIGH_PICTURE_VARIANCE_TH)) ?
+                ((ABS((int64_t)current_pcs_ptr->pic_avg_variance - (int64_t)context_ptr->prev_pic_avg_variance)) > NOISE_VARIANCE_TH) &&
+                (current_pcs_ptr->pic_avg_variance > HIGH_PICTURE_VARIANCE_TH || context_ptr->prev_pic_avg_variance > HIGH_PICTURE_VARIANCE_TH)) ?
                 NOISY_SCENE_TH * NUM64x64INPIC(region_width, region_height) : // SCD TH function of noise insertion/removal.
                 SCENE_TH * NUM64x64INPIC(region_width, region_height);
 
             region_threshhold_chroma = region_threshhold / 4;
 
             for (int bin = 0; bin < HISTOGRAM_NUMBER_OF_BINS; ++bin) {
-                ahd += ABS((int32_t)current_pcs_ptr->picture_histogram[region_in_picture_width_index][region_in_picture_height_index][0][bin] - (int32_t)prev_pcs_ptr->picture_histogram[region_in_picture_width_index][region_in_picture_height_index][0][bin]);
-                ahd_cb += ABS((int32_t)current_pcs_ptr->picture_histogram[region_in_picture_width_index][region_in_picture_height_index][1][bin] - (int32_t)prev_pcs_ptr->picture_histogram[region_in_picture_width_index][region_in_picture_height_index][1][bin]);
-                ahd_cr += ABS((int32_t)current_pcs_ptr->picture_histogram[region_in_picture_width_index][region_in_picture_height_index][2][bin] - (int32_t)prev_pcs_ptr->picture_histogram[region_in_picture_width_index][region_in_picture_height_index][2][bin]);
+                ahd += ABS((int32_t)current_pcs_ptr->picture_histogram[region_in_picture_width_index][region_in_picture_height_index][0][bin] - (int32_t)context_ptr->prev_histogram[region_in_picture_width_index][region_in_picture_height_index][0][bin]);
+                ahd_cb += ABS((int32_t)current_pcs_ptr->picture_histogram[region_in_picture_width_index][region_in_picture_height_index][1][bin] - (int32_t)context_ptr->prev_histogram[region_in_picture_width_index][region_in_picture_height_index][1][bin]);
+                ahd_cr += ABS((int32_t)current_pcs_ptr->picture_histogram[region_in_picture_width_index][region_in_picture_height_index][2][bin] - (int32_t)context_ptr->prev_histogram[region_in_picture_width_index][region_in_picture_height_index][2][bin]);
             }
 
             if (context_ptr->reset_running_avg) {
@@ -392,33 +424,49 @@ static EbBool scene_transition_detector(
                 (ahd_error_cr > region_threshhold_chroma && ahd_cr >= ahd_error_cr)) {
                 is_abrupt_change = EB_TRUE;
             }
-            if (is_abrupt_change)
-            {
-                // this variable denotes the average intensity difference between the next and the past frames
-                uint8_t aid_future_past = (uint8_t)ABS(
-                    (int16_t)future_pcs_ptr
-                        ->average_intensity_per_region[region_in_picture_width_index]
-                                                      [region_in_picture_height_index][0] -
-                    (int16_t)prev_pcs_ptr
-                        ->average_intensity_per_region[region_in_picture_width_index]
-                                                      [region_in_picture_height_index][0]);
-                uint8_t   aid_future_present = (uint8_t)ABS((int16_t)future_pcs_ptr->average_intensity_per_region[region_in_picture_width_index][region_in_picture_height_index][0] - (int16_t)current_pcs_ptr->average_intensity_per_region[region_in_picture_width_index][region_in_picture_height_index][0]);
-                uint8_t   aid_present_past = (uint8_t)ABS((int16_t)current_pcs_ptr->average_intensity_per_region[region_in_picture_width_index][region_in_picture_height_index][0] - (int16_t)prev_pcs_ptr->average_intensity_per_region[region_in_picture_width_index][region_in_picture_height_index][0]);
-
-                if (aid_future_past < FLASH_TH && aid_future_present >= FLASH_TH && aid_present_past >= FLASH_TH) {
-                    //SVT_LOG ("\nFlash in frame# %i , %i\n", current_pcs_ptr->picture_number,aid_future_past);
+            if (is_abrupt_change) {
+                int16_t past_intensity = (int16_t)context_ptr->prev_average_intensity[region_in_picture_width_index][region_in_picture_height_index];
+                int16_t present_intensity = (int16_t)current_pcs_ptr->average_intensity_per_region[region_in_picture_width_index][region_in_picture_height_index][0];
+                uint8_t aid_present_past = (uint8_t)ABS(present_intensity - past_intensity);
+
+                if (context_ptr->flash_hold[region_in_picture_width_index][region_in_picture_height_index]) {
+                    // Second picture of, or return from, a two-picture flash
                 }
-                else if (aid_future_present < FADE_TH && aid_present_past < FADE_TH) {
-                    //SVT_LOG ("\nFlash in frame# %i , %i\n", current_pcs_ptr->picture_number,aid_future_past);
+                else if (future_pcs_ptr) {
+                    int16_t future_intensity = (int16_t)future_pcs_ptr->average_intensity_per_region[region_in_picture_width_index][region_in_picture_height_index][0];
+                    // this variable denotes the average intensity difference between the next and the past frames
+                    uint8_t aid_future_past = (uint8_t)ABS(future_intensity - past_intensity);
+                    uint8_t aid_future_present = (uint8_t)ABS(future_intensity - present_intensity);
+
+                    if (aid_future_past < FLASH_TH && aid_future_present >= FLASH_TH && aid_present_past >= FLASH_TH) {
+                        //SVT_LOG ("\nFlash in frame# %i , %i\n", current_pcs_ptr->picture_number,aid_future_past);
+                    }
+                    else if (aid_future_present < FADE_TH && aid_present_past < FADE_TH) {
+                        //SVT_LOG ("\nFade in frame# %i , %i\n", current_pcs_ptr->picture_number,aid_future_past);
+                    }
+                    else if (future2_pcs_ptr &&
+                        ABS((int16_t)future2_pcs_ptr->average_intensity_per_region[region_in_picture_width_index][region_in_picture_height_index][0] - past_intensity) < FLASH_TH &&
+                        ABS((int16_t)future2_pcs_ptr->average_intensity_per_region[region_in_picture_width_index][region_in_picture_height_index][0] - present_intensity) >= FLASH_TH &&
+                        aid_present_past >= FLASH_TH) {
+                        // Flash lasting two pictures, the following abrupt changes of the region are part of it
+                        context_ptr->flash_hold[region_in_picture_width_index][region_in_picture_height_index] = 3;
+                    }
+                    else {
+                        is_scene_change = EB_TRUE;
+                        //SVT_LOG ("\nScene Change in frame# %i , %i\n", current_pcs_ptr->picture_number,aid_future_past);
+                    }
                 }
-                else {
+                // Without future pictures only fades can be told apart: a small intensity change
+                // following another small change
+                else if (!(aid_present_past < FADE_TH &&
+                    ABS(context_ptr->prev_intensity_delta[region_in_picture_width_index][region_in_picture_height_index]) < FADE_TH))
                     is_scene_change = EB_TRUE;
-                    //SVT_LOG ("\nScene Change in frame# %i , %i\n", current_pcs_ptr->picture_number,aid_future_past);
-                }
             } else
                 ahd_running_avg[region_in_picture_width_index][region_in_picture_height_index] = (3 * ahd_running_avg[region_in_picture_width_index][region_in_picture_height_index] + ahd) / 4;
             is_abrupt_change_count += is_abrupt_change;
             is_scene_change_count += is_scene_change;
+            if (context_ptr->flash_hold[region_in_picture_width_index][region_in_picture_height_index])
+                context_ptr->flash_hold[region_in_picture_width_index][region_in_picture_height_index]--;
         }
     }
 
@@ -464,6 +512,54 @@ EbErrorType initialize_mini_gop_activity_array(
     return EB_ErrorNone;
 }
 
+/***************************************************************************************************
+* Checks the first pass statistics of the pictures of a mini GOP against the high motion thresholds
+***************************************************************************************************/
+static EbBool is_high_motion_mini_gop(
+    SequenceControlSet            *scs_ptr,
+    EncodeContext                 *encode_context_ptr,
+    uint32_t                       mini_gop_index) {
+    const STATS_BUFFER_CTX *stats_buf_ctx = scs_ptr->twopass.stats_buf_ctx;
+    const MiniGopStats     *mini_gop = get_mini_gop_stats(mini_gop_index);
+    double                  motion = 0, mv_in_out = 0;
+    uint32_t                count = 0;
+
+    for (uint32_t pic_i = mini_gop->start_index; pic_i <= mini_gop->end_index; ++pic_i) {
+        PictureParentControlSet *pcs_i = (PictureParentControlSet*)encode_context_ptr->pre_assignment_buffer[pic_i]->object_ptr;
+        const FIRSTPASS_STATS   *stat = stats_buf_ctx->stats_in_start + pcs_i->picture_number;
+        if (stat >= stats_buf_ctx->stats_in_end)
+            break;
+        motion += stat->pcnt_motion;
+        mv_in_out += stat->mv_in_out_count;
+        count++;
+    }
+    if (!count)
+        return EB_FALSE;
+    return motion / count > scs_ptr->mgs_ctls.mg_hm_th &&
+        ABS(mv_in_out / count) > scs_ptr->mgs_ctls.mg_mv_in_out_th;
+}
+
+/***************************************************************************************************
+* Adaptive mini GOP: keep the selected mini GOP unless its pictures have high motion, in which case
+* its two halves are considered in turn. The 8-picture mini GOPs are never split.
+***************************************************************************************************/
+static void adapt_mini_gop_depth(
+    PictureDecisionContext        *context_ptr,
+    SequenceControlSet            *scs_ptr,
+    EncodeContext                 *encode_context_ptr,
+    uint32_t                       mini_gop_index) {
+    if (get_mini_gop_stats(mini_gop_index)->hierarchical_levels <= 3 ||
+        !is_high_motion_mini_gop(scs_ptr, encode_context_ptr, mini_gop_index)) {
+        context_ptr->mini_gop_activity_array[mini_gop_index] = EB_FALSE;
+        return;
+    }
+    context_ptr->mini_gop_activity_array[mini_gop_index] = EB_TRUE;
+    const uint32_t first_half = mini_gop_index + 1;
+    adapt_mini_gop_depth(context_ptr, scs_ptr, encode_context_ptr, first_half);
+    adapt_mini_gop_depth(context_ptr, scs_ptr, encode_context_ptr,
+        first_half + mini_gop_offset[get_mini_gop_stats(first_half)->hierarchical_levels - MIN_HIERARCHICAL_LEVEL]);
+}
+
 /***************************************************************************************************
 * Generates block picture map
 *
@@ -1689,6 +1785,7 @@ void set_gm_controls(PictureParentControlSet *pcs_ptr, uint8_t gm_level)
         gm_ctrls->use_distance_based_active_th = 0;
         gm_ctrls->params_refinement_steps = 5;
         gm_ctrls->downsample_level = GM_FULL;
+        gm_ctrls->sample_error_blocks = 0;
         break;
     case 2:
         gm_ctrls->enabled = 1;
@@ -1700,6 +1797,7 @@ void set_gm_controls(PictureParentControlSet *pcs_ptr, uint8_t gm_level)
         gm_ctrls->use_distance_based_active_th = 0;
         gm_ctrls->params_refinement_steps = 5;
         gm_ctrls->downsample_level = GM_FULL;
+        gm_ctrls->sample_error_blocks = 0;
         break;
     case 3:
         gm_ctrls->enabled = 1;
@@ -1711,6 +1809,7 @@ void set_gm_controls(PictureParentControlSet *pcs_ptr, uint8_t gm_level)
         gm_ctrls->use_distance_based_active_th = 0;
         gm_ctrls->params_refinement_steps = 5;
         gm_ctrls->downsample_level = GM_FULL;
+        gm_ctrls->sample_error_blocks = 0;
         break;
     case 4:
         gm_ctrls->enabled = 1;
@@ -1722,6 +1821,7 @@ void set_gm_controls(PictureParentControlSet *pcs_ptr, uint8_t gm_level)
         gm_ctrls->use_distance_based_active_th = 0;
         gm_ctrls->params_refinement_steps = 5;
         gm_ctrls->downsample_level = GM_DOWN;
+        gm_ctrls->sample_error_blocks = 0;
         break;
     case 5:
         gm_ctrls->enabled = 1;
@@ -1733,6 +1833,7 @@ void set_gm_controls(PictureParentControlSet *pcs_ptr, uint8_t gm_level)
         gm_ctrls->use_distance_based_active_th = 0;
         gm_ctrls->params_refinement_steps = 5;
         gm_ctrls->downsample_level = GM_DOWN16;
+        gm_ctrls->sample_error_blocks = 0;
         break;
     case 6:
         gm_ctrls->enabled = 1;
@@ -1744,6 +1845,7 @@ void set_gm_controls(PictureParentControlSet *pcs_ptr, uint8_t gm_level)
         gm_ctrls->use_distance_based_active_th = 1;
         gm_ctrls->params_refinement_steps = 5;
         gm_ctrls->downsample_level = GM_DOWN16;
+        gm_ctrls->sample_error_blocks = 0;
         break;
     case 7:
         gm_ctrls->enabled = 1;
@@ -1755,6 +1857,19 @@ void set_gm_controls(PictureParentControlSet *pcs_ptr, uint8_t gm_level)
         gm_ctrls->use_distance_based_active_th = 1;
         gm_ctrls->params_refinement_steps = 1;
         gm_ctrls->downsample_level = GM_DOWN16;
+        gm_ctrls->sample_error_blocks = 0;
+        break;
+    case 8:
+        gm_ctrls->enabled = 1;
+        gm_ctrls->identiy_exit = 1;
+        gm_ctrls->rotzoom_model_only = 1;
+        gm_ctrls->bipred_only = 1;
+        gm_ctrls->bypass_based_on_me = 1;
+        gm_ctrls->use_stationary_block = 1;
+        gm_ctrls->use_distance_based_active_th = 1;
+        gm_ctrls->params_refinement_steps = 1;
+        gm_ctrls->downsample_level = GM_DOWN16;
+        gm_ctrls->sample_error_blocks = 1;
         break;
     default:
         assert(0);
@@ -1774,6 +1889,8 @@ uint8_t derive_gm_level(PictureParentControlSet* pcs_ptr) {
             gm_level = pcs_ptr->is_used_as_reference_flag ? 4 : 0;
         else if (pcs_ptr->enc_mode <= ENC_M6)
             gm_level = pcs_ptr->is_used_as_reference_flag ? 5 : 0;
+        else if (pcs_ptr->enc_mode <= ENC_M7)
+            gm_level = pcs_ptr->is_used_as_reference_flag ? 8 : 0;
         else
             gm_level = 0;
     }
@@ -2061,7 +2178,20 @@ EbErrorType signal_derivation_multi_processes_oq(
         pcs_ptr->use_best_me_unipred_cand_only = 1;
 
     //TPL level should not be modified outside of this function
-    set_tpl_extended_controls(pcs_ptr, scs_ptr->tpl_level);
+    if (scs_ptr->speed_control_flag && scs_ptr->tpl_level) {
+        // Follow the faster preset chosen by the speed control, keeping the synthesizer
+        // block size the TPL buffers were allocated for
+        set_tpl_extended_controls(pcs_ptr,
+                                  MAX(scs_ptr->tpl_level,
+                                      get_tpl_level(pcs_ptr->enc_mode,
+                                                    scs_ptr->static_config.pass,
+                                                    scs_ptr->lap_enabled,
+                                                    scs_ptr->static_config.pred_structure,
+                                                    scs_ptr->static_config.superres_mode)));
+        pcs_ptr->tpl_ctrls.synth_blk_size = get_tpl_synthesizer_block_size(
+            scs_ptr->tpl_level, pcs_ptr->aligned_width, pcs_ptr->aligned_height);
+    } else
+        set_tpl_extended_controls(pcs_ptr, scs_ptr->tpl_level);
 
     pcs_ptr->adjust_under_shoot_gf = 0;
     if (scs_ptr->passes == 1 && scs_ptr->static_config.rate_control_mode == 1)
@@ -4667,7 +4797,8 @@ void perform_simple_picture_analysis_for_overlay(PictureParentControlSet     *pc
     // Pre processing operations performed on the input picture
     picture_pre_processing_operations(
         pcs_ptr,
-        scs_ptr);
+        scs_ptr,
+        NULL);
 
     if (input_picture_ptr->color_format >= EB_YUV422) {
         // Jing: Do the conversion of 422/444=>420 here since it's multi-threaded kernel
@@ -4800,6 +4931,15 @@ void process_first_pass_frame(
     pcs_ptr->first_pass_seg_total_count = (uint16_t)(pcs_ptr->first_pass_seg_column_count  * pcs_ptr->first_pass_seg_row_count);
     pcs_ptr->first_pass_seg_acc = 0;
     first_pass_signal_derivation_multi_processes(scs_ptr, pcs_ptr);
+    // Keep the source references alive: the head of the window may leave picture decision
+    // while this picture is still in flight
+    for (uint8_t ref_idx = 0; ref_idx < pcs_ptr->first_pass_ref_count; ref_idx++) {
+        PictureParentControlSet *ref_pcs = pcs_ptr->first_pass_ref_ppcs_ptr[ref_idx];
+        svt_object_inc_live_count(ref_pcs->p_pcs_wrapper_ptr, 1);
+        svt_object_inc_live_count(ref_pcs->input_picture_wrapper_ptr, 1);
+        svt_object_inc_live_count(ref_pcs->pa_reference_picture_wrapper_ptr, 1);
+        svt_object_inc_live_count(ref_pcs->eb_y8b_wrapper_ptr, 1);
+    }
     if (pcs_ptr->me_data_wrapper_ptr == NULL) {
         EbObjectWrapper               *me_wrapper;
         svt_get_empty_object(context_ptr->me_fifo_ptr, &me_wrapper);
@@ -4820,8 +4960,28 @@ void process_first_pass_frame(
         out_results_ptr->task_type = TASK_FIRST_PASS_ME;
         svt_post_full_object(out_results_wrapper_ptr);
     }
-
+}
+/*
+wait for the first pass segments of this picture and write its stats.
+first pass frames only use source pictures as references, so all the frames of the
+window are dispatched at once and only the stats are serialized (display order)
+*/
+static void finish_first_pass_frame(PictureParentControlSet *pcs_ptr) {
     svt_block_on_semaphore(pcs_ptr->first_pass_done_semaphore);
+    first_pass_frame_end(pcs_ptr,
+                         pcs_ptr->first_pass_skip_frame,
+                         pcs_ptr->first_pass_bypass_blk_step,
+                         pcs_ptr->ts_duration);
+    if (pcs_ptr->end_of_sequence_flag && !pcs_ptr->scs_ptr->lap_enabled)
+        svt_av1_end_first_pass(pcs_ptr);
+    for (uint8_t ref_idx = 0; ref_idx < pcs_ptr->first_pass_ref_count; ref_idx++) {
+        PictureParentControlSet *ref_pcs = pcs_ptr->first_pass_ref_ppcs_ptr[ref_idx];
+        svt_release_object(ref_pcs->input_picture_wrapper_ptr);
+        svt_release_object(ref_pcs->eb_y8b_wrapper_ptr);
+        svt_release_object(ref_pcs->pa_reference_picture_wrapper_ptr);
+        //ppcs should be the last one to release
+        svt_release_object(ref_pcs->p_pcs_wrapper_ptr);
+    }
     svt_release_object(pcs_ptr->me_data_wrapper_ptr);
     pcs_ptr->me_data_wrapper_ptr = (EbObjectWrapper *)NULL;
     pcs_ptr->pa_me_data = NULL;
@@ -5096,11 +5256,12 @@ void send_picture_out(
     //****************************************************
 
     // Scale picture if super-res is used
-    // Handle SUPERRES_FIXED and SUPERRES_RANDOM modes here.
+    // Handle SUPERRES_FIXED, SUPERRES_RANDOM and SUPERRES_DYNAMIC modes here.
     // SUPERRES_QTHRESH and SUPERRES_AUTO modes are handled in rate control process because these modes depend on qindex
     if (scs->static_config.pass == ENC_SINGLE_PASS) {
         if (scs->static_config.superres_mode == SUPERRES_FIXED ||
-            scs->static_config.superres_mode == SUPERRES_RANDOM) {
+            scs->static_config.superres_mode == SUPERRES_RANDOM ||
+            scs->static_config.superres_mode == SUPERRES_DYNAMIC) {
             init_resize_picture(scs, pcs);
         }
     }
@@ -5184,6 +5345,8 @@ void print_pre_ass_buffer(EncodeContext *ctx, PictureParentControlSet *pcs_ptr,
 
 void pack_highbd_pic(const EbPictureBufferDesc *pic_ptr, uint16_t *buffer_16bit[3], uint32_t ss_x,
     uint32_t ss_y, EbBool include_padding);
+void get_highbd_source_pic(PictureParentControlSet *pcs_ptr, uint16_t *buffer_16bit[3],
+    uint32_t ss_x, uint32_t ss_y, EbBool do_chroma);
 
 EbErrorType derive_tf_window_params(
     SequenceControlSet *scs_ptr,
@@ -5209,21 +5372,31 @@ EbErrorType derive_tf_window_params(
         do_noise_est = 1;
     // allocate 16 bit buffer
     if (is_highbd) {
-        EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_Y],
-            central_picture_ptr->luma_size);
-        if (pcs_ptr->tf_ctrls.do_chroma) {
-            EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_U],
-                central_picture_ptr->chroma_size);
-            EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_V],
-                central_picture_ptr->chroma_size);
-        }
-
-        // pack byte buffers to 16 bit buffer
-        pack_highbd_pic(central_picture_ptr,
-            picture_control_set_ptr_central->altref_buffer_highbd,
-            ss_x,
-            ss_y,
-            EB_TRUE);
+        // the filtered picture is written to the 16-bit copy of the source when it is kept
+        if (scs_ptr->static_config.hbd_16bit_source &&
+            scs_ptr->static_config.pred_structure == EB_PRED_RANDOM_ACCESS)
+            get_highbd_source_pic(picture_control_set_ptr_central,
+                picture_control_set_ptr_central->altref_buffer_highbd,
+                ss_x,
+                ss_y,
+                pcs_ptr->tf_ctrls.do_chroma);
+        else {
+            EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_Y],
+                central_picture_ptr->luma_size);
+            if (pcs_ptr->tf_ctrls.do_chroma) {
+                EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_U],
+                    central_picture_ptr->chroma_size);
+                EB_MALLOC_ARRAY(picture_control_set_ptr_central->altref_buffer_highbd[C_V],
+                    central_picture_ptr->chroma_size);
+            }
+
+            // pack byte buffers to 16 bit buffer
+            pack_highbd_pic(central_picture_ptr,
+                picture_control_set_ptr_central->altref_buffer_highbd,
+                ss_x,
+                ss_y,
+                EB_TRUE);
+        }
         // Estimate source noise level
         uint16_t *altref_buffer_highbd_start[COLOR_CHANNELS];
         altref_buffer_highbd_start[C_Y] =
@@ -5600,6 +5773,29 @@ PaReferenceQueueEntry * search_ref_in_ref_queue_pa(
 
     return NULL;
 }
+/*
+ * Trim the TF window of pictures the speed control moved to a faster preset:
+ * one preset step freezes the window at its default size, two steps halve it
+ * and three steps or more disable TF above the base layer.
+ */
+static void speed_control_tf_params(SequenceControlSet *scs_ptr, PictureParentControlSet *pcs_ptr) {
+    TfControls *tf_ctrls   = &pcs_ptr->tf_ctrls;
+    const int   mode_steps = pcs_ptr->enc_mode - scs_ptr->static_config.enc_mode;
+
+    if (!scs_ptr->speed_control_flag || mode_steps <= 0 || !tf_ctrls->enabled)
+        return;
+    tf_ctrls->noise_adjust_past_pics   = 0;
+    tf_ctrls->noise_adjust_future_pics = 0;
+    if (mode_steps >= 2) {
+        tf_ctrls->num_past_pics   = tf_ctrls->num_past_pics >> 1;
+        tf_ctrls->num_future_pics = MAX(tf_ctrls->num_future_pics >> 1,
+                                        MIN(tf_ctrls->num_future_pics, 1));
+    }
+    tf_ctrls->max_num_past_pics   = MIN(tf_ctrls->max_num_past_pics, tf_ctrls->num_past_pics);
+    tf_ctrls->max_num_future_pics = MIN(tf_ctrls->max_num_future_pics, tf_ctrls->num_future_pics);
+    if (mode_steps >= 3 && pcs_ptr->temporal_layer_index > 0)
+        tf_ctrls->enabled = 0;
+}
 /*
  * Copy TF params: sps -> pcs
  */
@@ -5613,6 +5809,7 @@ void copy_tf_params(SequenceControlSet *scs_ptr, PictureParentControlSet *pcs_pt
         else
             pcs_ptr->tf_ctrls.enabled = 0;
 
+        speed_control_tf_params(scs_ptr, pcs_ptr);
         return;
    }
     if (is_delayed_intra(pcs_ptr))
@@ -5623,6 +5820,7 @@ void copy_tf_params(SequenceControlSet *scs_ptr, PictureParentControlSet *pcs_pt
         pcs_ptr->tf_ctrls = scs_ptr->tf_params_per_type[2];
     else
         pcs_ptr->tf_ctrls.enabled = 0;
+    speed_control_tf_params(scs_ptr, pcs_ptr);
 }
 void is_screen_content(PictureParentControlSet *pcs_ptr);
 /*
@@ -5866,6 +6064,20 @@ void* picture_decision_kernel(void *input_ptr)
                         }
                     }
                 }
+                // Write the stats in display order. Only the head is needed to move on when the
+                // stats are not consumed by the look ahead, the rest of the window stays in flight.
+                uint32_t finish_count = scs_ptr->lap_enabled ? scs_ptr->scd_delay + 1 : 1;
+                for (window_index = 0; window_index < finish_count; window_index++) {
+                    entry_index = QUEUE_GET_NEXT_SPOT(encode_context_ptr->picture_decision_reorder_queue_head_index, window_index);
+                    PictureDecisionReorderEntry *first_pass_queue_entry = encode_context_ptr->picture_decision_reorder_queue[entry_index];
+                    if (first_pass_queue_entry->parent_pcs_wrapper_ptr == NULL)
+                        break;
+                    PictureParentControlSet *first_pass_pcs_ptr = (PictureParentControlSet*)first_pass_queue_entry->parent_pcs_wrapper_ptr->object_ptr;
+                    if (first_pass_pcs_ptr->first_pass_done == 1) {
+                        finish_first_pass_frame(first_pass_pcs_ptr);
+                        first_pass_pcs_ptr->first_pass_done = 2;
+                    }
+                }
             }
 
             pcs_ptr = (PictureParentControlSet*)queue_entry_ptr->parent_pcs_wrapper_ptr->object_ptr;
@@ -5876,8 +6088,8 @@ void* picture_decision_kernel(void *input_ptr)
                 window_avail = EB_FALSE;
             else {
 
-                //TODO: risk of a race condition accessing prev(pcs0 is released, and pcs1 still doing sc).
-                //Actually we dont need to keep prev, just keep previous copy of histograms.
+                // The scene change detector uses the copy of the previous histograms kept in the context,
+                // not the previous PCS
                 pcs_ptr->pd_window[0] =
                     queue_entry_ptr->picture_number > 0 ? (PictureParentControlSet *)encode_context_ptr->picture_decision_reorder_queue[previous_entry_index]->parent_pcs_wrapper_ptr->object_ptr : NULL;
                 pcs_ptr->pd_window[1] =
@@ -5944,6 +6156,9 @@ void* picture_decision_kernel(void *input_ptr)
                 // Store scene change in context
                 context_ptr->is_scene_change_detected = pcs_ptr->scene_change_flag;
             }
+            if (window_avail == EB_TRUE &&
+                (scs_ptr->static_config.scene_change_detection || scs_ptr->vq_ctrls.sharpness_ctrls.scene_transition))
+                update_scene_change_stats(context_ptr, scs_ptr, pcs_ptr);
 
             if (window_avail == EB_TRUE || frame_passthrough == EB_TRUE)
             {
@@ -6070,6 +6285,13 @@ void* picture_decision_kernel(void *input_ptr)
                                     context_ptr->mini_gop_activity_array[L4_0_INDEX] = EB_FALSE;
                                     context_ptr->mini_gop_activity_array[L4_1_INDEX] = EB_FALSE;
                                 }
+                                // Per mini GOP depth: the full size mini GOP is split when it has high motion
+                                if (scs_ptr->enable_adaptive_mini_gop == 2) {
+                                    if (!context_ptr->mini_gop_activity_array[L6_INDEX])
+                                        adapt_mini_gop_depth(context_ptr, scs_ptr, encode_context_ptr, L6_INDEX);
+                                    else if (!context_ptr->mini_gop_activity_array[L5_0_INDEX])
+                                        adapt_mini_gop_depth(context_ptr, scs_ptr, encode_context_ptr, L5_0_INDEX);
+                                }
 
                                 generate_picture_window_split(
                                         context_ptr,
@@ -6790,6 +7012,14 @@ void* picture_decision_kernel(void *input_ptr)
                             else
                                 context_ptr->mg_pictures_array_disp_order[pic_i]->first_frame_in_minigop = 0;
                         }
+                        // Dynamic super-res: the denominator only changes at mini-GOP boundaries
+                        if (scs_ptr->static_config.superres_mode == SUPERRES_DYNAMIC) {
+                            svt_block_on_mutex(encode_context_ptr->dyn_superres_mutex);
+                            const uint8_t dyn_superres_denom = encode_context_ptr->dyn_superres_denom;
+                            svt_release_mutex(encode_context_ptr->dyn_superres_mutex);
+                            for (uint32_t pic_i = 0; pic_i < mg_size; ++pic_i)
+                                context_ptr->mg_pictures_array[pic_i]->dyn_superres_denom = dyn_superres_denom;
+                        }
 
                         //Process previous delayed Intra if we have one
                         pcs_ptr->is_new_gf_group = 0;
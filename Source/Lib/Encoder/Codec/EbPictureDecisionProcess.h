@@ -35,7 +35,8 @@ void pad_picture_to_multiple_of_min_blk_size_dimensions(SequenceControlSet  *scs
 void pad_picture_to_multiple_of_min_blk_size_dimensions_16bit(
     SequenceControlSet *scs_ptr, EbPictureBufferDesc *input_picture_ptr);
 void picture_pre_processing_operations(PictureParentControlSet *pcs_ptr,
-                                       SequenceControlSet      *scs_ptr);
+                                       SequenceControlSet      *scs_ptr,
+                                       AomDenoiseAndModel     **denoise_and_model_pool);
 void pad_picture_to_multiple_of_sb_dimensions(EbPictureBufferDesc *input_padded_picture_ptr);
 
 void gathering_picture_statistics(SequenceControlSet *scs_ptr, PictureParentControlSet *pcs_ptr,
@@ -66,6 +67,19 @@ typedef struct PictureDecisionContext {
     uint32_t **ahd_running_avg;
     EbBool     is_scene_change_detected;
     uint8_t    transition_present;
+    // Statistics of the previous picture in display order, updated as each picture is
+    // consumed so the scene change detector does not need the previous PCS
+    EbBool   prev_stats_valid;
+    uint16_t prev_pic_avg_variance;
+    uint32_t prev_histogram[MAX_NUMBER_OF_REGIONS_IN_WIDTH][MAX_NUMBER_OF_REGIONS_IN_HEIGHT][3]
+                           [HISTOGRAM_NUMBER_OF_BINS];
+    uint8_t  prev_average_intensity[MAX_NUMBER_OF_REGIONS_IN_WIDTH]
+                                  [MAX_NUMBER_OF_REGIONS_IN_HEIGHT];
+    // Luma intensity change between the previous picture and the one before it
+    int16_t  prev_intensity_delta[MAX_NUMBER_OF_REGIONS_IN_WIDTH]
+                                [MAX_NUMBER_OF_REGIONS_IN_HEIGHT];
+    // Pictures left in a two-picture flash detected in the region
+    uint8_t  flash_hold[MAX_NUMBER_OF_REGIONS_IN_WIDTH][MAX_NUMBER_OF_REGIONS_IN_HEIGHT];
     // Dynamic GOP
     uint32_t ttl_region_activity_cost[MAX_NUMBER_OF_REGIONS_IN_WIDTH]
                                      [MAX_NUMBER_OF_REGIONS_IN_HEIGHT];
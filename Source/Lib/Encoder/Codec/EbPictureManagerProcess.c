@@ -900,6 +900,17 @@ void *picture_manager_kernel(void *input_ptr) {
                                              child_pcs_ptr->input_frame16bit);
                         }
 
+                        // the input frame 16 bit buffer is the 16-bit copy of the source
+                        // kept by the parent, it is filled by the first pass over each SB
+                        if (scs_ptr->static_config.hbd_16bit_source) {
+                            EbPictureBufferDesc *src_pic_16bit =
+                                entry_pcs_ptr->enhanced_picture16bit_ptr;
+                            copy_buffer_info(src_pic_16bit, child_pcs_ptr->input_frame16bit);
+                            child_pcs_ptr->input_frame16bit->buffer_y  = src_pic_16bit->buffer_y;
+                            child_pcs_ptr->input_frame16bit->buffer_cb = src_pic_16bit->buffer_cb;
+                            child_pcs_ptr->input_frame16bit->buffer_cr = src_pic_16bit->buffer_cr;
+                        }
+
                         //                        child_pcs_ptr->parent_pcs_ptr->av1_cm->pcs_ptr = child_pcs_ptr;
                         // Palette
                         rtime_alloc_palette_tokens(scs_ptr, child_pcs_ptr);
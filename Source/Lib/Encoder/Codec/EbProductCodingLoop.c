@@ -7093,6 +7093,9 @@ void full_loop_core_light_pd1(PictureControlSet *pcs_ptr, BlkStruct *blk_ptr,
             }
         }
     }
+    // Static SBs are coded without residual
+    if (context_ptr->static_sb)
+        perform_tx = 0;
     const uint8_t recon_needed = do_md_recon(pcs_ptr->parent_pcs_ptr, context_ptr);
 
     // If need 10bit prediction, perform luma compensation before TX
@@ -9679,8 +9682,8 @@ void md_encode_block_light_pd1(PictureControlSet *pcs_ptr, ModeDecisionContext *
         context_ptr->cand_reduction_ctrls.use_neighbouring_mode_ctrls.enabled
         ? is_intra_bordered(context_ptr)
         : 0;
-    // Read and (if needed) perform 1/8 Pel ME MVs refinement
-    if (pcs_ptr->slice_type != I_SLICE)
+    // Read and (if needed) perform 1/8 Pel ME MVs refinement; static SBs only use the (0,0) MV
+    if (pcs_ptr->slice_type != I_SLICE && !context_ptr->static_sb)
         read_refine_me_mvs_light_pd1(pcs_ptr, input_picture_ptr, context_ptr);
     generate_md_stage_0_cand_light_pd1(
         context_ptr->sb_ptr, context_ptr, &fast_candidate_total_count, pcs_ptr);
@@ -9698,7 +9701,8 @@ void md_encode_block_light_pd1(PictureControlSet *pcs_ptr, ModeDecisionContext *
 
     // If there is only a single candidate, skip compensation if transform will be skipped (unless compensation is needed for recon)
     if (fast_candidate_total_count > 1 || perform_md_recon ||
-        context_ptr->lpd1_skip_inter_tx_level < 2 || fast_candidate_array[0].type == INTRA_MODE) {
+        (context_ptr->lpd1_skip_inter_tx_level < 2 && !context_ptr->static_sb) ||
+        fast_candidate_array[0].type == INTRA_MODE) {
         md_stage_0_light_pd1(pcs_ptr,
                              context_ptr,
                              candidate_buffer_ptr_array_base,
@@ -10598,6 +10602,11 @@ uint8_t update_md_settings_based_on_sq_coeff_area(ModeDecisionContext *ctx) {
 EbPictureBufferDesc *pad_hbd_pictures(SequenceControlSet *scs, PictureControlSet *pcs,
                                       ModeDecisionContext *ctx, EbPictureBufferDesc *in_pic,
                                       uint16_t sb_org_x, uint16_t sb_org_y) {
+    // with hbd_16bit_source the SB is packed in place in the input frame 16 bit
+    if (!ctx->hbd_pack_done && scs->static_config.hbd_16bit_source) {
+        pack_input_frame16bit_sb(scs, pcs, in_pic, sb_org_x, sb_org_y);
+        ctx->hbd_pack_done = 1;
+    }
     //perform the packing of 10bit if not done in previous PD passes
     if (!ctx->hbd_pack_done) {
         const uint32_t input_luma_offset = ((sb_org_y + in_pic->origin_y) * in_pic->stride_y) +
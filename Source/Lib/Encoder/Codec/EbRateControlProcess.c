@@ -1058,6 +1058,10 @@ int compute_rdmult_sse(PictureControlSet *pcs_ptr, uint8_t q_index, uint8_t bit_
                   q_factor[pcs_ptr->parent_pcs_ptr->tpl_ctrls.vq_adjust_lambda_sb - 1][qidx]) >>
             7;
     }
+    // Lambda scaling of the external rate control
+    const EbFrameRcParams *ext_rc_params = pcs_ptr->parent_pcs_ptr->ext_rc_params;
+    if (ext_rc_params && ext_rc_params->lambda_scale)
+        rdmult = AOMMAX((rdmult * ext_rc_params->lambda_scale) >> 7, 1);
     return (int)rdmult;
 }
 static void sb_setup_lambda(PictureControlSet *pcs_ptr, SuperBlock *sb_ptr) {
@@ -1164,6 +1168,42 @@ void sb_qp_derivation_tpl_la(PictureControlSet *pcs_ptr) {
     }
 }
 
+/******************************************************
+ * ext_rc_frame_qindex
+ * Sets the frame qindex decided by the external rate control
+ ******************************************************/
+static void ext_rc_frame_qindex(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr) {
+    FrameHeader *frm_hdr = &pcs_ptr->parent_pcs_ptr->frm_hdr;
+    frm_hdr->quantization_params.base_q_idx = (uint8_t)CLIP3(
+        (int32_t)quantizer_to_qindex[scs_ptr->static_config.min_qp_allowed],
+        (int32_t)quantizer_to_qindex[scs_ptr->static_config.max_qp_allowed],
+        (int32_t)pcs_ptr->parent_pcs_ptr->ext_rc_params->qindex);
+    pcs_ptr->picture_qp = (uint8_t)CLIP3((int32_t)scs_ptr->static_config.min_qp_allowed,
+                                         (int32_t)scs_ptr->static_config.max_qp_allowed,
+                                         (frm_hdr->quantization_params.base_q_idx + 2) >> 2);
+}
+
+/******************************************************
+ * ext_rc_sb_qindex
+ * Sets the QP per SB from the delta qindex map of the external rate control
+ ******************************************************/
+static void ext_rc_sb_qindex(PictureControlSet *pcs_ptr) {
+    PictureParentControlSet *ppcs_ptr      = pcs_ptr->parent_pcs_ptr;
+    const EbFrameRcParams   *ext_rc_params = ppcs_ptr->ext_rc_params;
+    const int32_t            delta_q_res   = ppcs_ptr->frm_hdr.delta_q_params.delta_q_res;
+    const int32_t            base_q_idx    = ppcs_ptr->frm_hdr.quantization_params.base_q_idx;
+
+    ppcs_ptr->frm_hdr.delta_q_params.delta_q_present = 1;
+    for (uint32_t sb_addr = 0; sb_addr < pcs_ptr->sb_total_count_pix; ++sb_addr) {
+        const int32_t offset = sb_addr < ext_rc_params->sb_delta_qindex_count
+            ? ext_rc_params->sb_delta_qindex[sb_addr]
+            : 0;
+        // The coded delta is a multiple of delta_q_res
+        pcs_ptr->sb_ptr_array[sb_addr]->qindex = CLIP3(
+            delta_q_res, 255 - delta_q_res, base_q_idx + offset / delta_q_res * delta_q_res);
+    }
+}
+
 static int av1_find_qindex(double desired_q, aom_bit_depth_t bit_depth, int best_qindex,
                            int worst_qindex) {
     assert(best_qindex <= worst_qindex);
@@ -2042,6 +2082,88 @@ static void av1_rc_update_rate_correction_factors(PictureParentControlSet *ppcs_
     set_rate_correction_factor(ppcs_ptr, rate_correction_factor /*, width, height*/);
 }
 
+// In-flight accounting for one pass CBR. A picture is charged against the buffer
+// model as soon as rate control assigns its target, and the charge is refined
+// with the mode decision rate estimate once EncDec finishes, so the next targets
+// do not have to wait for the packetization feedback of every picture in flight.
+static EbBool rc_inflight_enabled(const SequenceControlSet *scs_ptr) {
+    return scs_ptr->static_config.cbr_inflight_estimates &&
+        scs_ptr->static_config.rate_control_mode == 2 &&
+        scs_ptr->static_config.pass == ENC_SINGLE_PASS &&
+        scs_ptr->static_config.pred_structure == EB_PRED_LOW_DELAY_P;
+}
+
+static void rc_update_inflight_size(PictureParentControlSet *ppcs_ptr, int frame_size) {
+    EncodeContext *encode_context_ptr = ppcs_ptr->scs_ptr->encode_context_ptr;
+    const int64_t  bits               = (int64_t)frame_size - ppcs_ptr->inflight_budget;
+
+    svt_block_on_mutex(encode_context_ptr->inflight_mutex);
+    if (ppcs_ptr->inflight) {
+        encode_context_ptr->inflight_bits += bits - ppcs_ptr->inflight_bits;
+        ppcs_ptr->inflight_bits = bits;
+    }
+    svt_release_mutex(encode_context_ptr->inflight_mutex);
+}
+
+// Project the buffer level past the pictures still in flight
+static void rc_project_inflight_buffer_level(SequenceControlSet *scs_ptr) {
+    EncodeContext *encode_context_ptr = scs_ptr->encode_context_ptr;
+    RATE_CONTROL  *rc                 = &encode_context_ptr->rc;
+
+    svt_block_on_mutex(encode_context_ptr->inflight_mutex);
+    const int64_t inflight_bits = encode_context_ptr->inflight_bits;
+    svt_release_mutex(encode_context_ptr->inflight_mutex);
+    rc->buffer_level = AOMMIN(rc->bits_off_target - inflight_bits, rc->maximum_buffer_size);
+}
+
+static void rc_register_inflight(PictureParentControlSet *ppcs_ptr) {
+    RATE_CONTROL *rc = &ppcs_ptr->scs_ptr->encode_context_ptr->rc;
+
+    ppcs_ptr->inflight          = EB_TRUE;
+    ppcs_ptr->inflight_bits     = 0;
+    ppcs_ptr->inflight_estimate = 0;
+    ppcs_ptr->inflight_budget   = ppcs_ptr->frm_hdr.showable_frame ? rc->avg_frame_bandwidth : 0;
+    rc_update_inflight_size(ppcs_ptr, ppcs_ptr->this_frame_target);
+}
+
+void svt_av1_rc_inflight_encdec_estimate(PictureParentControlSet *ppcs_ptr) {
+    EncodeContext *encode_context_ptr = ppcs_ptr->scs_ptr->encode_context_ptr;
+
+    if (!rc_inflight_enabled(ppcs_ptr->scs_ptr) || !ppcs_ptr->inflight)
+        return;
+    svt_block_on_mutex(ppcs_ptr->pcs_total_rate_mutex);
+    const int estimate = (int)(((ppcs_ptr->pcs_total_rate + (1 << (AV1_PROB_COST_SHIFT - 1))) >>
+                                AV1_PROB_COST_SHIFT) +
+                               ((ppcs_ptr->frm_hdr.frame_type == KEY_FRAME) ? 13 : 0));
+    svt_release_mutex(ppcs_ptr->pcs_total_rate_mutex);
+    svt_block_on_mutex(encode_context_ptr->inflight_mutex);
+    const double ratio = encode_context_ptr->inflight_size_ratio;
+    svt_release_mutex(encode_context_ptr->inflight_mutex);
+
+    ppcs_ptr->inflight_estimate = estimate;
+    rc_update_inflight_size(ppcs_ptr, (int)(estimate * ratio + 0.5));
+}
+
+// Drop the picture's charge once its actual size is known and recalibrate the
+// estimate against it.
+static void rc_release_inflight(PictureParentControlSet *ppcs_ptr) {
+    EncodeContext *encode_context_ptr = ppcs_ptr->scs_ptr->encode_context_ptr;
+
+    svt_block_on_mutex(encode_context_ptr->inflight_mutex);
+    if (ppcs_ptr->inflight) {
+        encode_context_ptr->inflight_bits -= ppcs_ptr->inflight_bits;
+        ppcs_ptr->inflight      = EB_FALSE;
+        ppcs_ptr->inflight_bits = 0;
+        if (ppcs_ptr->inflight_estimate > 0 && ppcs_ptr->projected_frame_size > 0) {
+            const double ratio = (double)ppcs_ptr->projected_frame_size /
+                ppcs_ptr->inflight_estimate;
+            encode_context_ptr->inflight_size_ratio = fclamp(
+                0.875 * encode_context_ptr->inflight_size_ratio + 0.125 * ratio, 0.5, 2.0);
+        }
+    }
+    svt_release_mutex(encode_context_ptr->inflight_mutex);
+}
+
 // Update the buffer level: leaky bucket model.
 static void update_buffer_level(PictureParentControlSet *ppcs_ptr, int encoded_frame_size) {
     SequenceControlSet *scs_ptr            = ppcs_ptr->scs_ptr;
@@ -2114,6 +2236,7 @@ static void av1_rc_postencode_update(PictureParentControlSet *ppcs_ptr) {
         rc->last_boosted_qindex = qindex;
     }
     update_buffer_level(ppcs_ptr, ppcs_ptr->projected_frame_size);
+    rc_release_inflight(ppcs_ptr);
     rc->prev_avg_frame_bandwidth = rc->avg_frame_bandwidth;
 
     // Rolling monitors of whether we are over or underspending used to help
@@ -2164,7 +2287,7 @@ static void vbr_rate_correction(PictureControlSet *pcs_ptr, int *this_frame_targ
     TWO_PASS *const     twopass             = &scs_ptr->twopass;
     int64_t             vbr_bits_off_target = rc->vbr_bits_off_target;
     const int           stats_count         = twopass->stats_buf_ctx->total_stats != NULL
-                          ? (int)twopass->stats_buf_ctx->total_stats->count
+                          ? (int)svt_av1_twopass_coded_frames(scs_ptr)
                           : 0;
     const int frame_window = AOMMIN(16, (int)(stats_count - (int)pcs_ptr->picture_number));
     assert(VBR_PCT_ADJUSTMENT_LIMIT <= 100);
@@ -2347,7 +2470,7 @@ static void capped_crf_reencode(PictureParentControlSet *ppcs_ptr, int *const q)
         CODED_FRAMES_STAT_QUEUE_MAX_DEPTH;
     int32_t end_index   = start_index + frames_in_sw;
     frames_in_sw        = (scs_ptr->passes > 1)
-               ? MIN(end_index, (int32_t)scs_ptr->twopass.stats_buf_ctx->total_stats->count) - start_index
+               ? MIN(end_index, (int32_t)svt_av1_twopass_coded_frames(scs_ptr)) - start_index
                : frames_in_sw;
     int64_t max_bits_sw = (int64_t)scs_ptr->static_config.max_bit_rate * (int32_t)frames_in_sw /
         frame_rate;
@@ -2777,9 +2900,11 @@ static void restore_param(PictureParentControlSet         *ppcs_ptr,
                 scs_ptr->static_config.pass == ENC_LAST_PASS) &&
               scs_ptr->static_config.pass != ENC_FIRST_PASS &&
               scs_ptr->static_config.rate_control_mode == 2))
+            // Position in the stats rather than frame number: a chunk does not start at frame 0
             key_max = (int)MIN(
                 kf_cfg->key_freq_max,
-                (int)((int64_t)((scs_ptr->twopass.stats_buf_ctx->stats_in_end - 1)->frame) -
+                (int)((int64_t)(scs_ptr->twopass.stats_buf_ctx->stats_in_end - 1 -
+                                scs_ptr->twopass.stats_buf_ctx->stats_in_start) -
                       ppcs_ptr->last_idr_picture + 1));
     }
     if (!(!(scs_ptr->static_config.pass == ENC_MIDDLE_PASS ||
@@ -3056,7 +3181,7 @@ void *rate_control_kernel(void *input_ptr) {
             rc                   = &scs_ptr->encode_context_ptr->rc;
             if (scs_ptr->passes > 1 && scs_ptr->static_config.max_bit_rate)
                 rc->rate_average_periodin_frames =
-                    (uint64_t)scs_ptr->twopass.stats_buf_ctx->total_stats->count;
+                    (uint64_t)svt_av1_twopass_coded_frames(scs_ptr);
             else
                 rc->rate_average_periodin_frames = 60;
             if (!is_superres_recode_task) {
@@ -3090,6 +3215,8 @@ void *rate_control_kernel(void *input_ptr) {
                         av1_rc_init(scs_ptr);
                     }
                     restore_param(pcs_ptr->parent_pcs_ptr, rate_control_param_ptr);
+                    if (rc_inflight_enabled(scs_ptr))
+                        rc_project_inflight_buffer_level(scs_ptr);
                     if (scs_ptr->static_config.rate_control_mode == 2 &&
                         scs_ptr->static_config.pred_structure == EB_PRED_LOW_DELAY_P)
                         svt_av1_get_one_pass_rt_params(pcs_ptr->parent_pcs_ptr);
@@ -3099,6 +3226,8 @@ void *rate_control_kernel(void *input_ptr) {
                     av1_configure_buffer_updates(
                         pcs_ptr, &(pcs_ptr->parent_pcs_ptr->refresh_frame), 0);
                     av1_set_target_rate(pcs_ptr);
+                    if (rc_inflight_enabled(scs_ptr))
+                        rc_register_inflight(pcs_ptr->parent_pcs_ptr);
                     store_param(pcs_ptr->parent_pcs_ptr, rate_control_param_ptr);
                 }
             }
@@ -3240,9 +3369,14 @@ void *rate_control_kernel(void *input_ptr) {
                 }
                 frm_hdr->quantization_params.base_q_idx = quantizer_to_qindex[pcs_ptr->picture_qp];
             }
+            // The external rate control bypasses the internal qindex decision
+            const EbFrameRcParams *ext_rc_params = pcs_ptr->parent_pcs_ptr->ext_rc_params;
+            if (ext_rc_params && ext_rc_params->qindex)
+                ext_rc_frame_qindex(pcs_ptr, scs_ptr);
             if (pcs_ptr->parent_pcs_ptr->slice_type == I_SLICE) {
                 rate_control_param_ptr->last_i_qp = pcs_ptr->picture_qp;
-            } else if (pcs_ptr->parent_pcs_ptr->transition_present) {
+            } else if (pcs_ptr->parent_pcs_ptr->transition_present &&
+                       !(ext_rc_params && ext_rc_params->qindex)) {
                 uint32_t min_ref_qp = rate_control_param_ptr->last_i_qp;
                 if (pcs_ptr->ref_slice_type_array[0][0] != I_SLICE)
                     min_ref_qp = pcs_ptr->ref_pic_qp_array[0][0];
@@ -3262,9 +3396,10 @@ void *rate_control_kernel(void *input_ptr) {
             if (!is_superres_recode_task) {
                 // Determine superres parameters for 1-pass encoding or 2nd pass of 2-pass encoding
                 // if superres_mode is SUPERRES_QTHRESH or SUPERRES_AUTO.
-                // SUPERRES_FIXED and SUPERRES_RANDOM modes are handled in picture decision process.
+                // SUPERRES_FIXED, SUPERRES_RANDOM and SUPERRES_DYNAMIC modes are handled in picture decision process.
                 if (scs_ptr->static_config.pass == ENC_SINGLE_PASS) {
-                    if (scs_ptr->static_config.superres_mode > SUPERRES_RANDOM) {
+                    if (scs_ptr->static_config.superres_mode == SUPERRES_QTHRESH ||
+                        scs_ptr->static_config.superres_mode == SUPERRES_AUTO) {
                         // determine denom and scale down picture by selected denom
                         init_resize_picture(scs_ptr, pcs_ptr->parent_pcs_ptr);
                         if (pcs_ptr->parent_pcs_ptr->frame_superres_enabled) {
@@ -3331,8 +3466,11 @@ void *rate_control_kernel(void *input_ptr) {
             }
 
             // QPM with tpl_la
-            if (scs_ptr->static_config.enable_adaptive_quantization == 2 &&
-                pcs_ptr->parent_pcs_ptr->tpl_ctrls.enable && pcs_ptr->parent_pcs_ptr->r0 != 0) {
+            if (ext_rc_params && ext_rc_params->sb_delta_qindex)
+                ext_rc_sb_qindex(pcs_ptr);
+            else if (scs_ptr->static_config.enable_adaptive_quantization == 2 &&
+                     pcs_ptr->parent_pcs_ptr->tpl_ctrls.enable &&
+                     pcs_ptr->parent_pcs_ptr->r0 != 0) {
                 sb_qp_derivation_tpl_la(pcs_ptr);
             } else {
                 pcs_ptr->parent_pcs_ptr->frm_hdr.delta_q_params.delta_q_present = 0;
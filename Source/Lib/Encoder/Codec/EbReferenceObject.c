@@ -242,6 +242,11 @@ static void svt_pa_reference_object_dctor(EbPtr p) {
         }
         EB_DESTROY_MUTEX(obj->resize_mutex[denom_idx]);
     }
+    svt_av1_hash_table_destroy(&obj->hash_table);
+    free(obj->block_hash[0]);
+    free(obj->block_hash[1]);
+    free(obj->block_hash_added);
+    EB_DESTROY_MUTEX(obj->hash_mutex);
 }
 
 /*****************************************
@@ -276,6 +281,8 @@ EbErrorType svt_pa_reference_object_ctor(EbPaReferenceObject *pa_ref_obj_,
         pa_ref_obj_->downscaled_picture_number[down_idx]                    = (uint64_t)~0;
         EB_CREATE_MUTEX(pa_ref_obj_->resize_mutex[down_idx]);
     }
+    pa_ref_obj_->hash_picture_number = (uint64_t)~0;
+    EB_CREATE_MUTEX(pa_ref_obj_->hash_mutex);
 
     return EB_ErrorNone;
 }
@@ -17,6 +17,7 @@
 #include "EbCabacContextModel.h"
 #include "EbCodingUnit.h"
 #include "EbSequenceControlSet.h"
+#include "hash_motion.h"
 
 typedef struct EbReferenceObject {
     EbDctor                     dctor;
@@ -79,6 +80,13 @@ typedef struct EbPaReferenceObject {
     EbHandle resize_mutex[NUM_SCALES];
     uint64_t picture_number;
     uint8_t  dummy_obj;
+    // hashes of the 64x64 blocks of input_padded_picture_ptr, built on demand by
+    // the hash based motion search of screen content pictures
+    HashTable hash_table;
+    uint32_t *block_hash[2];
+    int8_t   *block_hash_added;
+    uint64_t  hash_picture_number; // picture_number the hashes were built for
+    EbHandle  hash_mutex;
 } EbPaReferenceObject;
 
 typedef struct EbPaReferenceObjectDescInitData {
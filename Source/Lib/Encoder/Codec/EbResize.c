@@ -1144,6 +1144,8 @@ static void analyze_hor_freq(PictureParentControlSet *pcs_ptr, double *energy) {
 #define SUPERRES_ENERGY_BY_Q2_THRESH_KEYFRAME 0.008
 #define SUPERRES_ENERGY_BY_Q2_THRESH_ARFFRAME 0.008
 #define SUPERRES_ENERGY_BY_AC_THRESH 0.2
+// Relaxation of the energy thresholds deciding whether superres is tried in the recode loop
+#define SUPERRES_ENERGY_RECODE_FACTOR 2.0
 
 static double get_energy_by_q2_thresh(const RATE_CONTROL *rc, int frame_update_type) {
     // TODO(now): Return keyframe thresh * factor based on frame type / pyramid
@@ -1243,8 +1245,16 @@ static uint8_t get_superres_denom_for_qindex(SequenceControlSet      *scs_ptr,
     if (av1_superres_in_recode_allowed(scs_ptr)) {
         assert(scs_ptr->static_config.superres_mode != SUPERRES_NONE);
         // Force superres to be tried in the recode loop, as full-res is also going
-        // to be tried anyway.
-        denom = AOMMAX(denom, SCALE_NUMERATOR + 1);
+        // to be tried anyway, but only when the frame would be downscaled with relaxed
+        // energy thresholds. Otherwise superres has no chance to win and the extra
+        // coding loop is skipped.
+        const int trial_denom = get_superres_denom_from_qindex_energy(
+            qindex,
+            energy,
+            energy_by_q2_thresh * SUPERRES_ENERGY_RECODE_FACTOR,
+            SUPERRES_ENERGY_BY_AC_THRESH * SUPERRES_ENERGY_RECODE_FACTOR);
+        if (trial_denom != SCALE_NUMERATOR)
+            denom = AOMMAX(denom, SCALE_NUMERATOR + 1);
     }
     return denom;
 }
@@ -1280,6 +1290,11 @@ static void calc_superres_params(superres_params_type *spr_params, SequenceContr
             spr_params->superres_denom = cfg_denom;
         break;
     case SUPERRES_RANDOM: spr_params->superres_denom = (uint8_t)(lcg_rand16(&seed) % 9 + 8); break;
+    case SUPERRES_DYNAMIC:
+        // Key frames are always coded at full resolution
+        if (frm_hdr->frame_type != KEY_FRAME)
+            spr_params->superres_denom = pcs_ptr->dyn_superres_denom;
+        break;
     case SUPERRES_QTHRESH: {
         // Do not use superres when screen content tools are used.
         if (frm_hdr->allow_screen_content_tools)
@@ -1315,8 +1330,8 @@ static void calc_superres_params(superres_params_type *spr_params, SequenceContr
                 }
             } else { // SUPERRES_AUTO_ALL
                 assert(sr_search_type == SUPERRES_AUTO_ALL);
-                int32_t update_type = get_frame_update_type(scs_ptr, pcs_ptr);
-                if (update_type == KF_UPDATE || update_type == ARF_UPDATE) {
+                // Only search the frames for which superres could be selected
+                if (get_superres_denom_for_qindex(scs_ptr, pcs_ptr, q, 1, 1) != SCALE_NUMERATOR) {
                     for (int i = 0; i < SCALE_NUMERATOR + 1; i++) {
                         if (i < SCALE_NUMERATOR) {
                             pcs_ptr->superres_denom_array[i] = SCALE_NUMERATOR + 1 + i;
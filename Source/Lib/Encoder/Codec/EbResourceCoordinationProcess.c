@@ -43,17 +43,16 @@ typedef struct ResourceCoordinationContext {
     // Picture Number Array
     uint64_t *picture_number_array;
 
-    uint64_t average_enc_mod;
-    uint8_t  prev_enc_mod;
-    int8_t   prev_enc_mode_delta;
-    uint8_t  prev_change_cond;
-
-    int64_t previous_mode_change_buffer;
+    // Real-time speed control
+    uint8_t prev_enc_mod;
+    int8_t  prev_enc_mode_delta;
     int64_t previous_mode_change_frame_in;
     int64_t previous_buffer_check1;
     int64_t previous_frame_in_check1;
-    int64_t previous_frame_in_check2;
-    int64_t previous_frame_in_check3;
+    // Frames the encoder took ahead of the live source clock
+    int64_t sc_frame_credit;
+    // Frames without preset change before trying a slower preset again
+    int64_t probe_interval;
 
     uint64_t cur_speed; // speed x 1000
     uint64_t prevs_time_seconds;
@@ -62,7 +61,6 @@ typedef struct ResourceCoordinationContext {
 
     uint64_t first_in_pic_arrived_time_seconds;
     uint64_t first_in_pic_arrived_timeu_seconds;
-    EbBool   start_flag;
 } ResourceCoordinationContext;
 
 static void resource_coordination_context_dctor(EbPtr p) {
@@ -113,24 +111,19 @@ EbErrorType resource_coordination_context_ctor(EbThreadContext *thread_contxt_pt
 
     EB_CALLOC_ARRAY(context_ptr->picture_number_array, context_ptr->encode_instances_total_count);
 
-    context_ptr->average_enc_mod                    = 0;
     context_ptr->prev_enc_mod                       = 0;
     context_ptr->prev_enc_mode_delta                = 0;
     context_ptr->cur_speed                          = 0; // speed x 1000
-    context_ptr->previous_mode_change_buffer        = 0;
     context_ptr->first_in_pic_arrived_time_seconds  = 0;
     context_ptr->first_in_pic_arrived_timeu_seconds = 0;
     context_ptr->previous_frame_in_check1           = 0;
-    context_ptr->previous_frame_in_check2           = 0;
-    context_ptr->previous_frame_in_check3           = 0;
     context_ptr->previous_mode_change_frame_in      = 0;
+    context_ptr->previous_buffer_check1             = 0;
+    context_ptr->sc_frame_credit                    = 0;
+    context_ptr->probe_interval                     = 0;
     context_ptr->prevs_time_seconds                 = 0;
     context_ptr->prevs_timeu_seconds                = 0;
     context_ptr->prev_frame_out                     = 0;
-    context_ptr->start_flag                         = EB_FALSE;
-
-    context_ptr->previous_buffer_check1 = 0;
-    context_ptr->prev_change_cond       = 0;
 
     return EB_ErrorNone;
 }
@@ -434,28 +427,30 @@ EbErrorType signal_derivation_pre_analysis_oq_scs(SequenceControlSet *scs_ptr) {
 //******************************************************************************//
 void speed_buffer_control(ResourceCoordinationContext *context_ptr,
                           PictureParentControlSet *pcs_ptr, SequenceControlSet *scs_ptr) {
-    uint64_t curs_time_seconds  = 0;
-    uint64_t curs_time_useconds = 0;
-    double   overall_duration   = 0.0;
-    double   inst_duration      = 0.0;
-    int8_t   encoder_mode_delta = 0;
-    int64_t  input_frames_count = 0;
-    int8_t   change_cond        = 0;
-    int64_t  target_fps         = (60 >> 16);
-
-    int64_t buffer_threshold_1 = SC_FRAMES_INTERVAL_T1;
-    int64_t buffer_threshold_2 = SC_FRAMES_INTERVAL_T2;
-    int64_t buffer_threshold_3 = MIN(target_fps * 3, SC_FRAMES_INTERVAL_T3);
-    svt_block_on_mutex(scs_ptr->encode_context_ptr->sc_buffer_mutex);
-
-    if (scs_ptr->encode_context_ptr->sc_frame_in == 0)
-        svt_av1_get_time(&context_ptr->first_in_pic_arrived_time_seconds,
-                         &context_ptr->first_in_pic_arrived_timeu_seconds);
-    else if (scs_ptr->encode_context_ptr->sc_frame_in == SC_FRAMES_TO_IGNORE)
-        context_ptr->start_flag = EB_TRUE;
-    // Compute duration since the start of the encode and since the previous checkpoint
-    svt_av1_get_time(&curs_time_seconds, &curs_time_useconds);
+    EncodeContext *encode_context_ptr = scs_ptr->encode_context_ptr;
+    uint64_t       curs_time_seconds  = 0;
+    uint64_t       curs_time_useconds = 0;
+    double         overall_duration   = 0.0;
+    double         inst_duration      = 0.0;
+    int8_t         encoder_mode_delta = 0;
+    int64_t        input_frames_count = 0;
+    const int64_t  target_fps         = (int64_t)scs_ptr->static_config.target_fps;
+    // Check the buffer SC_CHECKS_PER_SECOND times per second of input and give a new preset
+    // one second of input to flow through the pipeline before judging it
+    const int64_t check_interval = MAX(target_fps / SC_CHECKS_PER_SECOND, 1);
+    const int64_t change_hold    = target_fps;
+    svt_block_on_mutex(encode_context_ptr->sc_buffer_mutex);
 
+    svt_av1_get_time(&curs_time_seconds, &curs_time_useconds);
+    if (encode_context_ptr->sc_frame_in == 0) {
+        context_ptr->first_in_pic_arrived_time_seconds  = curs_time_seconds;
+        context_ptr->first_in_pic_arrived_timeu_seconds = curs_time_useconds;
+        context_ptr->prevs_time_seconds                 = curs_time_seconds;
+        context_ptr->prevs_timeu_seconds                = curs_time_useconds;
+        context_ptr->probe_interval                     = target_fps * SC_PROBE_SECONDS;
+        encode_context_ptr->enc_mode = (EbEncMode)scs_ptr->static_config.enc_mode;
+    }
+    // Compute duration since the start of the encode and since the previous checkpoint
     overall_duration = svt_av1_compute_overall_elapsed_time_ms(
         context_ptr->first_in_pic_arrived_time_seconds,
         context_ptr->first_in_pic_arrived_timeu_seconds,
@@ -467,141 +462,68 @@ void speed_buffer_control(ResourceCoordinationContext *context_ptr,
                                                             curs_time_seconds,
                                                             curs_time_useconds);
 
-    input_frames_count                     = (int64_t)overall_duration * (60 >> 16) / 1000;
-    scs_ptr->encode_context_ptr->sc_buffer = input_frames_count -
-        scs_ptr->encode_context_ptr->sc_frame_in;
-
-    encoder_mode_delta = 0;
-
-    // Check every bufferTsshold1 for the changes (previous_frame_in_check1 variable)
-    if ((scs_ptr->encode_context_ptr->sc_frame_in >
-             context_ptr->previous_frame_in_check1 + buffer_threshold_1 &&
-         scs_ptr->encode_context_ptr->sc_frame_in >= SC_FRAMES_TO_IGNORE)) {
-        // Go to a slower mode based on the fullness and changes of the buffer
-        if (scs_ptr->encode_context_ptr->sc_buffer < target_fps &&
-            (context_ptr->prev_enc_mode_delta > -1 ||
-             (context_ptr->prev_enc_mode_delta < 0 &&
-              scs_ptr->encode_context_ptr->sc_frame_in >
-                  context_ptr->previous_mode_change_frame_in + target_fps * 2))) {
-            if (context_ptr->previous_buffer_check1 >
-                scs_ptr->encode_context_ptr->sc_buffer + buffer_threshold_1) {
-                encoder_mode_delta += -1;
-                change_cond = 2;
-            } else if (context_ptr->previous_mode_change_buffer >
-                           buffer_threshold_1 + scs_ptr->encode_context_ptr->sc_buffer &&
-                       scs_ptr->encode_context_ptr->sc_buffer < buffer_threshold_1) {
-                encoder_mode_delta += -1;
-                change_cond = 4;
-            }
-        }
-
-        // Go to a faster mode based on the fullness and changes of the buffer
-        if (scs_ptr->encode_context_ptr->sc_buffer >
-            buffer_threshold_1 + context_ptr->previous_buffer_check1) {
-            encoder_mode_delta += +1;
-            change_cond = 1;
-        } else if (scs_ptr->encode_context_ptr->sc_buffer >
-                   buffer_threshold_1 + context_ptr->previous_mode_change_buffer) {
-            encoder_mode_delta += +1;
-            change_cond = 3;
-        }
-
-        // Update the encode mode based on the fullness of the buffer
-        // If previous ChangeCond was the same, double the threshold2
-        if (scs_ptr->encode_context_ptr->sc_buffer > buffer_threshold_3 &&
-            (context_ptr->prev_change_cond != 7 ||
-             scs_ptr->encode_context_ptr->sc_frame_in >
-                 context_ptr->previous_mode_change_frame_in + buffer_threshold_2 * 2) &&
-            scs_ptr->encode_context_ptr->sc_buffer > context_ptr->previous_mode_change_buffer) {
-            encoder_mode_delta += 1;
-            change_cond = 7;
-        }
-        encoder_mode_delta                    = CLIP3(-1, 1, encoder_mode_delta);
-        scs_ptr->encode_context_ptr->enc_mode = (EbEncMode)CLIP3(
-            1, MAX_ENC_PRESET, (int8_t)scs_ptr->encode_context_ptr->enc_mode + encoder_mode_delta);
-
-        // Update previous stats
-        context_ptr->previous_frame_in_check1 = scs_ptr->encode_context_ptr->sc_frame_in;
-        context_ptr->previous_buffer_check1   = scs_ptr->encode_context_ptr->sc_buffer;
-
-        if (encoder_mode_delta) {
-            context_ptr->previous_mode_change_buffer   = scs_ptr->encode_context_ptr->sc_buffer;
-            context_ptr->previous_mode_change_frame_in = scs_ptr->encode_context_ptr->sc_frame_in;
-            context_ptr->prev_enc_mode_delta           = encoder_mode_delta;
-        }
+    // Frames a live source running at target_fps has delivered so far. The source cannot run
+    // ahead of the clock : frames taken early are credited, as the encoder would have waited.
+    input_frames_count = (int64_t)(overall_duration * target_fps / 1000) +
+        context_ptr->sc_frame_credit;
+    encode_context_ptr->sc_buffer = input_frames_count - encode_context_ptr->sc_frame_in;
+    if (encode_context_ptr->sc_buffer < 0) {
+        context_ptr->sc_frame_credit -= encode_context_ptr->sc_buffer;
+        encode_context_ptr->sc_buffer = 0;
     }
 
-    // Check every buffer_threshold_2 for the changes (previous_frame_in_check2 variable)
-    if ((scs_ptr->encode_context_ptr->sc_frame_in >
-             context_ptr->previous_frame_in_check2 + buffer_threshold_2 &&
-         scs_ptr->encode_context_ptr->sc_frame_in >= SC_FRAMES_TO_IGNORE)) {
-        encoder_mode_delta = 0;
-
-        // if no change in the encoder mode and buffer is low enough and level is not increasing, switch to a slower encoder mode
-        // If previous ChangeCond was the same, double the threshold2
-        if (scs_ptr->encode_context_ptr->sc_frame_in >
-                context_ptr->previous_mode_change_frame_in + buffer_threshold_2 &&
-            (context_ptr->prev_change_cond != 8 ||
-             scs_ptr->encode_context_ptr->sc_frame_in >
-                 context_ptr->previous_mode_change_frame_in + buffer_threshold_2 * 2) &&
-            ((scs_ptr->encode_context_ptr->sc_buffer - context_ptr->previous_mode_change_buffer <
-              (target_fps / 3)) ||
-             context_ptr->previous_mode_change_buffer == 0) &&
-            scs_ptr->encode_context_ptr->sc_buffer < buffer_threshold_3) {
-            encoder_mode_delta = -1;
-            change_cond        = 8;
+    if (encode_context_ptr->sc_frame_in >= target_fps &&
+        encode_context_ptr->sc_frame_in >= context_ptr->previous_frame_in_check1 + check_interval) {
+        // Measured throughput at the output of the pipeline
+        if (inst_duration > 0)
+            context_ptr->cur_speed = (uint64_t)((double)(encode_context_ptr->sc_frame_out -
+                                                         context_ptr->prev_frame_out) *
+                                                1000000 / inst_duration);
+        const int64_t frames_since_change = encode_context_ptr->sc_frame_in -
+            context_ptr->previous_mode_change_frame_in;
+
+        if (frames_since_change >= change_hold) {
+            // Falling behind the source and not catching up : go to a faster mode
+            if (encode_context_ptr->sc_buffer > target_fps / 2 &&
+                encode_context_ptr->sc_buffer >= context_ptr->previous_buffer_check1) {
+                encoder_mode_delta = 1;
+                // The last slow down did not hold : probe less often
+                if (context_ptr->prev_enc_mode_delta < 0 &&
+                    frames_since_change < context_ptr->probe_interval)
+                    context_ptr->probe_interval = MIN(context_ptr->probe_interval * 2,
+                                                      target_fps * SC_PROBE_SECONDS_MAX);
+            }
+            // Keeping up : go back to a slower mode when the measured speed leaves enough
+            // headroom, or periodically probe when the source paces the encoder
+            else if (encode_context_ptr->sc_buffer == 0 &&
+                     context_ptr->previous_buffer_check1 == 0 &&
+                     (context_ptr->cur_speed * 100 >
+                          (uint64_t)target_fps * 1000 * SC_SPEED_HEADROOM_PCT ||
+                      frames_since_change >= context_ptr->probe_interval))
+                encoder_mode_delta = -1;
         }
-
-        encoder_mode_delta                    = CLIP3(-1, 1, encoder_mode_delta);
-        scs_ptr->encode_context_ptr->enc_mode = (EbEncMode)CLIP3(
-            1, MAX_ENC_PRESET, (int8_t)scs_ptr->encode_context_ptr->enc_mode + encoder_mode_delta);
-
-        // Update previous stats
-        context_ptr->previous_frame_in_check2 = scs_ptr->encode_context_ptr->sc_frame_in;
-
-        if (encoder_mode_delta) {
-            context_ptr->previous_mode_change_buffer   = scs_ptr->encode_context_ptr->sc_buffer;
-            context_ptr->previous_mode_change_frame_in = scs_ptr->encode_context_ptr->sc_frame_in;
+        encode_context_ptr->enc_mode = (EbEncMode)CLIP3(
+            scs_ptr->static_config.enc_mode,
+            MAX_ENC_PRESET,
+            (int8_t)encode_context_ptr->enc_mode + encoder_mode_delta);
+        if (encode_context_ptr->enc_mode != context_ptr->prev_enc_mod) {
+            context_ptr->previous_mode_change_frame_in = encode_context_ptr->sc_frame_in;
             context_ptr->prev_enc_mode_delta           = encoder_mode_delta;
         }
-    }
-    // Check every SC_FRAMES_INTERVAL_SPEED frames for the speed calculation (previous_frame_in_check3 variable)
-    if (context_ptr->start_flag ||
-        (scs_ptr->encode_context_ptr->sc_frame_in >
-             context_ptr->previous_frame_in_check3 + SC_FRAMES_INTERVAL_SPEED &&
-         scs_ptr->encode_context_ptr->sc_frame_in >= SC_FRAMES_TO_IGNORE)) {
-        if (context_ptr->start_flag)
-            context_ptr->cur_speed = (uint64_t)(scs_ptr->encode_context_ptr->sc_frame_out - 0) *
-                1000 / (uint64_t)(overall_duration);
-        else {
-            if (inst_duration != 0)
-                context_ptr->cur_speed = (uint64_t)(scs_ptr->encode_context_ptr->sc_frame_out -
-                                                    context_ptr->prev_frame_out) *
-                    1000 / (uint64_t)(inst_duration);
-        }
-        context_ptr->start_flag = EB_FALSE;
 
         // Update previous stats
-        context_ptr->previous_frame_in_check3 = scs_ptr->encode_context_ptr->sc_frame_in;
+        context_ptr->previous_frame_in_check1 = encode_context_ptr->sc_frame_in;
+        context_ptr->previous_buffer_check1   = encode_context_ptr->sc_buffer;
         context_ptr->prevs_time_seconds       = curs_time_seconds;
         context_ptr->prevs_timeu_seconds      = curs_time_useconds;
-        context_ptr->prev_frame_out           = scs_ptr->encode_context_ptr->sc_frame_out;
-    } else if (scs_ptr->encode_context_ptr->sc_frame_in < SC_FRAMES_TO_IGNORE &&
-               (overall_duration != 0))
-        context_ptr->cur_speed = (uint64_t)(scs_ptr->encode_context_ptr->sc_frame_out - 0) * 1000 /
-            (uint64_t)(overall_duration);
-    if (change_cond)
-        context_ptr->prev_change_cond = change_cond;
-    scs_ptr->encode_context_ptr->sc_frame_in++;
-    if (scs_ptr->encode_context_ptr->sc_frame_in >= SC_FRAMES_TO_IGNORE)
-        context_ptr->average_enc_mod += scs_ptr->encode_context_ptr->enc_mode;
-    else
-        context_ptr->average_enc_mod = 0;
+        context_ptr->prev_frame_out           = encode_context_ptr->sc_frame_out;
+    }
+    encode_context_ptr->sc_frame_in++;
     // Set the encoder level
-    pcs_ptr->enc_mode = scs_ptr->encode_context_ptr->enc_mode;
+    pcs_ptr->enc_mode = encode_context_ptr->enc_mode;
 
-    svt_release_mutex(scs_ptr->encode_context_ptr->sc_buffer_mutex);
-    context_ptr->prev_enc_mod = scs_ptr->encode_context_ptr->enc_mode;
+    svt_release_mutex(encode_context_ptr->sc_buffer_mutex);
+    context_ptr->prev_enc_mod = encode_context_ptr->enc_mode;
 }
 static EbErrorType reset_pcs_av1(PictureParentControlSet *pcs_ptr) {
     FrameHeader *frm_hdr = &pcs_ptr->frm_hdr;
@@ -866,6 +788,24 @@ void read_stat(SequenceControlSet *scs_ptr) {
     EncodeContext *encode_context_ptr = scs_ptr->encode_context_ptr;
 
     encode_context_ptr->rc_stats_buffer = scs_ptr->static_config.rc_stats_buffer;
+    const uint32_t src_width            = scs_ptr->static_config.stats_source_width;
+    const uint32_t src_height           = scs_ptr->static_config.stats_source_height;
+    // ABR ladder: the stats of another rendition are rescaled to this one. Like the middle
+    // pass stats, this is done in the application buffer, so the stats written back by a
+    // middle pass are at the resolution of this encode
+    if (src_width && !encode_context_ptr->rc_stats_scaled &&
+        (src_width != scs_ptr->max_input_luma_width ||
+         src_height != scs_ptr->max_input_luma_height) &&
+        encode_context_ptr->rc_stats_buffer.buf) {
+        svt_av1_scale_stats((FIRSTPASS_STATS *)encode_context_ptr->rc_stats_buffer.buf,
+                            (size_t)(encode_context_ptr->rc_stats_buffer.sz /
+                                     sizeof(FIRSTPASS_STATS)),
+                            src_width,
+                            src_height,
+                            scs_ptr->max_input_luma_width,
+                            scs_ptr->max_input_luma_height);
+        encode_context_ptr->rc_stats_scaled = EB_TRUE;
+    }
 }
 void setup_two_pass(SequenceControlSet *scs_ptr) {
     EncodeContext *encode_context_ptr = scs_ptr->encode_context_ptr;
@@ -1181,8 +1121,9 @@ void *resource_coordination_kernel(void *input_ptr) {
             // Check whether super-res is previously enabled in this recycled parent pcs and restore to non-scale-down default if so.
             if (pcs_ptr->frame_superres_enabled)
                 reset_resized_picture(scs_ptr, pcs_ptr, pcs_ptr->enhanced_picture_ptr);
-            pcs_ptr->superres_total_recode_loop = 0;
-            pcs_ptr->superres_recode_loop       = 0;
+            pcs_ptr->superres_total_recode_loop  = 0;
+            pcs_ptr->superres_recode_loop        = 0;
+            pcs_ptr->enhanced_picture16bit_valid = EB_FALSE;
             svt_av1_get_time(&pcs_ptr->start_time_seconds, &pcs_ptr->start_time_u_seconds);
 
             pcs_ptr->scs_wrapper_ptr =
@@ -1222,9 +1163,23 @@ void *resource_coordination_kernel(void *input_ptr) {
                          : EB_FALSE;
             pcs_ptr->scene_change_flag = EB_FALSE;
             pcs_ptr->qp_on_the_fly     = EB_FALSE;
+            // Move the external rate control parameters from the input buffer to the picture,
+            // the first pass keeps its own decisions
+            pcs_ptr->ext_rc_params = NULL;
+            if (loop_index == 0 && pcs_ptr->input_ptr->p_app_private) {
+                if (scs_ptr->static_config.pass == ENC_FIRST_PASS)
+                    EB_FREE(pcs_ptr->input_ptr->p_app_private);
+                else
+                    pcs_ptr->ext_rc_params = (EbFrameRcParams *)pcs_ptr->input_ptr->p_app_private;
+                pcs_ptr->input_ptr->p_app_private = NULL;
+            }
             pcs_ptr->sb_total_count    = scs_ptr->sb_total_count;
             if (scs_ptr->speed_control_flag) {
-                speed_buffer_control(context_ptr, pcs_ptr, scs_ptr);
+                // The overlay is coded with the preset of its alt-ref and is not a source frame
+                if (loop_index == 0)
+                    speed_buffer_control(context_ptr, pcs_ptr, scs_ptr);
+                else
+                    pcs_ptr->enc_mode = pcs_ptr->alt_ref_ppcs_ptr->enc_mode;
             } else
                 pcs_ptr->enc_mode = (EbEncMode)scs_ptr->static_config.enc_mode;
             //  If the mode of the second pass is not set from CLI, it is set to enc_mode
@@ -330,6 +330,7 @@ EbErrorType copy_sequence_control_set(SequenceControlSet *dst, SequenceControlSe
     dst->over_boundary_block_mode       = src->over_boundary_block_mode;
     dst->mfmv_enabled                   = src->mfmv_enabled;
     dst->scd_delay                      = src->scd_delay;
+    dst->scd_look_ahead                 = src->scd_look_ahead;
     dst->in_loop_ois                    = src->in_loop_ois;
     dst->enable_pic_mgr_dec_order       = src->enable_pic_mgr_dec_order;
     dst->enable_dec_order               = src->enable_dec_order;
@@ -32,6 +32,8 @@ typedef struct MiniGopSizeCtrls {
     double hsa_th; // Threshold to determine high static area scene
     double hmv_di_th; // Threshold to determine high mv direction scene
     double lmv_di_th; // Threshold to determine low mv direction scene
+    double mg_hm_th; // Threshold on the motion of the pictures of a mini GOP to split it (GOP level switch)
+    double mg_mv_in_out_th; // Threshold on the in/out motion of the pictures of a mini GOP to split it
 } MiniGopSizeCtrls;
 typedef enum EncPass {
     ENC_SINGLE_PASS, //single pass mode
@@ -94,6 +96,8 @@ typedef struct SequenceControlSet {
     /*!< Number of delay frames needed to implement future window
          for algorithms such as SceneChange or TemporalFiltering */
     uint32_t scd_delay;
+    /*!< Number of future pictures used by the scene change detector (<= scd_delay) */
+    uint32_t scd_look_ahead;
     /*!<  */
     EbBlockMeanPrec block_mean_calc_prec;
     /*!< CDF (The signal changes per preset; 0: CDF update, 1: no CDF update) Default is 0.*/
@@ -431,8 +435,9 @@ typedef struct SequenceControlSet {
     int max_heirachical_level;
     /* Flag to enable the Speed Control functionality to achieve the real-time
     * encoding speed defined by dynamically changing the encoding preset to meet
-    * the average speed defined in injectorFrameRate. When this parameter is set
-    * to 1 it forces -inj to be 1 -inj-frm-rt to be set to the -fps.
+    * the average speed defined in static_config.target_fps. Presets only move
+    * between static_config.enc_mode and MAX_ENC_PRESET, so buffers sized for
+    * the configured preset remain large enough.
     *
     * Default is 0. */
     int speed_control_flag;
@@ -1963,9 +1963,11 @@ EbErrorType tpl_mc_flow(EncodeContext *encode_context_ptr, SequenceControlSet *s
     EB_DELETE(encode_context_ptr->mc_flow_rec_picture_buffer_noref);
 
     // When super-res recode is actived, don't release pa_ref_objs until final loop is finished
-    // Although tpl-la won't be enabled in super-res FIXED or RANDOM mode, here we use the condition to align with that in initial rate control process
-    EbBool release_pa_ref = (scs_ptr->static_config.superres_mode <= SUPERRES_RANDOM) ? EB_TRUE
-                                                                                      : EB_FALSE;
+    // Although tpl-la won't be enabled in super-res FIXED, RANDOM or DYNAMIC mode, here we use the condition to align with that in initial rate control process
+    EbBool release_pa_ref = (scs_ptr->static_config.superres_mode != SUPERRES_QTHRESH &&
+                             scs_ptr->static_config.superres_mode != SUPERRES_AUTO)
+        ? EB_TRUE
+        : EB_FALSE;
     for (uint32_t i = 0; i < pcs_ptr->tpl_group_size; i++) {
         if (release_pa_ref) {
             if (pcs_ptr->tpl_group[i]->slice_type == P_SLICE) {
@@ -2179,7 +2181,8 @@ void *source_based_operations_kernel(void *input_ptr) {
                 tpl_prep_info(pcs_ptr);
                 tpl_mc_flow(scs_ptr->encode_context_ptr, scs_ptr, pcs_ptr, context_ptr);
             }
-            EbBool release_pa_ref = (scs_ptr->static_config.superres_mode <= SUPERRES_RANDOM)
+            EbBool release_pa_ref = (scs_ptr->static_config.superres_mode != SUPERRES_QTHRESH &&
+                                     scs_ptr->static_config.superres_mode != SUPERRES_AUTO)
                 ? EB_TRUE
                 : EB_FALSE;
             // Release Pa Ref if lad_mg is 0 and P slice and not flat struct (not belonging to any TPL group)
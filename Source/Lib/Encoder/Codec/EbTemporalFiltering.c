@@ -221,6 +221,27 @@ void unpack_highbd_pic(uint16_t *buffer_highbd[3], EbPictureBufferDesc *pic_ptr,
             (height + ss_y) >> ss_y);
 }
 
+/*
+ * Point buffer_16bit at the 16-bit copy of the source kept with hbd_16bit_source, packing it
+ * from the 8-bit + 2-bit planes first when it is not up to date. All the planes are packed so
+ * that the copy can also be used by the later stages.
+ */
+void get_highbd_source_pic(PictureParentControlSet *pcs_ptr, uint16_t *buffer_16bit[3],
+                           uint32_t ss_x, uint32_t ss_y, EbBool do_chroma) {
+    EbPictureBufferDesc *pic_ptr      = pcs_ptr->enhanced_picture16bit_ptr;
+    uint16_t            *src_16bit[3] = {(uint16_t *)pic_ptr->buffer_y,
+                                         (uint16_t *)pic_ptr->buffer_cb,
+                                         (uint16_t *)pic_ptr->buffer_cr};
+
+    if (!pcs_ptr->enhanced_picture16bit_valid) {
+        pack_highbd_pic(pcs_ptr->enhanced_picture_ptr, src_16bit, ss_x, ss_y, EB_TRUE);
+        pcs_ptr->enhanced_picture16bit_valid = EB_TRUE;
+    }
+    buffer_16bit[C_Y] = src_16bit[C_Y];
+    buffer_16bit[C_U] = do_chroma ? src_16bit[C_U] : NULL;
+    buffer_16bit[C_V] = do_chroma ? src_16bit[C_V] : NULL;
+}
+
 void generate_padding_pic(EbPictureBufferDesc *pic_ptr, uint32_t ss_x, uint32_t ss_y,
                           EbBool is_highbd) {
     if (!is_highbd) {
@@ -5328,6 +5349,12 @@ EbErrorType svt_av1_init_temporal_filtering(
     uint32_t encoder_bit_depth =
         picture_control_set_ptr_central->scs_ptr->static_config.encoder_bit_depth;
     EbBool is_highbd = (encoder_bit_depth == 8) ? (uint8_t)EB_FALSE : (uint8_t)EB_TRUE;
+    // Low delay keeps pictures that may already be in the encode loop as references, so only
+    // the random access structure filters from the 16-bit copies of the source.
+    EbBool use_src_16bit = is_highbd &&
+        picture_control_set_ptr_central->scs_ptr->static_config.hbd_16bit_source &&
+        picture_control_set_ptr_central->scs_ptr->static_config.pred_structure ==
+            EB_PRED_RANDOM_ACCESS;
 
     // chroma subsampling
     uint32_t ss_x = picture_control_set_ptr_central->scs_ptr->subsampling_x;
@@ -5347,7 +5374,13 @@ EbErrorType svt_av1_init_temporal_filtering(
             EbPictureBufferDesc *pic_ptr_ref =
                 list_picture_control_set_ptr[i]->enhanced_picture_ptr;
             //10bit: for all the reference pictures do the packing once at the beggining.
-            if (is_highbd && i != picture_control_set_ptr_central->past_altref_nframes) {
+            if (use_src_16bit && i != picture_control_set_ptr_central->past_altref_nframes) {
+                get_highbd_source_pic(list_picture_control_set_ptr[i],
+                                      list_picture_control_set_ptr[i]->altref_buffer_highbd,
+                                      ss_x,
+                                      ss_y,
+                                      me_context_ptr->me_context_ptr->tf_chroma);
+            } else if (is_highbd && i != picture_control_set_ptr_central->past_altref_nframes) {
                 EB_MALLOC_ARRAY(list_picture_control_set_ptr[i]->altref_buffer_highbd[C_Y],
                                 central_picture_ptr->luma_size);
                 if (me_context_ptr->me_context_ptr->tf_chroma) {
@@ -5449,7 +5482,21 @@ EbErrorType svt_av1_init_temporal_filtering(
                                     ss_x,
                                     ss_y);
 #endif
-        if (is_highbd) {
+        if (use_src_16bit) {
+            unpack_highbd_pic(picture_control_set_ptr_central->altref_buffer_highbd,
+                              central_picture_ptr,
+                              ss_x,
+                              ss_y,
+                              EB_TRUE);
+            // The 8-bit padding is regenerated below, the 16-bit copy is packed again when needed
+            picture_control_set_ptr_central->enhanced_picture16bit_valid = EB_FALSE;
+            for (int i = 0; i < (picture_control_set_ptr_central->past_altref_nframes +
+                                 picture_control_set_ptr_central->future_altref_nframes + 1);
+                 i++)
+                memset(list_picture_control_set_ptr[i]->altref_buffer_highbd,
+                       0,
+                       sizeof(list_picture_control_set_ptr[i]->altref_buffer_highbd));
+        } else if (is_highbd) {
             unpack_highbd_pic(picture_control_set_ptr_central->altref_buffer_highbd,
                               central_picture_ptr,
                               ss_x,
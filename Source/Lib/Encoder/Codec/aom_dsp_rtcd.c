@@ -400,6 +400,8 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     SET_AVX2(svt_aom_ifft8x8_float, svt_aom_ifft8x8_float_c, svt_aom_ifft8x8_float_avx2);
     SET_ONLY_C(svt_aom_ifft2x2_float, svt_aom_ifft2x2_float_c);
     SET_SSE2(svt_aom_ifft4x4_float, svt_aom_ifft4x4_float_c, svt_aom_ifft4x4_float_sse2);
+    SET_AVX2(svt_aom_noise_tx_filter_block, svt_aom_noise_tx_filter_block_c, svt_aom_noise_tx_filter_block_avx2);
+    SET_AVX2(svt_aom_noise_model_add_observation, svt_aom_noise_model_add_observation_c, svt_aom_noise_model_add_observation_avx2);
     SET_AVX2(svt_av1_get_gradient_hist, svt_av1_get_gradient_hist_c, svt_av1_get_gradient_hist_avx2);
     SET_SSE2_AVX2(svt_av1_get_nz_map_contexts, svt_av1_get_nz_map_contexts_c, svt_av1_get_nz_map_contexts_sse2, svt_av1_get_nz_map_contexts_avx2);
     SET_AVX2_AVX512(svt_search_one_dual, svt_search_one_dual_c, svt_search_one_dual_avx2, svt_search_one_dual_avx512);
@@ -414,6 +416,7 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     SET_AVX2(apply_filtering_central, apply_filtering_central_c, apply_filtering_central_avx2);
     SET_AVX2(apply_filtering_central_highbd, apply_filtering_central_highbd_c, apply_filtering_central_highbd_avx2);
     SET_AVX2(downsample_2d, downsample_2d_c, downsample_2d_avx2);
+    SET_AVX2(downsample_2d_pyramid, downsample_2d_pyramid_c, downsample_2d_pyramid_avx2);
     SET_SSE41_AVX2(svt_ext_sad_calculation_8x8_16x16, svt_ext_sad_calculation_8x8_16x16_c, svt_ext_sad_calculation_8x8_16x16_sse4_1_intrin, svt_ext_sad_calculation_8x8_16x16_avx2_intrin);
     SET_SSE41(svt_ext_sad_calculation_32x32_64x64, svt_ext_sad_calculation_32x32_64x64_c, svt_ext_sad_calculation_32x32_64x64_sse4_intrin);
     SET_SSE41_AVX2(svt_ext_all_sad_calculation_8x8_16x16, svt_ext_all_sad_calculation_8x8_16x16_c, svt_ext_all_sad_calculation_8x8_16x16_sse4_1, svt_ext_all_sad_calculation_8x8_16x16_avx2);
@@ -435,5 +438,7 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     SET_AVX2(svt_av1_haar_ac_sad_8x8_uint8_input, svt_av1_haar_ac_sad_8x8_uint8_input_c, svt_av1_haar_ac_sad_8x8_uint8_input_avx2);
     SET_SSE41_AVX2(svt_pme_sad_loop_kernel, svt_pme_sad_loop_kernel_c, svt_pme_sad_loop_kernel_sse4_1, svt_pme_sad_loop_kernel_avx2);
     SET_SSE41_AVX2(svt_unpack_and_2bcompress, svt_unpack_and_2bcompress_c, svt_unpack_and_2bcompress_sse4_1, svt_unpack_and_2bcompress_avx2);
+    SET_AVX2(svt_unpack_p010_and_2bcompress, svt_unpack_p010_and_2bcompress_c, svt_unpack_p010_and_2bcompress_avx2);
+    SET_AVX2(svt_unpack_p010_uv_and_2bcompress, svt_unpack_p010_uv_and_2bcompress_c, svt_unpack_p010_uv_and_2bcompress_avx2);
 }
 // clang-format on
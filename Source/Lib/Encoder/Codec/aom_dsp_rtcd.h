@@ -766,6 +766,10 @@ extern "C" {
     RTCD_EXTERN void(*svt_aom_fft4x4_float)(const float *input, float *temp, float *output);
     void svt_aom_fft8x8_float_c(const float *input, float *temp, float *output);
     RTCD_EXTERN void(*svt_aom_fft8x8_float)(const float *input, float *temp, float *output);
+    void svt_aom_noise_tx_filter_block_c(int32_t block_size, float *tx_block, const float psd);
+    RTCD_EXTERN void(*svt_aom_noise_tx_filter_block)(int32_t block_size, float *tx_block, const float psd);
+    void svt_aom_noise_model_add_observation_c(const double *buffer, double val, double recp_sqr_norm, double *buffer_norm, double *A, double *b, int32_t n);
+    RTCD_EXTERN void(*svt_aom_noise_model_add_observation)(const double *buffer, double val, double recp_sqr_norm, double *buffer_norm, double *A, double *b, int32_t n);
     void svt_av1_get_nz_map_contexts_c(const uint8_t *const levels, const int16_t *const scan, const uint16_t eob, const TxSize tx_size, const TxClass tx_class, int8_t *const coeff_contexts);
     RTCD_EXTERN void(*svt_av1_get_nz_map_contexts)(const uint8_t *const levels, const int16_t *const scan, const uint16_t eob, const TxSize tx_size, const TxClass tx_class, int8_t *const coeff_contexts);
     RTCD_EXTERN void(*svt_sad_loop_kernel)(uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride, uint32_t block_height, uint32_t block_width, uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center, uint32_t src_stride_raw, uint8_t skip_search_line, int16_t search_area_width, int16_t search_area_height);
@@ -839,6 +843,8 @@ extern "C" {
     RTCD_EXTERN void (*apply_filtering_central_highbd)(struct MeContext *context_ptr, EbPictureBufferDesc *input_picture_ptr_central, uint16_t **src_16bit, uint32_t **accum, uint16_t **count, uint16_t blk_width, uint16_t blk_height, uint32_t ss_x, uint32_t ss_y);
     void downsample_2d_avx2(uint8_t *input_samples, uint32_t input_stride, uint32_t input_area_width, uint32_t input_area_height, uint8_t *decim_samples, uint32_t decim_stride, uint32_t decim_step);
     RTCD_EXTERN void (*downsample_2d)(uint8_t *input_samples, uint32_t input_stride, uint32_t input_area_width, uint32_t input_area_height, uint8_t *decim_samples, uint32_t decim_stride, uint32_t decim_step);
+    void downsample_2d_pyramid_avx2(uint8_t *input_samples, uint32_t input_stride, uint32_t input_area_width, uint32_t input_area_height, uint8_t *quarter_samples, uint32_t quarter_stride, uint8_t *sixteenth_samples, uint32_t sixteenth_stride);
+    RTCD_EXTERN void (*downsample_2d_pyramid)(uint8_t *input_samples, uint32_t input_stride, uint32_t input_area_width, uint32_t input_area_height, uint8_t *quarter_samples, uint32_t quarter_stride, uint8_t *sixteenth_samples, uint32_t sixteenth_stride);
     RTCD_EXTERN void(*svt_ext_sad_calculation_8x8_16x16)(uint8_t *src, uint32_t src_stride, uint8_t *ref, uint32_t ref_stride, uint32_t *p_best_sad_8x8, uint32_t *p_best_sad_16x16, uint32_t *p_best_mv8x8, uint32_t *p_best_mv16x16, uint32_t mv, uint32_t *p_sad16x16, uint32_t *p_sad8x8, EbBool sub_sad);
     void svt_ext_sad_calculation_8x8_16x16_c(uint8_t *src, uint32_t src_stride, uint8_t *ref,
         uint32_t ref_stride, uint32_t *p_best_sad_8x8,
@@ -874,6 +880,10 @@ extern "C" {
     void svt_unpack_and_2bcompress_sse4_1(uint16_t *in16b_buffer, uint32_t in16b_stride, uint8_t *out8b_buffer, uint32_t out8b_stride, uint8_t *out2b_buffer, uint32_t out2b_stride, uint32_t width, uint32_t height);
     void svt_unpack_and_2bcompress_avx2(uint16_t *in16b_buffer, uint32_t in16b_stride, uint8_t *out8b_buffer, uint32_t out8b_stride, uint8_t *out2b_buffer, uint32_t out2b_stride, uint32_t width, uint32_t height);
     RTCD_EXTERN void (*svt_unpack_and_2bcompress)(uint16_t *in16b_buffer, uint32_t in16b_stride, uint8_t *out8b_buffer, uint32_t out8b_stride,uint8_t *out2b_buffer, uint32_t out2b_stride, uint32_t width, uint32_t height);
+    void svt_unpack_p010_and_2bcompress_avx2(uint16_t *in16b_buffer, uint32_t in16b_stride, uint8_t *out8b_buffer, uint32_t out8b_stride, uint8_t *out2b_buffer, uint32_t out2b_stride, uint32_t width, uint32_t height);
+    RTCD_EXTERN void (*svt_unpack_p010_and_2bcompress)(uint16_t *in16b_buffer, uint32_t in16b_stride, uint8_t *out8b_buffer, uint32_t out8b_stride, uint8_t *out2b_buffer, uint32_t out2b_stride, uint32_t width, uint32_t height);
+    void svt_unpack_p010_uv_and_2bcompress_avx2(uint16_t *in16b_buffer, uint32_t in16b_stride, uint8_t *out8b_cb, uint8_t *out8b_cr, uint32_t out8b_stride, uint8_t *out2b_cb, uint8_t *out2b_cr, uint32_t out2b_stride, uint32_t width, uint32_t height);
+    RTCD_EXTERN void (*svt_unpack_p010_uv_and_2bcompress)(uint16_t *in16b_buffer, uint32_t in16b_stride, uint8_t *out8b_cb, uint8_t *out8b_cr, uint32_t out8b_stride, uint8_t *out2b_cb, uint8_t *out2b_cr, uint32_t out2b_stride, uint32_t width, uint32_t height);
 #ifdef ARCH_X86_64
     uint32_t combined_averaging_ssd_avx2(uint8_t *src, ptrdiff_t src_stride, uint8_t *ref1, ptrdiff_t ref1_stride, uint8_t *ref2, ptrdiff_t ref2_stride, uint32_t height, uint32_t width);
     uint32_t combined_averaging_ssd_avx512(uint8_t *src, ptrdiff_t src_stride, uint8_t *ref1, ptrdiff_t ref1_stride, uint8_t *ref2, ptrdiff_t ref2_stride, uint32_t height, uint32_t width);
@@ -1508,6 +1518,9 @@ extern "C" {
 
     void svt_aom_fft8x8_float_avx2(const float *input, float *temp, float *output);
 
+    void svt_aom_noise_tx_filter_block_avx2(int32_t block_size, float *tx_block, const float psd);
+    void svt_aom_noise_model_add_observation_avx2(const double *buffer, double val, double recp_sqr_norm, double *buffer_norm, double *A, double *b, int32_t n);
+
     void svt_av1_get_nz_map_contexts_sse2(const uint8_t *const levels, const int16_t *const scan, const uint16_t eob, const TxSize tx_size, const TxClass tx_class, int8_t *const coeff_contexts);
     void svt_av1_get_nz_map_contexts_avx2(const uint8_t *const levels, const int16_t *const scan, const uint16_t eob, const TxSize tx_size, const TxClass tx_class, int8_t *const coeff_contexts);
 
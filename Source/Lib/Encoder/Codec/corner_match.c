@@ -159,16 +159,36 @@ int svt_av1_determine_correspondence(unsigned char *frm, int *frm_corners, int n
     int             num_correspondences = 0;
     const int       thresh              = (width < height ? height : width) >> 4;
     const int       threshSqr           = thresh * thresh;
+    // Bucket the eligible reference corners by row, so that each frame corner
+    // only visits the rows within thresh of it rather than every ref corner.
+    // row_start[y] .. row_start[y + 1] index the ref corners of row y.
+    int *row_start = (int *)calloc(height + 2, sizeof(*row_start));
+    int *ref_index = (int *)malloc(sizeof(*ref_index) * (num_ref_corners + 1));
+    if (row_start == NULL || ref_index == NULL) {
+        free(row_start);
+        free(ref_index);
+        return 0;
+    }
+    for (j = 0; j < num_ref_corners; ++j)
+        if (is_eligible_point(ref_corners[2 * j], ref_corners[2 * j + 1], width, height))
+            row_start[ref_corners[2 * j + 1] + 2]++;
+    for (i = 2; i < height + 2; ++i) row_start[i] += row_start[i - 1];
+    // Counting sort; filling row y advances row_start[y + 1] from its start to its end
+    for (j = 0; j < num_ref_corners; ++j)
+        if (is_eligible_point(ref_corners[2 * j], ref_corners[2 * j + 1], width, height))
+            ref_index[row_start[ref_corners[2 * j + 1] + 1]++] = j;
     for (i = 0; i < num_frm_corners; ++i) {
         double  best_match_ncc = 0.0;
         int32_t template_norm;
         int     best_match_j = -1;
         if (!is_eligible_point(frm_corners[2 * i], frm_corners[2 * i + 1], width, height))
             continue;
-        for (j = 0; j < num_ref_corners; ++j) {
+        const int frm_y     = frm_corners[2 * i + 1];
+        const int row_first = frm_y - thresh < 0 ? 0 : frm_y - thresh;
+        const int row_last  = frm_y + thresh >= height ? height - 1 : frm_y + thresh;
+        for (int k = row_start[row_first]; k < row_start[row_last + 1]; ++k) {
             double match_ncc;
-            if (!is_eligible_point(ref_corners[2 * j], ref_corners[2 * j + 1], width, height))
-                continue;
+            j = ref_index[k];
             if (!is_eligible_distance(frm_corners[2 * i],
                                       frm_corners[2 * i + 1],
                                       ref_corners[2 * j],
@@ -183,7 +203,10 @@ int svt_av1_determine_correspondence(unsigned char *frm, int *frm_corners, int n
                                                           ref_stride,
                                                           ref_corners[2 * j],
                                                           ref_corners[2 * j + 1]);
-            if (match_ncc > best_match_ncc) {
+            // Ties go to the lowest ref corner index, as in a scan of the
+            // ref corners in their original order
+            if (match_ncc > best_match_ncc ||
+                (match_ncc == best_match_ncc && best_match_j > j)) {
                 best_match_ncc = match_ncc;
                 best_match_j   = j;
             }
@@ -208,6 +231,8 @@ int svt_av1_determine_correspondence(unsigned char *frm, int *frm_corners, int n
             num_correspondences++;
         }
     }
+    free(row_start);
+    free(ref_index);
     improve_correspondence(
         frm, ref, width, height, frm_stride, ref_stride, correspondences, num_correspondences);
     return num_correspondences;
@@ -171,6 +171,32 @@ void svt_av1_accumulate_stats(FIRSTPASS_STATS *section, const FIRSTPASS_STATS *f
     section->count += frame->count;
     section->duration += frame->duration;
 }
+/*
+ * Rescale stats collected at src_width x src_height to dst_width x dst_height. The
+ * prediction errors are block sums and scale with the area, the motion magnitudes and
+ * the inactive zone (in MB units) scale with the matching dimension, the percentages
+ * are resolution independent. The sums stay consistent with the per frame entries, so
+ * the trailing total entry can be rescaled the same way.
+ */
+void svt_av1_scale_stats(FIRSTPASS_STATS *stats, size_t count, uint32_t src_width,
+                         uint32_t src_height, uint32_t dst_width, uint32_t dst_height) {
+    const double w_ratio    = (double)dst_width / src_width;
+    const double h_ratio    = (double)dst_height / src_height;
+    const double area_ratio = w_ratio * h_ratio;
+
+    for (size_t i = 0; i < count; i++) {
+        FIRSTPASS_STATS *fps = &stats[i];
+        fps->intra_error *= area_ratio;
+        fps->coded_error *= area_ratio;
+        fps->sr_coded_error *= area_ratio;
+        fps->inactive_zone_rows *= h_ratio;
+        fps->inactive_zone_cols *= w_ratio;
+        fps->mvr_abs *= h_ratio;
+        fps->mvc_abs *= w_ratio;
+        fps->stat_struct.total_num_bits = (uint64_t)(fps->stat_struct.total_num_bits *
+                                                     area_ratio);
+    }
+}
 void svt_av1_end_first_pass(PictureParentControlSet *pcs_ptr) {
     SequenceControlSet *scs_ptr = pcs_ptr->scs_ptr;
     TWO_PASS *          twopass = &scs_ptr->twopass;
@@ -1327,12 +1353,10 @@ void open_loop_first_pass(PictureParentControlSet *  ppcs_ptr,
     svt_block_on_mutex(ppcs_ptr->first_pass_mutex);
     ppcs_ptr->first_pass_seg_acc++;
     if (ppcs_ptr->first_pass_seg_acc == ppcs_ptr->first_pass_seg_total_count) {
-        first_pass_frame_end(ppcs_ptr,
-                             me_context_ptr->me_context_ptr->skip_frame,
-                             me_context_ptr->me_context_ptr->bypass_blk_step,
-                             ppcs_ptr->ts_duration);
-        if (ppcs_ptr->end_of_sequence_flag && !ppcs_ptr->scs_ptr->lap_enabled)
-            svt_av1_end_first_pass(ppcs_ptr);
+        // Several frames are analysed concurrently; the frame level stats are
+        // written in display order by picture decision (first_pass_frame_end)
+        ppcs_ptr->first_pass_skip_frame      = me_context_ptr->me_context_ptr->skip_frame;
+        ppcs_ptr->first_pass_bypass_blk_step = me_context_ptr->me_context_ptr->bypass_blk_step;
         // Signal that the first pass is done
         svt_post_semaphore(ppcs_ptr->first_pass_done_semaphore);
     }
@@ -263,6 +263,8 @@ struct TileDataEnc;
 
 void svt_av1_twopass_zero_stats(FIRSTPASS_STATS *section);
 void svt_av1_accumulate_stats(FIRSTPASS_STATS *section, const FIRSTPASS_STATS *frame);
+void svt_av1_scale_stats(FIRSTPASS_STATS *stats, size_t count, uint32_t src_width,
+                         uint32_t src_height, uint32_t dst_width, uint32_t dst_height);
 /*!\endcond */
 
 #ifdef __cplusplus
@@ -136,7 +136,7 @@ int64_t svt_av1_refine_integerized_param(EbWarpedMotionParams *wm, Transformatio
                                          int use_hbd, int bd, uint8_t *ref, uint8_t *ref_2b,
                                          int r_width, int r_height, int r_stride, uint8_t *dst,
                                          int d_width, int d_height, int d_stride, int n_refinements,
-                                         int64_t best_frame_error) {
+                                         int sample_blocks, int64_t best_frame_error) {
     static const int max_trans_model_params[TRANS_TYPES] = {0, 2, 4, 6};
     const int        border                              = ERRORADV_BORDER;
     int              i                                   = 0, p;
@@ -165,7 +165,8 @@ int64_t svt_av1_refine_integerized_param(EbWarpedMotionParams *wm, Transformatio
                                     d_stride,
                                     0,
                                     0,
-                                    best_frame_error);
+                                    best_frame_error,
+                                    sample_blocks);
     best_error = AOMMIN(best_error, best_frame_error);
     step       = 1 << (n_refinements - 1);
     for (i = 0; i < n_refinements; i++, step >>= 1) {
@@ -193,7 +194,8 @@ int64_t svt_av1_refine_integerized_param(EbWarpedMotionParams *wm, Transformatio
                                             d_stride,
                                             0,
                                             0,
-                                            best_error);
+                                            best_error,
+                                            sample_blocks);
             if (step_error < best_error) {
                 best_error = step_error;
                 best_param = *param;
@@ -218,7 +220,8 @@ int64_t svt_av1_refine_integerized_param(EbWarpedMotionParams *wm, Transformatio
                                             d_stride,
                                             0,
                                             0,
-                                            best_error);
+                                            best_error,
+                                            sample_blocks);
             if (step_error < best_error) {
                 best_error = step_error;
                 best_param = *param;
@@ -246,7 +249,8 @@ int64_t svt_av1_refine_integerized_param(EbWarpedMotionParams *wm, Transformatio
                                                 d_stride,
                                                 0,
                                                 0,
-                                                best_error);
+                                                best_error,
+                                                sample_blocks);
                 if (step_error < best_error) {
                     best_error = step_error;
                     best_param = *param;
@@ -137,7 +137,9 @@ Iterator svt_av1_hash_get_first_iterator(HashTable *p_hash_table, uint32_t hash_
 
 void svt_av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture,
                                            uint32_t               *pic_block_hash[2],
-                                           int8_t *pic_block_same_info[3], PictureControlSet *pcs) {
+                                           int8_t                 *pic_block_same_info[3],
+                                           CRC_CALCULATOR         *crc_calculator1,
+                                           CRC_CALCULATOR         *crc_calculator2) {
     const int width  = 2;
     const int height = 2;
     const int x_end  = picture->y_crop_width - width + 1;
@@ -157,9 +159,9 @@ void svt_av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture,
                 pic_block_same_info[1][pos] = is_block16_2x2_col_same_value(p);
 
                 pic_block_hash[0][pos] = svt_av1_get_crc_value(
-                    &pcs->crc_calculator1, (uint8_t *)p, length * sizeof(p[0]));
+                    crc_calculator1, (uint8_t *)p, length * sizeof(p[0]));
                 pic_block_hash[1][pos] = svt_av1_get_crc_value(
-                    &pcs->crc_calculator2, (uint8_t *)p, length * sizeof(p[0]));
+                    crc_calculator2, (uint8_t *)p, length * sizeof(p[0]));
                 pos++;
             }
             pos += width - 1;
@@ -175,9 +177,9 @@ void svt_av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture,
                 pic_block_same_info[1][pos] = is_block_2x2_col_same_value(p);
 
                 pic_block_hash[0][pos] = svt_av1_get_crc_value(
-                    &pcs->crc_calculator1, p, length * sizeof(p[0]));
+                    crc_calculator1, p, length * sizeof(p[0]));
                 pic_block_hash[1][pos] = svt_av1_get_crc_value(
-                    &pcs->crc_calculator2, p, length * sizeof(p[0]));
+                    crc_calculator2, p, length * sizeof(p[0]));
                 pos++;
             }
             pos += width - 1;
@@ -188,8 +190,10 @@ void svt_av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture,
 void svt_av1_generate_block_hash_value(const Yv12BufferConfig *picture, int block_size,
                                        uint32_t *src_pic_block_hash[2],
                                        uint32_t *dst_pic_block_hash[2],
-                                       int8_t   *src_pic_block_same_info[3],
-                                       int8_t *dst_pic_block_same_info[3], PictureControlSet *pcs) {
+                                       int8_t         *src_pic_block_same_info[3],
+                                       int8_t         *dst_pic_block_same_info[3],
+                                       CRC_CALCULATOR *crc_calculator1,
+                                       CRC_CALCULATOR *crc_calculator2) {
     const int pic_width = picture->y_crop_width;
     const int x_end     = picture->y_crop_width - block_size + 1;
     const int y_end     = picture->y_crop_height - block_size + 1;
@@ -208,14 +212,14 @@ void svt_av1_generate_block_hash_value(const Yv12BufferConfig *picture, int bloc
             p[2] = src_pic_block_hash[0][pos + src_size * pic_width];
             p[3] = src_pic_block_hash[0][pos + src_size * pic_width + src_size];
             dst_pic_block_hash[0][pos] = svt_av1_get_crc_value(
-                &pcs->crc_calculator1, (uint8_t *)p, length);
+                crc_calculator1, (uint8_t *)p, length);
 
             p[0] = src_pic_block_hash[1][pos];
             p[1] = src_pic_block_hash[1][pos + src_size];
             p[2] = src_pic_block_hash[1][pos + src_size * pic_width];
             p[3] = src_pic_block_hash[1][pos + src_size * pic_width + src_size];
             dst_pic_block_hash[1][pos] = svt_av1_get_crc_value(
-                &pcs->crc_calculator2, (uint8_t *)p, length);
+                crc_calculator2, (uint8_t *)p, length);
 
             dst_pic_block_same_info[0][pos] = src_pic_block_same_info[0][pos] &&
                 src_pic_block_same_info[0][pos + quad_size] &&
@@ -283,10 +287,58 @@ void rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(HashTable *p_ha
     }
 }
 
-void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, uint32_t *hash_value1,
-                                  uint32_t *hash_value2, int use_highbitdepth,
-                                  struct PictureControlSet *pcs, IntraBcContext *x) {
-    UNUSED(pcs);
+EbErrorType rtime_alloc_svt_av1_generate_pic_block_hash(const Yv12BufferConfig *picture,
+                                                        int block_size, uint32_t *pic_hash[2],
+                                                        int8_t         *pic_is_added,
+                                                        CRC_CALCULATOR *crc_calculator1,
+                                                        CRC_CALCULATOR *crc_calculator2) {
+    const size_t size = (size_t)picture->y_crop_width * picture->y_crop_height;
+    uint32_t    *block_hash_values[2][2];
+    int8_t      *is_block_same[2][3];
+    EbErrorType  return_error = EB_ErrorNone;
+
+    for (int k = 0; k < 2; k++) {
+        for (int j = 0; j < 2; j++) {
+            block_hash_values[k][j] = malloc(sizeof(uint32_t) * size);
+            if (block_hash_values[k][j] == NULL)
+                return_error = EB_ErrorInsufficientResources;
+        }
+        for (int j = 0; j < 3; j++) {
+            is_block_same[k][j] = malloc(sizeof(int8_t) * size);
+            if (is_block_same[k][j] == NULL)
+                return_error = EB_ErrorInsufficientResources;
+        }
+    }
+    if (return_error == EB_ErrorNone) {
+        svt_av1_generate_block_2x2_hash_value(
+            picture, block_hash_values[0], is_block_same[0], crc_calculator1, crc_calculator2);
+        uint8_t src_idx = 0;
+        for (int size_i = 4; size_i <= block_size; size_i <<= 1, src_idx = !src_idx)
+            svt_av1_generate_block_hash_value(picture,
+                                              size_i,
+                                              block_hash_values[src_idx],
+                                              block_hash_values[!src_idx],
+                                              is_block_same[src_idx],
+                                              is_block_same[!src_idx],
+                                              crc_calculator1,
+                                              crc_calculator2);
+        // the loop above leaves the block_size results at src_idx
+        memcpy(pic_hash[0], block_hash_values[src_idx][0], sizeof(uint32_t) * size);
+        memcpy(pic_hash[1], block_hash_values[src_idx][1], sizeof(uint32_t) * size);
+        memcpy(pic_is_added, is_block_same[src_idx][2], sizeof(int8_t) * size);
+    }
+    for (int k = 0; k < 2; k++) {
+        for (int j = 0; j < 2; j++) free(block_hash_values[k][j]);
+        for (int j = 0; j < 3; j++) free(is_block_same[k][j]);
+    }
+    return return_error;
+}
+
+void svt_av1_compute_block_hash_value(uint8_t *y_src, int stride, int block_size,
+                                      uint32_t *hash_value1, uint32_t *hash_value2,
+                                      int use_highbitdepth, CRC_CALCULATOR *crc_calculator1,
+                                      CRC_CALCULATOR *crc_calculator2,
+                                      uint32_t       *hash_value_buffer[2][2]) {
     uint32_t  to_hash[4];
     const int add_value = hash_block_size_to_index(block_size) << crc_bits;
     assert(add_value >= 0);
@@ -303,10 +355,10 @@ void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, ui
                 get_pixels_in_1d_short_array_by_block_2x2(
                     y16_src + y_pos * stride + x_pos, stride, pixel_to_hash);
                 assert(pos < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
-                x->hash_value_buffer[0][0][pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator1, (uint8_t *)pixel_to_hash, sizeof(pixel_to_hash));
-                x->hash_value_buffer[1][0][pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator2, (uint8_t *)pixel_to_hash, sizeof(pixel_to_hash));
+                hash_value_buffer[0][0][pos] = svt_av1_get_crc_value(
+                    crc_calculator1, (uint8_t *)pixel_to_hash, sizeof(pixel_to_hash));
+                hash_value_buffer[1][0][pos] = svt_av1_get_crc_value(
+                    crc_calculator2, (uint8_t *)pixel_to_hash, sizeof(pixel_to_hash));
             }
         }
     } else {
@@ -317,10 +369,10 @@ void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, ui
                 get_pixels_in_1d_char_array_by_block_2x2(
                     y_src + y_pos * stride + x_pos, stride, pixel_to_hash);
                 assert(pos < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
-                x->hash_value_buffer[0][0][pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator1, pixel_to_hash, sizeof(pixel_to_hash));
-                x->hash_value_buffer[1][0][pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator2, pixel_to_hash, sizeof(pixel_to_hash));
+                hash_value_buffer[0][0][pos] = svt_av1_get_crc_value(
+                    crc_calculator1, pixel_to_hash, sizeof(pixel_to_hash));
+                hash_value_buffer[1][0][pos] = svt_av1_get_crc_value(
+                    crc_calculator2, pixel_to_hash, sizeof(pixel_to_hash));
             }
         }
     }
@@ -344,19 +396,19 @@ void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, ui
                 assert(src_pos + 1 < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
                 assert(src_pos + src_sub_block_in_width + 1 < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
                 assert(dst_pos < AOM_BUFFER_SIZE_FOR_BLOCK_HASH);
-                to_hash[0] = x->hash_value_buffer[0][src_idx][src_pos];
-                to_hash[1] = x->hash_value_buffer[0][src_idx][src_pos + 1];
-                to_hash[2] = x->hash_value_buffer[0][src_idx][src_pos + src_sub_block_in_width];
-                to_hash[3] = x->hash_value_buffer[0][src_idx][src_pos + src_sub_block_in_width + 1];
-                x->hash_value_buffer[0][dst_idx][dst_pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator1, (uint8_t *)to_hash, sizeof(to_hash));
-
-                to_hash[0] = x->hash_value_buffer[1][src_idx][src_pos];
-                to_hash[1] = x->hash_value_buffer[1][src_idx][src_pos + 1];
-                to_hash[2] = x->hash_value_buffer[1][src_idx][src_pos + src_sub_block_in_width];
-                to_hash[3] = x->hash_value_buffer[1][src_idx][src_pos + src_sub_block_in_width + 1];
-                x->hash_value_buffer[1][dst_idx][dst_pos] = svt_av1_get_crc_value(
-                    &x->crc_calculator2, (uint8_t *)to_hash, sizeof(to_hash));
+                to_hash[0] = hash_value_buffer[0][src_idx][src_pos];
+                to_hash[1] = hash_value_buffer[0][src_idx][src_pos + 1];
+                to_hash[2] = hash_value_buffer[0][src_idx][src_pos + src_sub_block_in_width];
+                to_hash[3] = hash_value_buffer[0][src_idx][src_pos + src_sub_block_in_width + 1];
+                hash_value_buffer[0][dst_idx][dst_pos] = svt_av1_get_crc_value(
+                    crc_calculator1, (uint8_t *)to_hash, sizeof(to_hash));
+
+                to_hash[0] = hash_value_buffer[1][src_idx][src_pos];
+                to_hash[1] = hash_value_buffer[1][src_idx][src_pos + 1];
+                to_hash[2] = hash_value_buffer[1][src_idx][src_pos + src_sub_block_in_width];
+                to_hash[3] = hash_value_buffer[1][src_idx][src_pos + src_sub_block_in_width + 1];
+                hash_value_buffer[1][dst_idx][dst_pos] = svt_av1_get_crc_value(
+                    crc_calculator2, (uint8_t *)to_hash, sizeof(to_hash));
                 dst_pos++;
             }
         }
@@ -365,6 +417,21 @@ void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, ui
         sub_block_in_width >>= 1;
     }
 
-    *hash_value1 = (x->hash_value_buffer[0][dst_idx][0] & crc_mask) + add_value;
-    *hash_value2 = x->hash_value_buffer[1][dst_idx][0];
+    *hash_value1 = (hash_value_buffer[0][dst_idx][0] & crc_mask) + add_value;
+    *hash_value2 = hash_value_buffer[1][dst_idx][0];
+}
+
+void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, uint32_t *hash_value1,
+                                  uint32_t *hash_value2, int use_highbitdepth,
+                                  struct PictureControlSet *pcs, IntraBcContext *x) {
+    UNUSED(pcs);
+    svt_av1_compute_block_hash_value(y_src,
+                                     stride,
+                                     block_size,
+                                     hash_value1,
+                                     hash_value2,
+                                     use_highbitdepth,
+                                     &x->crc_calculator1,
+                                     &x->crc_calculator2,
+                                     x->hash_value_buffer);
 }
@@ -37,27 +37,43 @@ void        svt_av1_hash_table_destroy(HashTable *p_hash_table);
 EbErrorType rtime_alloc_svt_av1_hash_table_create(HashTable *p_hash_table);
 int32_t     svt_av1_hash_table_count(const HashTable *p_hash_table, uint32_t hash_value);
 Iterator    svt_av1_hash_get_first_iterator(HashTable *p_hash_table, uint32_t hash_value);
-void        svt_av1_generate_block_2x2_hash_value(const Yv12BufferConfig   *picture,
-                                                  uint32_t                 *pic_block_hash[2],
-                                                  int8_t                   *pic_block_same_info[3],
-                                                  struct PictureControlSet *pcs);
+void        svt_av1_generate_block_2x2_hash_value(const Yv12BufferConfig *picture,
+                                                  uint32_t               *pic_block_hash[2],
+                                                  int8_t                 *pic_block_same_info[3],
+                                                  CRC_CALCULATOR         *crc_calculator1,
+                                                  CRC_CALCULATOR         *crc_calculator2);
 
 void svt_av1_generate_block_hash_value(const Yv12BufferConfig *picture, int block_size,
-                                       uint32_t                 *src_pic_block_hash[2],
-                                       uint32_t                 *dst_pic_block_hash[2],
-                                       int8_t                   *src_pic_block_same_info[3],
-                                       int8_t                   *dst_pic_block_same_info[3],
-                                       struct PictureControlSet *pcs);
+                                       uint32_t       *src_pic_block_hash[2],
+                                       uint32_t       *dst_pic_block_hash[2],
+                                       int8_t         *src_pic_block_same_info[3],
+                                       int8_t         *dst_pic_block_same_info[3],
+                                       CRC_CALCULATOR *crc_calculator1,
+                                       CRC_CALCULATOR *crc_calculator2);
 void rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data(HashTable *p_hash_table,
                                                                  uint32_t  *pic_hash[2],
                                                                  int8_t *pic_is_same, int pic_width,
                                                                  int pic_height, int block_size);
+// Hash the block_size x block_size blocks at every position of the picture.
+// pic_hash and pic_is_added hold y_crop_width x y_crop_height entries, pic_is_added
+// flags the positions to pass to rtime_alloc_svt_av1_add_to_hash_map_by_row_with_precal_data()
+EbErrorType rtime_alloc_svt_av1_generate_pic_block_hash(const Yv12BufferConfig *picture,
+                                                        int block_size, uint32_t *pic_hash[2],
+                                                        int8_t         *pic_is_added,
+                                                        CRC_CALCULATOR *crc_calculator1,
+                                                        CRC_CALCULATOR *crc_calculator2);
 
 // check whether the block starts from (x_start, y_start) with the size of
 // BlockSize x BlockSize has the same color in all rows
 
 // check whether the block starts from (x_start, y_start) with the size of
 // BlockSize x BlockSize has the same color in all columns
+// hash_value_buffer provides [2][2] scratch arrays of AOM_BUFFER_SIZE_FOR_BLOCK_HASH entries
+void svt_av1_compute_block_hash_value(uint8_t *y_src, int stride, int block_size,
+                                      uint32_t *hash_value1, uint32_t *hash_value2,
+                                      int use_highbitdepth, CRC_CALCULATOR *crc_calculator1,
+                                      CRC_CALCULATOR *crc_calculator2,
+                                      uint32_t       *hash_value_buffer[2][2]);
 void svt_av1_get_block_hash_value(uint8_t *y_src, int stride, int block_size, uint32_t *hash_value1,
                                   uint32_t *hash_value2, int use_highbitdepth,
                                   struct PictureControlSet             *pcs,
@@ -826,6 +826,53 @@ void svt_aom_noise_model_free(AomNoiseModel *model) {
 EXTRACT_AR_ROW(uint8_t, lowbd);
 EXTRACT_AR_ROW(uint16_t, highbd);
 
+// Accumulates one observation of the auto-regressive noise model into the
+// normal equations: b += buffer * val / norm^2 and A += buffer' * buffer / norm^2.
+void svt_aom_noise_model_add_observation_c(const double *buffer, double val,
+                                           double recp_sqr_norm, double *buffer_norm, double *A,
+                                           double *b, int32_t n) {
+    int32_t i = 0;
+    for (i = 0; i + 8 - 1 < n; i += 8) {
+        buffer_norm[i + 0] = buffer[i + 0] * recp_sqr_norm;
+        buffer_norm[i + 1] = buffer[i + 1] * recp_sqr_norm;
+        buffer_norm[i + 2] = buffer[i + 2] * recp_sqr_norm;
+        buffer_norm[i + 3] = buffer[i + 3] * recp_sqr_norm;
+        buffer_norm[i + 4] = buffer[i + 4] * recp_sqr_norm;
+        buffer_norm[i + 5] = buffer[i + 5] * recp_sqr_norm;
+        buffer_norm[i + 6] = buffer[i + 6] * recp_sqr_norm;
+        buffer_norm[i + 7] = buffer[i + 7] * recp_sqr_norm;
+        b[i + 0] += buffer_norm[i + 0] * val;
+        b[i + 1] += buffer_norm[i + 1] * val;
+        b[i + 2] += buffer_norm[i + 2] * val;
+        b[i + 3] += buffer_norm[i + 3] * val;
+        b[i + 4] += buffer_norm[i + 4] * val;
+        b[i + 5] += buffer_norm[i + 5] * val;
+        b[i + 6] += buffer_norm[i + 6] * val;
+        b[i + 7] += buffer_norm[i + 7] * val;
+    }
+    for (; i < n; ++i) {
+        buffer_norm[i] = buffer[i] * recp_sqr_norm;
+        b[i] += buffer_norm[i] * val;
+    }
+
+    for (i = 0; i < n; ++i) {
+        int32_t      j             = 0;
+        const double buffer_norm_i = buffer_norm[i];
+
+        for (j = 0; j + 8 - 1 < n; j += 8) {
+            A[i * n + j + 0] += (buffer_norm_i * buffer[j + 0]);
+            A[i * n + j + 1] += (buffer_norm_i * buffer[j + 1]);
+            A[i * n + j + 2] += (buffer_norm_i * buffer[j + 2]);
+            A[i * n + j + 3] += (buffer_norm_i * buffer[j + 3]);
+            A[i * n + j + 4] += (buffer_norm_i * buffer[j + 4]);
+            A[i * n + j + 5] += (buffer_norm_i * buffer[j + 5]);
+            A[i * n + j + 6] += (buffer_norm_i * buffer[j + 6]);
+            A[i * n + j + 7] += (buffer_norm_i * buffer[j + 7]);
+        }
+        for (; j < n; ++j) { A[i * n + j] += (buffer_norm_i * buffer[j]); }
+    }
+}
+
 static int32_t add_block_observations(AomNoiseModel *noise_model, int32_t c,
                                       const uint8_t *const data, const uint8_t *const denoised,
                                       int32_t w, int32_t h, int32_t stride, int32_t sub_log2[2],
@@ -875,7 +922,6 @@ static int32_t add_block_observations(AomNoiseModel *noise_model, int32_t c,
                       : ((block_size >> sub_log2[0]) - lag));
             for (int32_t y = y_start; y < y_end; ++y) {
                 for (int32_t x = x_start; x < x_end; ++x) {
-                    int32_t      i   = 0;
                     const double val = noise_model->params.use_highbd
                         ? extract_ar_row_highbd(noise_model->coords,
                                                 num_coords,
@@ -902,45 +948,8 @@ static int32_t add_block_observations(AomNoiseModel *noise_model, int32_t c,
                                                y + y_o,
                                                buffer);
 
-                    for (i = 0; i + 8 - 1 < n; i += 8) {
-                        buffer_norm[i + 0] = buffer[i + 0] * recp_sqr_norm;
-                        buffer_norm[i + 1] = buffer[i + 1] * recp_sqr_norm;
-                        buffer_norm[i + 2] = buffer[i + 2] * recp_sqr_norm;
-                        buffer_norm[i + 3] = buffer[i + 3] * recp_sqr_norm;
-                        buffer_norm[i + 4] = buffer[i + 4] * recp_sqr_norm;
-                        buffer_norm[i + 5] = buffer[i + 5] * recp_sqr_norm;
-                        buffer_norm[i + 6] = buffer[i + 6] * recp_sqr_norm;
-                        buffer_norm[i + 7] = buffer[i + 7] * recp_sqr_norm;
-                        b[i + 0] += buffer_norm[i + 0] * val;
-                        b[i + 1] += buffer_norm[i + 1] * val;
-                        b[i + 2] += buffer_norm[i + 2] * val;
-                        b[i + 3] += buffer_norm[i + 3] * val;
-                        b[i + 4] += buffer_norm[i + 4] * val;
-                        b[i + 5] += buffer_norm[i + 5] * val;
-                        b[i + 6] += buffer_norm[i + 6] * val;
-                        b[i + 7] += buffer_norm[i + 7] * val;
-                    }
-                    for (; i < n; ++i) {
-                        buffer_norm[i] = buffer[i] * recp_sqr_norm;
-                        b[i] += buffer_norm[i] * val;
-                    }
-
-                    for (i = 0; i < n; ++i) {
-                        int32_t      j             = 0;
-                        const double buffer_norm_i = buffer_norm[i];
-
-                        for (j = 0; j + 8 - 1 < n; j += 8) {
-                            A[i * n + j + 0] += (buffer_norm_i * buffer[j + 0]);
-                            A[i * n + j + 1] += (buffer_norm_i * buffer[j + 1]);
-                            A[i * n + j + 2] += (buffer_norm_i * buffer[j + 2]);
-                            A[i * n + j + 3] += (buffer_norm_i * buffer[j + 3]);
-                            A[i * n + j + 4] += (buffer_norm_i * buffer[j + 4]);
-                            A[i * n + j + 5] += (buffer_norm_i * buffer[j + 5]);
-                            A[i * n + j + 6] += (buffer_norm_i * buffer[j + 6]);
-                            A[i * n + j + 7] += (buffer_norm_i * buffer[j + 7]);
-                        }
-                        for (; j < n; ++j) { A[i * n + j] += (buffer_norm_i * buffer[j]); }
-                    }
+                    svt_aom_noise_model_add_observation(
+                        buffer, val, recp_sqr_norm, buffer_norm, A, b, n);
 
                     noise_model->latest_state[c].num_observations++;
                 }
@@ -2222,119 +2231,189 @@ static const float *get_half_cos_window(int32_t block_size) {
 DITHER_AND_QUANTIZE(uint8_t, lowbd);
 DITHER_AND_QUANTIZE(uint16_t, highbd);
 
-int32_t svt_aom_wiener_denoise_2d(const uint8_t *const data[3], uint8_t *denoised[3], int32_t w,
-                                  int32_t h, int32_t stride[3], int32_t chroma_sub[2],
-                                  float noise_psd[3], int32_t block_size, int32_t bit_depth,
-                                  int32_t use_highbd) {
-    const float *window_full = NULL, *window_chroma = NULL;
-    float       *plane = NULL;
-    DECLARE_ALIGNED(32, float, *block);
-    block                          = NULL;
-    double                *block_d = NULL, *plane_d = NULL;
-    struct aom_noise_tx_t *tx_full       = NULL;
-    struct aom_noise_tx_t *tx_chroma     = NULL;
-    const int32_t          num_blocks_w  = (w + block_size - 1) / block_size;
-    const int32_t          num_blocks_h  = (h + block_size - 1) / block_size;
-    const int32_t          result_stride = (num_blocks_w + 2) * block_size;
-    const int32_t          result_height = (num_blocks_h + 2) * block_size;
-    float                 *result        = NULL;
-    int32_t                init_success  = 1;
-    AomFlatBlockFinder     block_finder_full;
-    AomFlatBlockFinder     block_finder_chroma;
-    const float            k_block_normalization = (float)((1 << bit_depth) - 1);
+static void wiener_scratch_free(AomWienerScratch *scratch) {
+    free(scratch->plane);
+    svt_aom_free(scratch->block);
+    free(scratch->plane_d);
+    free(scratch->block_d);
+    if (scratch->tx_chroma != scratch->tx_full)
+        svt_aom_noise_tx_free(scratch->tx_chroma);
+    svt_aom_noise_tx_free(scratch->tx_full);
+    memset(scratch, 0, sizeof(*scratch));
+}
+
+static int32_t wiener_scratch_init(AomWienerScratch *scratch, int32_t block_size,
+                                   int32_t chroma_sub) {
+    memset(scratch, 0, sizeof(*scratch));
+    scratch->plane     = (float *)malloc(block_size * block_size * sizeof(*scratch->plane));
+    scratch->block     = (float *)svt_aom_memalign(
+        32, 2 * block_size * block_size * sizeof(*scratch->block));
+    scratch->block_d   = (double *)malloc(block_size * block_size * sizeof(*scratch->block_d));
+    scratch->plane_d   = (double *)malloc(block_size * block_size * sizeof(*scratch->plane_d));
+    scratch->tx_full   = svt_aom_noise_tx_malloc(block_size);
+    scratch->tx_chroma = chroma_sub != 0 ? svt_aom_noise_tx_malloc(block_size >> chroma_sub)
+                                         : scratch->tx_full;
+    if (!scratch->plane || !scratch->block || !scratch->block_d || !scratch->plane_d ||
+        !scratch->tx_full || !scratch->tx_chroma) {
+        wiener_scratch_free(scratch);
+        return 0;
+    }
+    return 1;
+}
+
+void svt_aom_wiener_denoiser_free(AomWienerDenoiser *denoiser) {
+    if (!denoiser)
+        return;
+    free(denoiser->result);
+    wiener_scratch_free(&denoiser->scratch);
+    svt_aom_flat_block_finder_free(&denoiser->block_finder_full);
+    svt_aom_flat_block_finder_free(&denoiser->block_finder_chroma);
+    memset(denoiser, 0, sizeof(*denoiser));
+}
+
+int32_t svt_aom_wiener_denoiser_init(AomWienerDenoiser *denoiser, int32_t w, int32_t h,
+                                     int32_t chroma_sub[2], int32_t block_size,
+                                     int32_t bit_depth, int32_t use_highbd) {
+    int32_t init_success = 1;
+    memset(denoiser, 0, sizeof(*denoiser));
     if (chroma_sub[0] != chroma_sub[1]) {
         SVT_ERROR(
             "svt_aom_wiener_denoise_2d doesn't handle different chroma "
             "subsampling");
         return 0;
     }
-    init_success &= svt_aom_flat_block_finder_init(
-        &block_finder_full, block_size, bit_depth, use_highbd);
-    result  = (float *)malloc((num_blocks_h + 2) * block_size * result_stride * sizeof(*result));
-    plane   = (float *)malloc(block_size * block_size * sizeof(*plane));
-    block   = (float *)svt_aom_memalign(32, 2 * block_size * block_size * sizeof(*block));
-    block_d = (double *)malloc(block_size * block_size * sizeof(*block_d));
-    plane_d = (double *)malloc(block_size * block_size * sizeof(*plane_d));
-    window_full = get_half_cos_window(block_size);
-    tx_full     = svt_aom_noise_tx_malloc(block_size);
+    denoiser->w             = w;
+    denoiser->h             = h;
+    denoiser->chroma_sub[0] = chroma_sub[0];
+    denoiser->chroma_sub[1] = chroma_sub[1];
+    denoiser->block_size    = block_size;
+    denoiser->bit_depth     = bit_depth;
+    denoiser->use_highbd    = use_highbd;
+    denoiser->num_blocks_w  = (w + block_size - 1) / block_size;
+    denoiser->num_blocks_h  = (h + block_size - 1) / block_size;
+    denoiser->result_stride = (denoiser->num_blocks_w + 2) * block_size;
+    denoiser->result_height = (denoiser->num_blocks_h + 2) * block_size;
 
+    init_success &= svt_aom_flat_block_finder_init(
+        &denoiser->block_finder_full, block_size, bit_depth, use_highbd);
+    denoiser->result = (float *)malloc(denoiser->result_height * denoiser->result_stride *
+                                       sizeof(*denoiser->result));
+    denoiser->window_full = get_half_cos_window(block_size);
     if (chroma_sub[0] != 0) {
         init_success &= svt_aom_flat_block_finder_init(
-            &block_finder_chroma, block_size >> chroma_sub[0], bit_depth, use_highbd);
-        window_chroma = get_half_cos_window(block_size >> chroma_sub[0]);
-        tx_chroma     = svt_aom_noise_tx_malloc(block_size >> chroma_sub[0]);
-    } else {
-        window_chroma = window_full;
-        tx_chroma     = tx_full;
-    }
-
-    init_success &= (int32_t)((tx_full != NULL) && (tx_chroma != NULL) && (plane != NULL) &&
-                              (plane_d != NULL) && (block != NULL) && (block_d != NULL) &&
-                              (window_full != NULL) && (window_chroma != NULL) && (result != NULL));
-    for (int32_t c = init_success ? 0 : 3; c < 3; ++c) {
-        const float           *window_function = c == 0 ? window_full : window_chroma;
-        AomFlatBlockFinder    *block_finder    = &block_finder_full;
-        const int32_t          chroma_sub_h    = c > 0 ? chroma_sub[1] : 0;
-        const int32_t          chroma_sub_w    = c > 0 ? chroma_sub[0] : 0;
-        struct aom_noise_tx_t *tx              = (c > 0 && chroma_sub[0] > 0) ? tx_chroma : tx_full;
+            &denoiser->block_finder_chroma, block_size >> chroma_sub[0], bit_depth, use_highbd);
+        denoiser->window_chroma = get_half_cos_window(block_size >> chroma_sub[0]);
+    } else
+        denoiser->window_chroma = denoiser->window_full;
+    init_success &= wiener_scratch_init(&denoiser->scratch, block_size, chroma_sub[0]);
+
+    init_success &= (int32_t)((denoiser->window_full != NULL) &&
+                              (denoiser->window_chroma != NULL) && (denoiser->result != NULL));
+    if (!init_success)
+        svt_aom_wiener_denoiser_free(denoiser);
+    return init_success;
+}
+
+// Filters one row of half overlapped blocks of plane c and accumulates the
+// windowed result. Within a pass (offsx, offsy) the rows write disjoint parts
+// of the result, so a row is the unit of work that can be handed to a worker
+// owning its own scratch. The passes themselves must be accumulated in order
+// to keep the output bit-exact.
+static void wiener_denoise_block_row(const AomWienerDenoiser *denoiser, AomWienerScratch *scratch,
+                                     const uint8_t *const data, int32_t stride, int32_t c,
+                                     float noise_psd, int32_t offsx, int32_t offsy, int32_t by) {
+    const int32_t             block_size       = denoiser->block_size;
+    const int32_t             chroma_sub_h     = c > 0 ? denoiser->chroma_sub[1] : 0;
+    const int32_t             chroma_sub_w     = c > 0 ? denoiser->chroma_sub[0] : 0;
+    const int32_t             block_w          = block_size >> chroma_sub_w;
+    const int32_t             block_h          = block_size >> chroma_sub_h;
+    const int32_t             pixels_per_block = block_w * block_h;
+    const int32_t             result_stride    = denoiser->result_stride;
+    const float              *window_function  = c == 0 ? denoiser->window_full
+                                                          : denoiser->window_chroma;
+    const AomFlatBlockFinder *block_finder     = (c > 0 && denoiser->chroma_sub[0] != 0)
+            ? &denoiser->block_finder_chroma
+            : &denoiser->block_finder_full;
+    struct aom_noise_tx_t *tx = (c > 0 && denoiser->chroma_sub[0] > 0) ? scratch->tx_chroma
+                                                                      : scratch->tx_full;
+    float  *block   = scratch->block;
+    float  *plane   = scratch->plane;
+    double *block_d = scratch->block_d;
+    double *plane_d = scratch->plane_d;
+    float  *result  = denoiser->result;
+
+    // Pad the boundary when processing each block-set.
+    for (int32_t bx = -1; bx < denoiser->num_blocks_w; ++bx) {
+        svt_aom_flat_block_finder_extract_block(block_finder,
+                                                data,
+                                                denoiser->w >> chroma_sub_w,
+                                                denoiser->h >> chroma_sub_h,
+                                                stride,
+                                                bx * block_w + offsx,
+                                                by * block_h + offsy,
+                                                plane_d,
+                                                block_d);
+        for (int32_t j = 0; j < pixels_per_block; ++j) {
+            block[j] = (float)block_d[j];
+            plane[j] = (float)plane_d[j];
+        }
+        pointwise_multiply(window_function, block, pixels_per_block);
+        svt_aom_noise_tx_forward(tx, block);
+        svt_aom_noise_tx_filter(tx, noise_psd);
+        svt_aom_noise_tx_inverse(tx, block);
+
+        // Apply window function to the plane approximation (we will apply
+        // it to the sum of plane + block when composing the results).
+        pointwise_multiply(window_function, plane, pixels_per_block);
+
+        for (int32_t y = 0; y < block_h; ++y) {
+            const int32_t y_result = y + (by + 1) * block_h + offsy;
+            for (int32_t x = 0; x < block_w; ++x) {
+                const int32_t x_result = x + (bx + 1) * block_w + offsx;
+                result[y_result * result_stride + x_result] +=
+                    (block[y * block_w + x] + plane[y * block_w + x]) *
+                    window_function[y * block_w + x];
+            }
+        }
+    }
+}
+
+int32_t svt_aom_wiener_denoiser_run(AomWienerDenoiser *denoiser, const uint8_t *const data[3],
+                                    uint8_t *denoised[3], int32_t stride[3], float noise_psd[3]) {
+    const int32_t block_size            = denoiser->block_size;
+    const int32_t w                     = denoiser->w;
+    const int32_t h                     = denoiser->h;
+    const float   k_block_normalization = (float)((1 << denoiser->bit_depth) - 1);
+    float        *result                = denoiser->result;
+
+    for (int32_t c = 0; c < 3; ++c) {
+        const int32_t chroma_sub_h = c > 0 ? denoiser->chroma_sub[1] : 0;
+        const int32_t chroma_sub_w = c > 0 ? denoiser->chroma_sub[0] : 0;
         if (!data[c] || !denoised[c])
             continue;
-        if (c > 0 && chroma_sub[0] != 0)
-            block_finder = &block_finder_chroma;
-        memset(result, 0, sizeof(*result) * result_stride * result_height);
-        // Do overlapped block processing (half overlapped). The block rows can
-        // easily be done in parallel
+        memset(result, 0, sizeof(*result) * denoiser->result_stride * denoiser->result_height);
+        // Do overlapped block processing (half overlapped). The block rows of a
+        // pass are independent jobs; they run here on the calling thread, which
+        // already works on its own picture.
         for (int32_t offsy = 0; offsy < (block_size >> chroma_sub_h);
              offsy += (block_size >> chroma_sub_h) / 2) {
             for (int32_t offsx = 0; offsx < (block_size >> chroma_sub_w);
                  offsx += (block_size >> chroma_sub_w) / 2) {
-                // Pad the boundary when processing each block-set.
-                for (int32_t by = -1; by < num_blocks_h; ++by) {
-                    for (int32_t bx = -1; bx < num_blocks_w; ++bx) {
-                        const int32_t pixels_per_block = (block_size >> chroma_sub_w) *
-                            (block_size >> chroma_sub_h);
-                        svt_aom_flat_block_finder_extract_block(
-                            block_finder,
-                            data[c],
-                            w >> chroma_sub_w,
-                            h >> chroma_sub_h,
-                            stride[c],
-                            bx * (block_size >> chroma_sub_w) + offsx,
-                            by * (block_size >> chroma_sub_h) + offsy,
-                            plane_d,
-                            block_d);
-                        for (int32_t j = 0; j < pixels_per_block; ++j) {
-                            block[j] = (float)block_d[j];
-                            plane[j] = (float)plane_d[j];
-                        }
-                        pointwise_multiply(window_function, block, pixels_per_block);
-                        svt_aom_noise_tx_forward(tx, block);
-                        svt_aom_noise_tx_filter(tx, noise_psd[c]);
-                        svt_aom_noise_tx_inverse(tx, block);
-
-                        // Apply window function to the plane approximation (we will apply
-                        // it to the sum of plane + block when composing the results).
-                        pointwise_multiply(window_function, plane, pixels_per_block);
-
-                        for (int32_t y = 0; y < (block_size >> chroma_sub_h); ++y) {
-                            const int32_t y_result = y + (by + 1) * (block_size >> chroma_sub_h) +
-                                offsy;
-                            for (int32_t x = 0; x < (block_size >> chroma_sub_w); ++x) {
-                                const int32_t x_result = x +
-                                    (bx + 1) * (block_size >> chroma_sub_w) + offsx;
-                                result[y_result * result_stride + x_result] +=
-                                    (block[y * (block_size >> chroma_sub_w) + x] +
-                                     plane[y * (block_size >> chroma_sub_w) + x]) *
-                                    window_function[y * (block_size >> chroma_sub_w) + x];
-                            }
-                        }
-                    }
-                }
+                for (int32_t by = -1; by < denoiser->num_blocks_h; ++by)
+                    wiener_denoise_block_row(denoiser,
+                                             &denoiser->scratch,
+                                             data[c],
+                                             stride[c],
+                                             c,
+                                             noise_psd[c],
+                                             offsx,
+                                             offsy,
+                                             by);
             }
         }
-        if (use_highbd) {
+        if (denoiser->use_highbd) {
             dither_and_quantize_highbd(result,
-                                       result_stride,
+                                       denoiser->result_stride,
                                        (uint16_t *)denoised[c],
                                        w,
                                        h,
@@ -2345,7 +2424,7 @@ int32_t svt_aom_wiener_denoise_2d(const uint8_t *const data[3], uint8_t *denoise
                                        k_block_normalization);
         } else {
             dither_and_quantize_lowbd(result,
-                                      result_stride,
+                                      denoiser->result_stride,
                                       denoised[c],
                                       w,
                                       h,
@@ -2356,20 +2435,20 @@ int32_t svt_aom_wiener_denoise_2d(const uint8_t *const data[3], uint8_t *denoise
                                       k_block_normalization);
         }
     }
-    free(result);
-    free(plane);
-    svt_aom_free(block);
-    free(plane_d);
-    free(block_d);
-
-    svt_aom_noise_tx_free(tx_full);
+    return 1;
+}
 
-    svt_aom_flat_block_finder_free(&block_finder_full);
-    if (chroma_sub[0] != 0) {
-        svt_aom_flat_block_finder_free(&block_finder_chroma);
-        svt_aom_noise_tx_free(tx_chroma);
-    }
-    return init_success;
+int32_t svt_aom_wiener_denoise_2d(const uint8_t *const data[3], uint8_t *denoised[3], int32_t w,
+                                  int32_t h, int32_t stride[3], int32_t chroma_sub[2],
+                                  float noise_psd[3], int32_t block_size, int32_t bit_depth,
+                                  int32_t use_highbd) {
+    AomWienerDenoiser denoiser;
+    if (!svt_aom_wiener_denoiser_init(
+            &denoiser, w, h, chroma_sub, block_size, bit_depth, use_highbd))
+        return 0;
+    const int32_t ret = svt_aom_wiener_denoiser_run(&denoiser, data, denoised, stride, noise_psd);
+    svt_aom_wiener_denoiser_free(&denoiser);
+    return ret;
 }
 
 EbErrorType svt_aom_denoise_and_model_alloc(AomDenoiseAndModel *ctx, int32_t bit_depth,
@@ -2391,6 +2470,7 @@ static void denoise_and_model_dctor(EbPtr p) {
     }
     svt_aom_noise_model_free(&obj->noise_model);
     svt_aom_flat_block_finder_free(&obj->flat_block_finder);
+    svt_aom_wiener_denoiser_free(&obj->wiener);
 }
 
 EbErrorType denoise_and_model_ctor(AomDenoiseAndModel *object_ptr, EbPtr object_init_data_ptr) {
@@ -2442,22 +2522,45 @@ static int32_t denoise_and_model_realloc_if_necessary(struct AomDenoiseAndModel
                                                       EbPictureBufferDesc *sd, int32_t use_highbd) {
     int32_t chroma_sub_log2[2] = {1, 1}; //todo: send chroma subsampling
 
-    free(ctx->flat_blocks);
-    ctx->flat_blocks = NULL;
-
-    ctx->num_blocks_w = (sd->width + ctx->block_size - 1) / ctx->block_size;
-    ctx->num_blocks_h = (sd->height + ctx->block_size - 1) / ctx->block_size;
-    ctx->flat_blocks  = malloc(ctx->num_blocks_w * ctx->num_blocks_h);
+    // The flat block map, the block finder and the Wiener buffers only depend
+    // on the frame geometry, so they are kept from one frame to the next.
+    const int32_t num_blocks_w = (sd->width + ctx->block_size - 1) / ctx->block_size;
+    const int32_t num_blocks_h = (sd->height + ctx->block_size - 1) / ctx->block_size;
+    if (!ctx->flat_blocks || num_blocks_w != ctx->num_blocks_w ||
+        num_blocks_h != ctx->num_blocks_h) {
+        free(ctx->flat_blocks);
+        ctx->num_blocks_w = num_blocks_w;
+        ctx->num_blocks_h = num_blocks_h;
+        ctx->flat_blocks  = malloc(ctx->num_blocks_w * ctx->num_blocks_h);
+        if (!ctx->flat_blocks) {
+            SVT_ERROR("Unable to allocate flat block map\n");
+            return 0;
+        }
+    }
 
-    svt_aom_flat_block_finder_free(&ctx->flat_block_finder);
-    if (!svt_aom_flat_block_finder_init(
+    if (!ctx->flat_block_finder.A &&
+        !svt_aom_flat_block_finder_init(
             &ctx->flat_block_finder, ctx->block_size, ctx->bit_depth, use_highbd)) {
         SVT_ERROR("Unable to init flat block finder\n");
         return 0;
     }
 
+    if (!ctx->wiener.result || ctx->wiener.w != sd->width || ctx->wiener.h != sd->height) {
+        svt_aom_wiener_denoiser_free(&ctx->wiener);
+        if (!svt_aom_wiener_denoiser_init(&ctx->wiener,
+                                          sd->width,
+                                          sd->height,
+                                          chroma_sub_log2,
+                                          ctx->block_size,
+                                          ctx->bit_depth,
+                                          use_highbd)) {
+            SVT_ERROR("Unable to init wiener denoiser\n");
+            return 0;
+        }
+    }
+
     const AomNoiseModelParams params = {AOM_NOISE_SHAPE_SQUARE, 3, ctx->bit_depth, use_highbd};
-    //  svt_aom_noise_model_free(&ctx->noise_model);
+    svt_aom_noise_model_free(&ctx->noise_model);
     if (!svt_aom_noise_model_init(&ctx->noise_model, params)) {
         SVT_ERROR("Unable to init noise model\n");
         return 0;
@@ -2600,16 +2703,7 @@ int32_t svt_aom_denoise_and_model_run(struct AomDenoiseAndModel *ctx, EbPictureB
     svt_aom_flat_block_finder_run(
         &ctx->flat_block_finder, data[0], sd->width, sd->height, strides[0], ctx->flat_blocks);
 
-    if (!svt_aom_wiener_denoise_2d(data,
-                                   ctx->denoised,
-                                   sd->width,
-                                   sd->height,
-                                   strides,
-                                   chroma_sub_log2,
-                                   ctx->noise_psd,
-                                   block_size,
-                                   ctx->bit_depth,
-                                   use_highbd)) {
+    if (!svt_aom_wiener_denoiser_run(&ctx->wiener, data, ctx->denoised, strides, ctx->noise_psd)) {
         SVT_ERROR("Unable to denoise image\n");
         return 0;
     }
@@ -2660,10 +2754,8 @@ int32_t svt_aom_denoise_and_model_run(struct AomDenoiseAndModel *ctx, EbPictureB
         } else
             unpack_2d_pic(ctx->denoised, sd);
     }
-    svt_aom_flat_block_finder_free(&ctx->flat_block_finder);
+    // The noise model is estimated from the current frame only
     svt_aom_noise_model_free(&ctx->noise_model);
-    free(ctx->flat_blocks);
-    ctx->flat_blocks = NULL;
 
     return 1;
 }
@@ -215,6 +215,45 @@ typedef struct DenoiseAndModelInitData {
     uint16_t stride_cr;
 } DenoiseAndModelInitData;
 
+struct aom_noise_tx_t;
+
+/*!\brief Scratch buffers used to filter one row of blocks in the 2D Wiener
+     * denoiser. Rows of blocks that belong to the same half-overlapped pass do
+     * not overlap, so each job filtering a row only needs its own scratch.
+     */
+typedef struct AomWienerScratch {
+    float                 *plane;
+    float                 *block;
+    double                *plane_d;
+    double                *block_d;
+    struct aom_noise_tx_t *tx_full;
+    struct aom_noise_tx_t *tx_chroma;
+} AomWienerScratch;
+
+/*!\brief Buffers of the 2D Wiener denoiser that only depend on the frame
+     * geometry. They are allocated once and reused for every frame of the same
+     * size instead of being rebuilt for each call.
+     */
+typedef struct AomWienerDenoiser {
+    int32_t w;
+    int32_t h;
+    int32_t chroma_sub[2];
+    int32_t block_size;
+    int32_t bit_depth;
+    int32_t use_highbd;
+    int32_t num_blocks_w;
+    int32_t num_blocks_h;
+    int32_t result_stride;
+    int32_t result_height;
+
+    float             *result;
+    const float       *window_full;
+    const float       *window_chroma;
+    AomFlatBlockFinder block_finder_full;
+    AomFlatBlockFinder block_finder_chroma;
+    AomWienerScratch   scratch;
+} AomWienerDenoiser;
+
 typedef struct AomDenoiseAndModel {
     EbDctor dctor;
     int32_t block_size;
@@ -239,6 +278,7 @@ typedef struct AomDenoiseAndModel {
 
     AomFlatBlockFinder flat_block_finder;
     AomNoiseModel      noise_model;
+    AomWienerDenoiser  wiener;
 } AomDenoiseAndModel;
 
 /************************************
@@ -318,6 +358,20 @@ int32_t svt_aom_wiener_denoise_2d(const uint8_t *const data[3], uint8_t *denoise
                                   float noise_psd[3], int32_t block_size, int32_t bit_depth,
                                   int32_t use_highbd);
 
+/*!\brief Allocates the buffers of a 2D Wiener denoiser for frames of the
+     * given geometry. Returns 0 on failure.
+     */
+int32_t svt_aom_wiener_denoiser_init(AomWienerDenoiser *denoiser, int32_t w, int32_t h,
+                                     int32_t chroma_sub_log2[2], int32_t block_size,
+                                     int32_t bit_depth, int32_t use_highbd);
+void    svt_aom_wiener_denoiser_free(AomWienerDenoiser *denoiser);
+
+/*!\brief Same as svt_aom_wiener_denoise_2d, using the buffers of a denoiser
+     * initialized with svt_aom_wiener_denoiser_init for the frame geometry.
+     */
+int32_t svt_aom_wiener_denoiser_run(AomWienerDenoiser *denoiser, const uint8_t *const data[3],
+                                    uint8_t *denoised[3], int32_t stride[3], float noise_psd[3]);
+
 struct AomDenoiseAndModel;
 
 /*!\brief Denoise the buffer and model the residual noise.
@@ -87,13 +87,11 @@ void svt_aom_noise_tx_forward(struct aom_noise_tx_t *noise_tx, const float *data
     noise_tx->fft(data, noise_tx->temp, noise_tx->tx_block);
 }
 
-void svt_aom_noise_tx_filter(struct aom_noise_tx_t *noise_tx, const float psd) {
-    const int32_t block_size           = noise_tx->block_size;
-    const float   k_beta               = 1.1f;
-    const float   k_beta_m1_div_k_beta = (k_beta - 1.0f) / k_beta;
-    const float   psd_mul_k_beta       = k_beta * psd;
-    const float   k_eps                = 1e-6f;
-    float        *tx_block             = noise_tx->tx_block;
+void svt_aom_noise_tx_filter_block_c(int32_t block_size, float *tx_block, const float psd) {
+    const float k_beta               = 1.1f;
+    const float k_beta_m1_div_k_beta = (k_beta - 1.0f) / k_beta;
+    const float psd_mul_k_beta       = k_beta * psd;
+    const float k_eps                = 1e-6f;
     for (int32_t y = 0; y < block_size; ++y) {
         for (int32_t x = 0; x < block_size; ++x) {
             const float p = tx_block[0] * tx_block[0] + tx_block[1] * tx_block[1];
@@ -110,6 +108,10 @@ void svt_aom_noise_tx_filter(struct aom_noise_tx_t *noise_tx, const float psd) {
     }
 }
 
+void svt_aom_noise_tx_filter(struct aom_noise_tx_t *noise_tx, const float psd) {
+    svt_aom_noise_tx_filter_block(noise_tx->block_size, noise_tx->tx_block, psd);
+}
+
 void svt_aom_noise_tx_inverse(struct aom_noise_tx_t *noise_tx, float *data) {
     const int32_t n = noise_tx->block_size * noise_tx->block_size;
     noise_tx->ifft(noise_tx->tx_block, noise_tx->temp, data);
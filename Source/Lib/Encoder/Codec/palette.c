@@ -313,6 +313,60 @@ void palette_rd_y(PaletteInfo *palette_info, uint8_t *palette_size_array,
 int svt_av1_count_colors(const uint8_t *src, int stride, int rows, int cols, int *val_count);
 int svt_av1_count_colors_highbd(uint16_t *src, int stride, int rows, int cols, int bit_depth,
                                 int *val_count);
+// Build the colour presence bitmaps of all the 8x8 units of the current SB
+static void build_palette_unit_colors(ModeDecisionContext *context_ptr,
+                                      EbPictureBufferDesc *src_pic, EbBool is16bit, int words) {
+    const int units_per_row = context_ptr->sb_size >> 3;
+    const int sb_width  = AOMMIN(context_ptr->sb_size, src_pic->width - context_ptr->sb_origin_x);
+    const int sb_height = AOMMIN(context_ptr->sb_size, src_pic->height - context_ptr->sb_origin_y);
+    const int stride    = src_pic->stride_y;
+    const uint8_t *const sb_src = src_pic->buffer_y +
+        (((context_ptr->sb_origin_x + src_pic->origin_x) +
+          (context_ptr->sb_origin_y + src_pic->origin_y) * stride)
+         << is16bit);
+
+    memset(context_ptr->palette_unit_colors,
+           0,
+           sizeof(uint64_t) * units_per_row * units_per_row * words);
+    for (int y = 0; y < sb_height; y++) {
+        for (int x = 0; x < sb_width; x++) {
+            const int val = is16bit ? ((const uint16_t *)sb_src)[y * stride + x]
+                                    : sb_src[y * stride + x];
+            uint64_t *unit_colors = context_ptr->palette_unit_colors +
+                ((y >> 3) * units_per_row + (x >> 3)) * words;
+            unit_colors[val >> 6] |= (uint64_t)1 << (val & 63);
+        }
+    }
+    context_ptr->palette_unit_colors_ready = 1;
+}
+
+// Count the colours of an 8x8-aligned block by merging the bitmaps of its 8x8 units. Counting
+// stops once max_colors is exceeded.
+static int count_palette_unit_colors(ModeDecisionContext *context_ptr, int rows, int cols,
+                                     int words, int max_colors) {
+    const int units_per_row = context_ptr->sb_size >> 3;
+    const int unit_x = (context_ptr->blk_origin_x - context_ptr->sb_origin_x) >> 3;
+    const int unit_y = (context_ptr->blk_origin_y - context_ptr->sb_origin_y) >> 3;
+    uint64_t  colors[(1 << 12) >> 6];
+
+    memset(colors, 0, sizeof(colors[0]) * words);
+    for (int y = unit_y; y < unit_y + (rows >> 3); y++) {
+        for (int x = unit_x; x < unit_x + (cols >> 3); x++) {
+            const uint64_t *unit_colors = context_ptr->palette_unit_colors +
+                (y * units_per_row + x) * words;
+            for (int w = 0; w < words; w++) colors[w] |= unit_colors[w];
+        }
+    }
+    int n = 0;
+    for (int w = 0; w < words; w++) {
+        for (uint64_t bits = colors[w]; bits; bits &= bits - 1) {
+            if (++n > max_colors)
+                return n;
+        }
+    }
+    return n;
+}
+
 /****************************************
    determine all palette luma candidates
  ****************************************/
@@ -345,7 +399,19 @@ void search_palette_luma(PictureControlSet *pcs_ptr, ModeDecisionContext *contex
     int count_buf[1 << 12]; // Maximum (1 << 12) color levels.
 
     unsigned bit_depth = pcs_ptr->parent_pcs_ptr->scs_ptr->encoder_bit_depth;
-    if (is16bit)
+    // Blocks made of whole 8x8 units get their number of colours from the SB bitmaps, so the
+    // blocks that cannot use a palette are rejected without reading their pixels, and the colour
+    // histogram of the others is built with the k-means data
+    const EbBool use_unit_colors = context_ptr->palette_unit_colors && !(rows & 7) && !(cols & 7);
+    if (use_unit_colors) {
+        const int words = (1 << (is16bit ? bit_depth : EB_8BIT)) >> 6;
+        if (!context_ptr->palette_unit_colors_ready)
+            build_palette_unit_colors(context_ptr, src_pic, is16bit, words);
+        colors = count_palette_unit_colors(context_ptr, rows, cols, words, 64);
+        if (colors <= 1 || colors > 64)
+            return;
+        memset(count_buf, 0, sizeof(count_buf[0]) << bit_depth_pal);
+    } else if (is16bit)
         colors = svt_av1_count_colors_highbd(
             (uint16_t *)src, src_stride, rows, cols, bit_depth, count_buf);
     else
@@ -365,6 +431,8 @@ void search_palette_luma(PictureControlSet *pcs_ptr, ModeDecisionContext *contex
             for (c = 0; c < cols; ++c) {                                       \
                 int val            = ((src_data_type)src)[r * src_stride + c]; \
                 data[r * cols + c] = val;                                      \
+                if (use_unit_colors)                                           \
+                    ++count_buf[val];                                          \
                 if (val < lb)                                                  \
                     lb = val;                                                  \
                 else if (val > ub)                                             \
@@ -24,6 +24,7 @@
 #include "firstpass.h"
 #include "EbSequenceControlSet.h"
 #include "EbEntropyCoding.h"
+#include "EbLog.h"
 //#define INT_MAX 0x7fffffff
 
 #define DEFAULT_KF_BOOST 2300
@@ -1767,7 +1768,7 @@ static int get_section_target_bandwidth(PictureParentControlSet *pcs_ptr) {
     TWO_PASS *const     twopass            = &scs_ptr->twopass;
     RATE_CONTROL *const rc                 = &encode_context_ptr->rc;
     int                 section_target_bandwidth;
-    const int           frames_left = (int)(twopass->stats_buf_ctx->total_stats->count -
+    const int           frames_left = (int)(svt_av1_twopass_coded_frames(scs_ptr) -
                                   pcs_ptr->picture_number);
     if (scs_ptr->lap_enabled)
         section_target_bandwidth = (int)rc->avg_frame_bandwidth;
@@ -2175,6 +2176,58 @@ static void read_stat_from_file(SequenceControlSet *scs_ptr) {
     }
     twopass->stats_buf_ctx->total_stats->stat_struct.total_num_bits = total_num_bits;
 }
+/*
+ * Chunked encoding: restrict the stats to the frames of the chunk. total_stats keep the whole
+ * sequence so the error normalization is the same in all the chunks of a title, and the chunk
+ * gets the share of the sequence budget matching its share of the modified error.
+ */
+static void init_chunk_stats(SequenceControlSet *scs_ptr) {
+    TWO_PASS *const         twopass            = &scs_ptr->twopass;
+    EncodeContext          *encode_context_ptr = scs_ptr->encode_context_ptr;
+    STATS_BUFFER_CTX *const stats_buf_ctx      = twopass->stats_buf_ctx;
+    const uint64_t          total_frames       = (uint64_t)(stats_buf_ctx->stats_in_end -
+                                             stats_buf_ctx->stats_in_start);
+    uint64_t                start              = scs_ptr->static_config.chunk_start_frame;
+
+    if (start >= total_frames) {
+        SVT_WARN("Chunk start frame %llu is out of the stats range, starting at frame %llu\n",
+                 (unsigned long long)start,
+                 (unsigned long long)(total_frames - 1));
+        start = total_frames - 1;
+    }
+    const uint64_t frames = scs_ptr->static_config.chunk_frames
+        ? MIN(scs_ptr->static_config.chunk_frames, total_frames - start)
+        : total_frames - start;
+
+    stats_buf_ctx->stats_in_start += start;
+    stats_buf_ctx->stats_in_end       = stats_buf_ctx->stats_in_start + frames;
+    stats_buf_ctx->stats_in_end_write = stats_buf_ctx->stats_in_end;
+    twopass->stats_in                 = stats_buf_ctx->stats_in_start;
+
+    double chunk_error = 0.0;
+    svt_av1_twopass_zero_stats(stats_buf_ctx->total_left_stats);
+    for (const FIRSTPASS_STATS *s = stats_buf_ctx->stats_in_start; s < stats_buf_ctx->stats_in_end;
+         ++s) {
+        svt_av1_accumulate_stats(stats_buf_ctx->total_left_stats, s);
+        chunk_error += calculate_modified_err(
+            &encode_context_ptr->frame_info, twopass, &encode_context_ptr->two_pass_cfg, s);
+    }
+    twopass->bits_left = (int64_t)((double)twopass->bits_left * chunk_error /
+                                   DOUBLE_DIVIDE_CHECK(twopass->modified_error_left));
+    twopass->modified_error_left = chunk_error;
+    // The reference bits of the middle pass must cover the same frames as bits_left
+    if (twopass->passes == 3 && scs_ptr->static_config.pass != ENC_MIDDLE_PASS)
+        read_stat_from_file(scs_ptr);
+}
+/*
+ * Number of frames coded in the second pass: the whole sequence, or the chunk in chunked encoding
+ */
+double svt_av1_twopass_coded_frames(const SequenceControlSet *scs_ptr) {
+    const STATS_BUFFER_CTX *stats_buf_ctx = scs_ptr->twopass.stats_buf_ctx;
+    if (scs_ptr->static_config.chunk_start_frame || scs_ptr->static_config.chunk_frames)
+        return (double)(stats_buf_ctx->stats_in_end_write - stats_buf_ctx->stats_in_start);
+    return stats_buf_ctx->total_stats->count;
+}
 void svt_av1_init_single_pass_lap(SequenceControlSet *scs_ptr) {
     TWO_PASS *const twopass            = &scs_ptr->twopass;
     EncodeContext  *encode_context_ptr = scs_ptr->encode_context_ptr;
@@ -2262,6 +2315,8 @@ void svt_av1_init_second_pass(SequenceControlSet *scs_ptr) {
         }
         twopass->modified_error_left = modified_error_total;
     }
+    if (scs_ptr->static_config.chunk_start_frame || scs_ptr->static_config.chunk_frames)
+        init_chunk_stats(scs_ptr);
 
     // Reset the vbr bits off target counters
     encode_context_ptr->rc.vbr_bits_off_target      = 0;
@@ -2447,7 +2502,7 @@ void crf_assign_max_rate(PictureParentControlSet *ppcs_ptr) {
         CODED_FRAMES_STAT_QUEUE_MAX_DEPTH;
     int32_t end_index   = start_index + frames_in_sw;
     frames_in_sw        = (scs_ptr->passes > 1)
-               ? MIN(end_index, (int32_t)scs_ptr->twopass.stats_buf_ctx->total_stats->count) - start_index
+               ? MIN(end_index, (int32_t)svt_av1_twopass_coded_frames(scs_ptr)) - start_index
                : frames_in_sw;
     int64_t max_bits_sw = (int64_t)scs_ptr->static_config.max_bit_rate * (int32_t)frames_in_sw /
         frame_rate;
@@ -496,6 +496,11 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
                         worst_kept_motion = &motions[i];
                     }
                 }
+                // Once every kept motion has all the points as inliers, the
+                // remaining trials can only change the variances, while the
+                // parameters are recomputed below from the same inliers.
+                if (worst_kept_motion->num_inliers == npoints)
+                    break;
             }
         }
         trial_count++;
@@ -535,10 +535,10 @@ EbErrorType load_default_buffer_configuration_settings(
         scs_ptr->tf_segment_row_count = me_seg_h;//1;//
     }
 
-    // adjust buffer count for superres
-    uint32_t superres_count = (scs_ptr->static_config.superres_mode == SUPERRES_AUTO &&
-        (scs_ptr->static_config.superres_auto_search_type == SUPERRES_AUTO_DUAL ||
-         scs_ptr->static_config.superres_auto_search_type == SUPERRES_AUTO_ALL)) ? 1 : 0;
+    // adjust buffer count for superres: in the modes decided in rate control, the child PCS of a
+    // picture is held while the picture goes through ME again (and through the recode loop)
+    uint32_t superres_count = (scs_ptr->static_config.superres_mode == SUPERRES_AUTO ||
+        scs_ptr->static_config.superres_mode == SUPERRES_QTHRESH) ? 1 : 0;
 
     //#====================== Data Structures and Picture Buffers ======================
     // bistream buffer will be allocated at run time. app will free the buffer once written to file.
@@ -692,8 +692,8 @@ EbErrorType load_default_buffer_configuration_settings(
         scs_ptr->picture_control_set_pool_init_count           = min_parent;
         scs_ptr->pa_reference_picture_buffer_init_count        = min_paref;
         scs_ptr->reference_picture_buffer_init_count           = min_ref;
-        scs_ptr->picture_control_set_pool_init_count_child     = min_child;
-        scs_ptr->enc_dec_pool_init_count                    = min_child;
+        scs_ptr->picture_control_set_pool_init_count_child     = min_child + superres_count;
+        scs_ptr->enc_dec_pool_init_count                    = min_child + superres_count;
         scs_ptr->overlay_input_picture_buffer_init_count       = min_overlay;
 
         scs_ptr->output_recon_buffer_fifo_init_count = MAX(scs_ptr->reference_picture_buffer_init_count, min_recon);
@@ -1513,6 +1513,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
         input_data.log2_tile_cols = enc_handle_ptr->scs_instance_array[instance_index]->scs_ptr->static_config.tile_columns;
         input_data.log2_sb_sz = (scs_init.sb_size == 128) ? 5 : 4;
         input_data.is_16bit_pipeline = enc_handle_ptr->scs_instance_array[instance_index]->scs_ptr->is_16bit_pipeline;
+        input_data.hbd_16bit_source = (uint8_t)enc_handle_ptr->scs_instance_array[instance_index]->scs_ptr->static_config.hbd_16bit_source;
         input_data.non_m8_pad_w = enc_handle_ptr->scs_instance_array[instance_index]->scs_ptr->max_input_pad_right;
         input_data.non_m8_pad_h = enc_handle_ptr->scs_instance_array[instance_index]->scs_ptr->max_input_pad_bottom;
 
@@ -2348,6 +2349,16 @@ EB_API EbErrorType svt_av1_enc_deinit(EbComponentType *svt_enc_component){
         svt_shutdown_process(handle->dlf_results_resource_ptr);
         svt_shutdown_process(handle->cdef_results_resource_ptr);
         svt_shutdown_process(handle->rest_results_resource_ptr);
+
+        if (handle->scs_instance_array && handle->scs_instance_array[0]) {
+            EncodeContext *encode_context_ptr = handle->scs_instance_array[0]->encode_context_ptr;
+            if (encode_context_ptr && encode_context_ptr->static_sb_count)
+                SVT_INFO("Static SBs: %llu of %llu inter SBs (%.2f%%)\n",
+                         (unsigned long long)encode_context_ptr->static_sb_count,
+                         (unsigned long long)encode_context_ptr->inter_sb_count,
+                         100.0 * encode_context_ptr->static_sb_count /
+                             encode_context_ptr->inter_sb_count);
+        }
     }
 
     return EB_ErrorNone;
@@ -3359,8 +3370,17 @@ void set_param_based_on_input(SequenceControlSet *scs_ptr)
 
     // Update the scd_delay based on SCD, 1first pass
     // Delay needed for SCD , 1first pass of (2pass and 1pass VBR)
-    if (scs_ptr->static_config.scene_change_detection || scs_ptr->vq_ctrls.sharpness_ctrls.scene_transition || scs_ptr->static_config.pass == ENC_FIRST_PASS || scs_ptr->lap_enabled)
+    if (scs_ptr->vq_ctrls.sharpness_ctrls.scene_transition || scs_ptr->static_config.pass == ENC_FIRST_PASS || scs_ptr->lap_enabled)
         scs_ptr->scd_delay = MAX(scs_ptr->scd_delay, 2);
+    // The scene change detector only waits for the future pictures it looks at, the
+    // scene transition detection keeps using the next picture
+    scs_ptr->scd_look_ahead = scs_ptr->static_config.scene_change_detection ?
+        scs_ptr->static_config.scene_change_look_ahead : 1;
+    if (scs_ptr->static_config.scene_change_detection)
+        scs_ptr->scd_delay = MAX(scs_ptr->scd_delay, scs_ptr->scd_look_ahead);
+    // The first pass frames of the window are analysed concurrently, use the widest window
+    if (scs_ptr->static_config.pass == ENC_FIRST_PASS && !scs_ptr->lap_enabled)
+        scs_ptr->scd_delay = MAX(scs_ptr->scd_delay, SCD_LAD);
 
     // no future minigop is used for lowdelay prediction structure
     if (scs_ptr->static_config.pred_structure == EB_PRED_LOW_DELAY_P || scs_ptr->static_config.pred_structure == EB_PRED_LOW_DELAY_B) {
@@ -3579,7 +3599,8 @@ void set_mini_gop_size_controls(MiniGopSizeCtrls *mgs_ctls, uint8_t mg_level,int
         mgs_ctls->adptive_enable = 0;
         break;
     case 1:
-        mgs_ctls->adptive_enable = 1;
+    case 2:
+        mgs_ctls->adptive_enable = mg_level;
         mgs_ctls->animation_type_th = 0.40;
         mgs_ctls->hm_th = 0.95;
         mgs_ctls->hsa_th = 0.5;
@@ -3588,6 +3609,8 @@ void set_mini_gop_size_controls(MiniGopSizeCtrls *mgs_ctls, uint8_t mg_level,int
         mgs_ctls->short_shot_th = 3;
         mgs_ctls->hmv_di_th = 0.75;
         mgs_ctls->lmv_di_th = input_resolution < INPUT_SIZE_360p_RANGE ? 0.5 : 0.35;
+        mgs_ctls->mg_hm_th = 0.78;
+        mgs_ctls->mg_mv_in_out_th = 0.6;
         break;
     default:
         mgs_ctls->adptive_enable = 0;
@@ -3683,7 +3706,15 @@ void copy_api_from_app(
     scs_ptr->intra_angle_delta = DEFAULT;
     scs_ptr->intrabc_mode = DEFAULT;
     scs_ptr->ten_bit_format = 0;
-    scs_ptr->speed_control_flag = 0;
+    // Real-time speed control adapts the preset of each picture, single pass only
+    scs_ptr->static_config.target_fps = config_struct->target_fps;
+    scs_ptr->static_config.chunk_start_frame = config_struct->chunk_start_frame;
+    scs_ptr->static_config.chunk_frames = config_struct->chunk_frames;
+    scs_ptr->static_config.stats_source_width = config_struct->stats_source_width;
+    scs_ptr->static_config.stats_source_height = config_struct->stats_source_height;
+    scs_ptr->speed_control_flag = config_struct->target_fps && config_struct->pass == ENC_SINGLE_PASS;
+    if (config_struct->target_fps && !scs_ptr->speed_control_flag)
+        SVT_WARN("Speed control is only supported in single pass, target fps ignored.\n");
 
     // Padding Offsets
     scs_ptr->sb_sz = 64;
@@ -3691,6 +3722,7 @@ void copy_api_from_app(
     scs_ptr->static_config.intra_period_length = ((EbSvtAv1EncConfiguration*)config_struct)->intra_period_length;
     scs_ptr->static_config.intra_refresh_type = ((EbSvtAv1EncConfiguration*)config_struct)->intra_refresh_type;
     scs_ptr->static_config.hierarchical_levels = ((EbSvtAv1EncConfiguration*)config_struct)->hierarchical_levels;
+    scs_ptr->static_config.enable_adaptive_mini_gop = ((EbSvtAv1EncConfiguration*)config_struct)->enable_adaptive_mini_gop;
     scs_ptr->static_config.enc_mode = ((EbSvtAv1EncConfiguration*)config_struct)->enc_mode;
     scs_ptr->static_config.use_qp_file = ((EbSvtAv1EncConfiguration*)config_struct)->use_qp_file;
     scs_ptr->static_config.use_fixed_qindex_offsets = ((EbSvtAv1EncConfiguration*)config_struct)->use_fixed_qindex_offsets;
@@ -3754,10 +3786,13 @@ void copy_api_from_app(
 
     // Rate Control
     scs_ptr->static_config.scene_change_detection = ((EbSvtAv1EncConfiguration*)config_struct)->scene_change_detection;
+    scs_ptr->static_config.scene_change_look_ahead = ((EbSvtAv1EncConfiguration*)config_struct)->scene_change_look_ahead;
     scs_ptr->static_config.rate_control_mode = ((EbSvtAv1EncConfiguration*)config_struct)->rate_control_mode;
 
-    if (scs_ptr->static_config.rate_control_mode == 2) {
-        SVT_WARN("CBR Rate control is currently not supported, switching to VBR\n");
+    // Only the one pass low delay CBR path is supported
+    if (scs_ptr->static_config.rate_control_mode == 2 &&
+        scs_ptr->static_config.pass != ENC_SINGLE_PASS) {
+        SVT_WARN("Multi-pass CBR Rate control is currently not supported, switching to VBR\n");
         scs_ptr->static_config.rate_control_mode = 1;
     }
 
@@ -3804,6 +3839,7 @@ void copy_api_from_app(
     scs_ptr->static_config.over_shoot_pct      = ((EbSvtAv1EncConfiguration*)config_struct)->over_shoot_pct;
     scs_ptr->static_config.mbr_over_shoot_pct  = ((EbSvtAv1EncConfiguration*)config_struct)->mbr_over_shoot_pct;
     scs_ptr->static_config.maximum_buffer_size_ms   = ((EbSvtAv1EncConfiguration*)config_struct)->maximum_buffer_size_ms;
+    scs_ptr->static_config.cbr_inflight_estimates   = ((EbSvtAv1EncConfiguration*)config_struct)->cbr_inflight_estimates;
     scs_ptr->static_config.starting_buffer_level_ms = ((EbSvtAv1EncConfiguration*)config_struct)->starting_buffer_level_ms;
     scs_ptr->static_config.optimal_buffer_level_ms  = ((EbSvtAv1EncConfiguration*)config_struct)->optimal_buffer_level_ms;
     scs_ptr->static_config.recode_loop         = ((EbSvtAv1EncConfiguration*)config_struct)->recode_loop;
@@ -3826,6 +3862,8 @@ void copy_api_from_app(
     scs_ptr->subsampling_x = (scs_ptr->chroma_format_idc == EB_YUV444 ? 1 : 2) - 1;
     scs_ptr->subsampling_y = (scs_ptr->chroma_format_idc >= EB_YUV422 ? 1 : 2) - 1;
     scs_ptr->static_config.compressed_ten_bit_format = ((EbSvtAv1EncConfiguration*)config_struct)->compressed_ten_bit_format;
+    scs_ptr->static_config.p010_input = ((EbSvtAv1EncConfiguration*)config_struct)->p010_input;
+    scs_ptr->static_config.hbd_16bit_source = ((EbSvtAv1EncConfiguration*)config_struct)->hbd_16bit_source;
 
     // Thresholds
     scs_ptr->static_config.high_dynamic_range_input = ((EbSvtAv1EncConfiguration*)config_struct)->high_dynamic_range_input;
@@ -3878,10 +3916,12 @@ void copy_api_from_app(
     scs_ptr->static_config.superres_kf_qthres = config_struct->superres_kf_qthres;
     if (scs_ptr->static_config.superres_mode == SUPERRES_AUTO)
     {
-        // TODO: set search mode based on preset
-        //scs_ptr->static_config.superres_auto_search_type = SUPERRES_AUTO_SOLO;
-        scs_ptr->static_config.superres_auto_search_type = SUPERRES_AUTO_DUAL;
-        //scs_ptr->static_config.superres_auto_search_type = SUPERRES_AUTO_ALL;
+        // The recode loop is only entered for the frames where the energy analysis predicts
+        // that superres could win, so searching all the denominators is kept for the slower presets
+        if (scs_ptr->static_config.enc_mode <= ENC_M3)
+            scs_ptr->static_config.superres_auto_search_type = SUPERRES_AUTO_ALL;
+        else
+            scs_ptr->static_config.superres_auto_search_type = SUPERRES_AUTO_DUAL;
     }
 
     // Prediction Structure
@@ -3956,7 +3996,8 @@ EB_API EbErrorType svt_av1_enc_set_parameter(
     set_param_based_on_input(
         enc_handle->scs_instance_array[instance_index]->scs_ptr);
     MiniGopSizeCtrls *mgs_ctls = &enc_handle->scs_instance_array[instance_index]->scs_ptr->mgs_ctls;
-    uint8_t mg_level = (enc_handle->scs_instance_array[instance_index]->scs_ptr->static_config.pass == ENC_MIDDLE_PASS || enc_handle->scs_instance_array[instance_index]->scs_ptr->static_config.pass == ENC_LAST_PASS) ? 1 : 0;
+    uint8_t mg_level = (enc_handle->scs_instance_array[instance_index]->scs_ptr->static_config.pass == ENC_MIDDLE_PASS || enc_handle->scs_instance_array[instance_index]->scs_ptr->static_config.pass == ENC_LAST_PASS) ?
+        (enc_handle->scs_instance_array[instance_index]->scs_ptr->static_config.enable_adaptive_mini_gop ? 2 : 1) : 0;
     enc_handle->scs_instance_array[instance_index]->scs_ptr->max_heirachical_level = enc_handle->scs_instance_array[instance_index]->scs_ptr->static_config.hierarchical_levels;
     enc_handle->scs_instance_array[instance_index]->scs_ptr->enable_adaptive_mini_gop = 0;
     set_mini_gop_size_controls(mgs_ctls, mg_level, enc_handle->scs_instance_array[instance_index]->scs_ptr->input_resolution);
@@ -4108,7 +4149,9 @@ void downsample_2d_c_16_zero2bit_skipall(uint16_t *input_samples, // input param
     uint32_t input_area_height, // input parameter, input area height
     uint8_t *decim_8b_samples, // output parameter, decimated samples Ptr
     uint32_t decim_stride, // input parameter, output stride
-    uint32_t decim_step) // input parameter, decimation amount in pixels
+    uint32_t decim_step, // input parameter, decimation amount in pixels
+    uint32_t sample_step, // input parameter, distance between two samples of the plane (2 for interleaved chroma)
+    uint32_t msb_shift) // input parameter, shift to the 8 MSBs (2 for LSB aligned, 8 for MSB aligned samples)
 {
     uint32_t       horizontal_index;
     uint32_t       vertical_index;
@@ -4123,7 +4166,7 @@ void downsample_2d_c_16_zero2bit_skipall(uint16_t *input_samples, // input param
         for (horizontal_index = half_decim_step, decim_horizontal_index = 0;
             horizontal_index < input_area_width;
             horizontal_index += decim_step, decim_horizontal_index++) {
-            decim_8b_samples[decim_horizontal_index] = (uint8_t)((prev_input_line[horizontal_index - 1]) >> 2);
+            decim_8b_samples[decim_horizontal_index] = (uint8_t)((prev_input_line[(horizontal_index - 1) * sample_step]) >> msb_shift);
         }
         input_samples += input_stripe_stride;
         decim_8b_samples += decim_stride;
@@ -4326,6 +4369,9 @@ static EbErrorType downsample_copy_frame_buffer(
         uint16_t source_luma_stride = (uint16_t)(input_ptr->y_stride);
         uint16_t source_cr_stride = (uint16_t)(input_ptr->cr_stride);
         uint16_t source_cb_stride = (uint16_t)(input_ptr->cb_stride);
+        // P010 samples are MSB aligned and the Cr samples are interleaved with the Cb samples
+        uint32_t sample_shift = config->p010_input ? 8 : 2;
+        uint32_t chroma_step = config->p010_input ? 2 : 1;
 
         downsample_2d_c_16_zero2bit_skipall(
             (uint16_t*)(uint16_t*)(input_ptr->luma + luma_offset),
@@ -4334,7 +4380,9 @@ static EbErrorType downsample_copy_frame_buffer(
             luma_height << 1,
             (y8b_input_picture_ptr->buffer_y + luma_buffer_offset),
             y8b_input_picture_ptr->stride_y,
-            2);
+            2,
+            1,
+            sample_shift);
 
         memset(input_picture_ptr->buffer_bit_inc_y, 0, input_picture_ptr->luma_size/4);
 
@@ -4348,18 +4396,22 @@ static EbErrorType downsample_copy_frame_buffer(
                 luma_height,
                 input_picture_ptr->buffer_cb + chroma_buffer_offset,
                 y8b_input_picture_ptr->stride_cb,
-                2);
+                2,
+                chroma_step,
+                sample_shift);
 
             memset(input_picture_ptr->buffer_bit_inc_cb, 0, input_picture_ptr->chroma_size/4);
 
             downsample_2d_c_16_zero2bit_skipall(
-                (uint16_t*)(input_ptr->cr + chroma_offset),
-                source_cr_stride,
+                config->p010_input ? (uint16_t*)input_ptr->cb + 1 : (uint16_t*)(input_ptr->cr + chroma_offset),
+                config->p010_input ? source_cb_stride : source_cr_stride,
                 luma_width,
                 luma_height,
                 input_picture_ptr->buffer_cr + chroma_buffer_offset,
                 y8b_input_picture_ptr->stride_cr,
-                2);
+                2,
+                chroma_step,
+                sample_shift);
 
             memset(input_picture_ptr->buffer_bit_inc_cr, 0, input_picture_ptr->chroma_size/4);
         }
@@ -4506,6 +4558,42 @@ static EbErrorType copy_frame_buffer(
             }
         }
     }
+    else if (config->p010_input) {
+        // P010: the 10-bit samples are MSB aligned and the chroma samples are interleaved, they are
+        // split into the 8-bit and 2-bit planes in the same pass
+        uint32_t luma_buffer_offset = (input_picture_ptr->stride_y*scs_ptr->top_padding + scs_ptr->left_padding);
+        uint32_t chroma_buffer_offset = (input_picture_ptr->stride_cr*(scs_ptr->top_padding >> 1) + (scs_ptr->left_padding >> 1));
+        uint16_t luma_width = (uint16_t)(input_picture_ptr->width - scs_ptr->max_input_pad_right);
+        uint16_t luma_height = (uint16_t)(input_picture_ptr->height - scs_ptr->max_input_pad_bottom);
+
+        uint32_t comp_stride_y = input_picture_ptr->stride_y / 4;
+        uint32_t comp_luma_buffer_offset = comp_stride_y * input_picture_ptr->origin_y + input_picture_ptr->origin_x/4;
+
+        uint32_t comp_stride_uv = input_picture_ptr->stride_cb / 4;
+        uint32_t comp_chroma_buffer_offset = comp_stride_uv * (input_picture_ptr->origin_y/2) + input_picture_ptr->origin_x /2 / 4;
+
+        svt_unpack_p010_and_2bcompress(
+            (uint16_t*)input_ptr->luma,
+            input_ptr->y_stride,
+            y8b_input_picture_ptr->buffer_y + luma_buffer_offset,
+            y8b_input_picture_ptr->stride_y,
+            input_picture_ptr->buffer_bit_inc_y + comp_luma_buffer_offset,
+            comp_stride_y,
+            luma_width,
+            luma_height);
+        if (pass != ENCODE_FIRST_PASS)
+            svt_unpack_p010_uv_and_2bcompress(
+                (uint16_t*)input_ptr->cb,
+                input_ptr->cb_stride,
+                input_picture_ptr->buffer_cb + chroma_buffer_offset,
+                input_picture_ptr->buffer_cr + chroma_buffer_offset,
+                input_picture_ptr->stride_cb,
+                input_picture_ptr->buffer_bit_inc_cb + comp_chroma_buffer_offset,
+                input_picture_ptr->buffer_bit_inc_cr + comp_chroma_buffer_offset,
+                comp_stride_uv,
+                luma_width / 2,
+                luma_height / 2);
+    }
     else { // 10bit packed
         uint32_t luma_offset = 0;
         uint32_t luma_buffer_offset = (input_picture_ptr->stride_y*scs_ptr->top_padding + scs_ptr->left_padding);
@@ -4616,6 +4704,44 @@ static EbErrorType copy_metadata_buffer(EbBufferHeaderType *dst, EbBufferHeaderT
     }
     return return_error;
 }
+/***********************************************
+**** Deep copy of the input private data list
+**** The external rate control parameters are kept in the p_app_private of the
+**** library input buffer until resource coordination moves them to the picture
+************************************************/
+static void copy_private_data_list(EbBufferHeaderType *dst, EbBufferHeaderType *src) {
+    dst->p_app_private = NULL;
+    for (EbPrivDataNode *node = (EbPrivDataNode *)src->p_app_private; node; node = node->next) {
+        if (node->node_type != FRAME_RC_PARAMS_EVENT)
+            continue;
+        const EbFrameRcParams *src_params = (const EbFrameRcParams *)node->data;
+        if (!src_params || node->size != sizeof(EbFrameRcParams)) {
+            SVT_ERROR("Invalid frame rate control parameters, ignored\n");
+            continue;
+        }
+        const uint32_t sb_count = src_params->sb_delta_qindex ? src_params->sb_delta_qindex_count
+                                                              : 0;
+        EbFrameRcParams *dst_params;
+        // The SB delta qindex map is stored after the parameters
+        EB_NO_THROW_MALLOC(dst_params, sizeof(EbFrameRcParams) + sb_count);
+        if (!dst_params) {
+            SVT_ERROR("Frame rate control parameters could not be added to the buffer.\n");
+            continue;
+        }
+        *dst_params = *src_params;
+        if (sb_count) {
+            int8_t *sb_delta_qindex = (int8_t *)(dst_params + 1);
+            svt_memcpy(sb_delta_qindex, src_params->sb_delta_qindex, sb_count);
+            dst_params->sb_delta_qindex = sb_delta_qindex;
+        } else
+            dst_params->sb_delta_qindex = NULL;
+        dst_params->sb_delta_qindex_count = sb_count;
+        if (dst->p_app_private)
+            EB_FREE(dst->p_app_private);
+        dst->p_app_private = dst_params;
+    }
+}
+
 /**********************************
 * Empty This Buffer
 **********************************/
@@ -4657,6 +4783,7 @@ EB_API EbErrorType svt_av1_enc_send_picture(
             lib_y8b_hdr,
             app_hdr,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.pass == ENC_FIRST_PASS);
+        copy_private_data_list(lib_reg_hdr, app_hdr);
     }
 
     //Take a new App-RessCoord command
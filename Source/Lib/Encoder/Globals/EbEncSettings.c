@@ -286,6 +286,31 @@ EbErrorType svt_av1_verify_settings(SequenceControlSet *scs_ptr) {
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->p010_input != 0 && config->p010_input != 1) {
+        SVT_ERROR("Instance %u: Invalid P010 input flag [0 - 1]\n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->p010_input &&
+        (config->encoder_bit_depth != 10 || config->compressed_ten_bit_format)) {
+        SVT_ERROR("Instance %u: P010 input requires a 10-bit uncompressed input\n",
+                  channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->hbd_16bit_source != 0 && config->hbd_16bit_source != 1) {
+        SVT_ERROR("Instance %u: Invalid 16-bit source flag [0 - 1]\n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->hbd_16bit_source &&
+        (config->encoder_bit_depth != 10 || config->superres_mode != SUPERRES_NONE)) {
+        SVT_ERROR("Instance %u: The 16-bit source requires a 10-bit input and super-resolution "
+                  "off\n",
+                  channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     if (config->use_cpu_flags & CPU_FLAGS_INVALID) {
         SVT_ERROR(
             "Instance %u: param '--asm' have invalid value.\n"
@@ -334,6 +359,42 @@ EbErrorType svt_av1_verify_settings(SequenceControlSet *scs_ptr) {
             config->enable_mfmv);
         return_error = EB_ErrorBadParameter;
     }
+    if (config->target_fps > 240) {
+        SVT_ERROR("Instance %u: The maximum allowed speed control target is 240 fps, your input: %u\n",
+                  channel_number + 1,
+                  config->target_fps);
+        return_error = EB_ErrorBadParameter;
+    }
+    if ((config->chunk_start_frame || config->chunk_frames) &&
+        !(config->pass == ENC_LAST_PASS ||
+          (config->pass == ENC_MIDDLE_PASS && config->rate_control_mode == 0))) {
+        SVT_ERROR("Instance %u: Chunked encoding is only supported in the final pass of a "
+                  "multi-pass encode\n",
+                  channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if ((config->chunk_start_frame || config->chunk_frames) && !config->rc_stats_buffer.buf) {
+        SVT_ERROR("Instance %u: Chunked encoding needs the stats of the whole sequence\n",
+                  channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (!config->stats_source_width != !config->stats_source_height) {
+        SVT_ERROR("Instance %u: The stats source width and height must be set together\n",
+                  channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->stats_source_width &&
+        (config->stats_source_width > 16384 || config->stats_source_height > 8704)) {
+        SVT_ERROR("Instance %u: The stats source resolution must be within 16384x8704\n",
+                  channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->scene_change_look_ahead > 2) {
+        SVT_ERROR("Instance %u: Invalid scene change look ahead [0 - 2], your input: %u\n",
+                  channel_number + 1,
+                  config->scene_change_look_ahead);
+        return_error = EB_ErrorBadParameter;
+    }
     if (config->fast_decode > 3) {
         SVT_ERROR(
             "Instance %u: Invalid fast decode flag [0 - 3, 0 for no decoder optimization], your "
@@ -419,12 +480,12 @@ EbErrorType svt_av1_verify_settings(SequenceControlSet *scs_ptr) {
         }
     }
 
-    if (config->superres_mode > SUPERRES_AUTO) {
+    if (config->superres_mode > SUPERRES_DYNAMIC) {
         SVT_ERROR("Instance %u: invalid superres-mode %d, should be in the range [%d - %d]\n",
                   channel_number + 1,
                   config->superres_mode,
                   SUPERRES_NONE,
-                  SUPERRES_AUTO);
+                  SUPERRES_DYNAMIC);
         return_error = EB_ErrorBadParameter;
     }
     if (config->superres_mode > 0 &&
@@ -635,6 +696,8 @@ EbErrorType svt_av1_set_default_params(EbSvtAv1EncConfiguration *config_ptr) {
     config_ptr->frame_rate_denominator    = 1000;
     config_ptr->encoder_bit_depth         = 8;
     config_ptr->compressed_ten_bit_format = 0;
+    config_ptr->p010_input                = 0;
+    config_ptr->hbd_16bit_source          = 0;
     config_ptr->source_width              = 0;
     config_ptr->source_height             = 0;
     config_ptr->stat_report               = 0;
@@ -654,6 +717,7 @@ EbErrorType svt_av1_set_default_params(EbSvtAv1EncConfiguration *config_ptr) {
     memset(config_ptr->chroma_qindex_offsets, 0, sizeof(config_ptr->chroma_qindex_offsets));
 
     config_ptr->scene_change_detection = 0;
+    config_ptr->scene_change_look_ahead = 2;
     config_ptr->rate_control_mode      = 0;
     config_ptr->look_ahead_distance    = (uint32_t)~0;
     config_ptr->enable_tpl_la          = 1;
@@ -667,12 +731,18 @@ EbErrorType svt_av1_set_default_params(EbSvtAv1EncConfiguration *config_ptr) {
     config_ptr->intra_period_length          = -2;
     config_ptr->intra_refresh_type           = 2;
     config_ptr->hierarchical_levels          = 4;
+    config_ptr->enable_adaptive_mini_gop     = EB_FALSE;
     config_ptr->pred_structure               = EB_PRED_RANDOM_ACCESS;
     config_ptr->enable_dlf_flag              = EB_TRUE;
     config_ptr->cdef_level                   = DEFAULT;
     config_ptr->enable_restoration_filtering = DEFAULT;
     config_ptr->enable_mfmv                  = DEFAULT;
     config_ptr->fast_decode                  = 0;
+    config_ptr->target_fps                   = 0;
+    config_ptr->chunk_start_frame            = 0;
+    config_ptr->chunk_frames                 = 0;
+    config_ptr->stats_source_width           = 0;
+    config_ptr->stats_source_height          = 0;
     memset(config_ptr->pred_struct, 0, sizeof(config_ptr->pred_struct));
     config_ptr->enable_manual_pred_struct    = EB_FALSE;
     config_ptr->manual_pred_struct_entry_num = 0;
@@ -687,6 +757,7 @@ EbErrorType svt_av1_set_default_params(EbSvtAv1EncConfiguration *config_ptr) {
     config_ptr->maximum_buffer_size_ms   = 6000;
     config_ptr->starting_buffer_level_ms = 4000;
     config_ptr->optimal_buffer_level_ms  = 5000;
+    config_ptr->cbr_inflight_estimates   = EB_TRUE;
     config_ptr->recode_loop              = ALLOW_RECODE_DEFAULT;
     // Bitstream options
     //config_ptr->codeVpsSpsPps = 0;
@@ -774,12 +845,27 @@ void svt_av1_print_lib_params(SequenceControlSet *scs) {
                  tier_to_str(config->tier),
                  level_to_str(config->level));
         SVT_INFO("SVT [config]: Preset \t\t\t\t\t\t\t: %d\n", config->enc_mode);
+        if (config->target_fps)
+            SVT_INFO("SVT [config]: Speed Control Target FPS \t\t\t\t\t: %d\n",
+                     config->target_fps);
+        if (config->chunk_start_frame || config->chunk_frames)
+            SVT_INFO("SVT [config]: Chunk Start Frame / Chunk Frames \t\t\t\t: %u / %u\n",
+                     config->chunk_start_frame,
+                     config->chunk_frames);
+        if (config->stats_source_width)
+            SVT_INFO("SVT [config]: Stats Source Width / Stats Source Height \t\t\t\t: %u / %u\n",
+                     config->stats_source_width,
+                     config->stats_source_height);
         SVT_INFO(
             "SVT [config]: EncoderBitDepth / EncoderColorFormat / CompressedTenBitFormat\t: %d / "
             "%d / %d\n",
             config->encoder_bit_depth,
             config->encoder_color_format,
             config->compressed_ten_bit_format);
+        if (config->p010_input)
+            SVT_INFO("SVT [config]: Input Layout \t\t\t\t\t\t\t: P010\n");
+        if (config->hbd_16bit_source)
+            SVT_INFO("SVT [config]: 16-bit Source \t\t\t\t\t\t\t: On\n");
         SVT_INFO("SVT [config]: SourceWidth / SourceHeight\t\t\t\t\t: %d / %d\n",
                  config->source_width,
                  config->source_height);
@@ -798,6 +884,10 @@ void svt_av1_print_lib_params(SequenceControlSet *scs) {
         SVT_INFO("SVT [config]: HierarchicalLevels  / PredStructure\t\t\t\t: %d / %d\n",
                  config->hierarchical_levels,
                  config->pred_structure);
+        if (config->enable_adaptive_mini_gop &&
+            (config->pass == ENC_MIDDLE_PASS || config->pass == ENC_LAST_PASS))
+            SVT_INFO("SVT [config]: AdaptiveMiniGop \t\t\t\t\t\t: %d\n",
+                     config->enable_adaptive_mini_gop);
         switch (config->rate_control_mode) {
         case 0:
             if (config->max_bit_rate)
@@ -828,8 +918,14 @@ void svt_av1_print_lib_params(SequenceControlSet *scs) {
                 "/ %d / %d\n",
                 (int)config->target_bit_rate / 1000,
                 config->scene_change_detection);
+            SVT_INFO("SVT [config]: BufSz / InFlight Size Estimates\t\t\t\t\t: %d / %d\n",
+                     (int)config->maximum_buffer_size_ms,
+                     config->cbr_inflight_estimates);
             break;
         }
+        if (config->scene_change_detection)
+            SVT_INFO("SVT [config]: SceneChange LookAhead \t\t\t\t\t\t: %d\n",
+                     config->scene_change_look_ahead);
     }
 #ifdef DEBUG_BUFFERS
     SVT_INFO("SVT [config]: INPUT / OUTPUT \t\t\t\t\t\t\t: %d / %d\n",
@@ -1267,6 +1363,7 @@ EB_API EbErrorType svt_av1_enc_parse_parameter(EbSvtAv1EncConfiguration *config_
         {"mbr", &config_struct->max_bit_rate},
         {"vbv-bufsize", &config_struct->vbv_bufsize},
         {"scd", &config_struct->scene_change_detection},
+        {"scd-lad", &config_struct->scene_change_look_ahead},
         {"max-qp", &config_struct->max_qp_allowed},
         {"min-qp", &config_struct->min_qp_allowed},
         {"bias-pct", &config_struct->vbr_bias_pct},
@@ -1279,6 +1376,13 @@ EB_API EbErrorType svt_av1_enc_parse_parameter(EbSvtAv1EncConfiguration *config_
         {"scm", &config_struct->screen_content_mode},
         {"input-depth", &config_struct->encoder_bit_depth},
         {"compressed-ten-bit-format", &config_struct->compressed_ten_bit_format},
+        {"p010-input", &config_struct->p010_input},
+        {"hbd-16bit-source", &config_struct->hbd_16bit_source},
+        {"target-fps", &config_struct->target_fps},
+        {"chunk-start", &config_struct->chunk_start_frame},
+        {"chunk-frames", &config_struct->chunk_frames},
+        {"stats-src-width", &config_struct->stats_source_width},
+        {"stats-src-height", &config_struct->stats_source_height},
     };
     const size_t uint_opts_size = sizeof(uint_opts) / sizeof(uint_opts[0]);
 
@@ -1388,6 +1492,8 @@ EB_API EbErrorType svt_av1_enc_parse_parameter(EbSvtAv1EncConfiguration *config_
         {"enable-tf", &config_struct->enable_tf},
         {"enable-overlays", &config_struct->enable_overlays},
         {"enable-hdr", &config_struct->high_dynamic_range_input},
+        {"cbr-inflight-est", &config_struct->cbr_inflight_estimates},
+        {"adaptive-mini-gop", &config_struct->enable_adaptive_mini_gop},
     };
     const size_t bool_opts_size = sizeof(bool_opts) / sizeof(bool_opts[0]);
 
@@ -21,6 +21,7 @@
 #include <math.h>
 #include <stdlib.h>
 #include <random>
+#include <vector>
 #include "EbCabacContextModel.h"
 #if defined(CHAR_BIT)
 #undef CHAR_BIT  // defined in clang/9.1.0/include/limits.h
@@ -316,4 +317,61 @@ TEST(Entropy_BitstreamWriter, write_symbol_with_update) {
                   rnd(gen));
     }
 }
+// Cover every alphabet size so each search and adaptation path of the
+// symbol decoder is exercised, with skewed symbol statistics.
+TEST(Entropy_BitstreamWriter, write_multi_symbol_with_update) {
+    AomWriter bw;
+    memset(&bw, 0, sizeof(bw));
+
+    const int buffer_size = 32768;
+    OutputBitstreamUnit output_bitstream_ptr;
+    std::vector<uint8_t> stream_buffer(buffer_size);
+    output_bitstream_ptr.buffer_av1 = stream_buffer.data();
+    output_bitstream_ptr.buffer_begin_av1 = stream_buffer.data();
+    output_bitstream_ptr.size = buffer_size;
+    bw.allow_update_cdf = 1;
+
+    const int max_symbols = 16;
+    AomCdfProb cdfs[max_symbols + 1][max_symbols + 1];
+    auto reset_cdfs = [&]() {
+        memset(cdfs, 0, sizeof(cdfs));
+        for (int nsymbs = 2; nsymbs <= max_symbols; nsymbs++) {
+            for (int i = 0; i < nsymbs; i++)
+                cdfs[nsymbs][i] =
+                    AOM_ICDF(CDF_PROB_TOP * (i + 1) / nsymbs);
+        }
+    };
+
+    std::mt19937 gen(deterministic_seeds);
+    std::vector<int> symbols;
+    reset_cdfs();
+    aom_start_encode(&bw, &output_bitstream_ptr);
+    for (int i = 0; i < 2000; ++i) {
+        for (int nsymbs = 2; nsymbs <= max_symbols; nsymbs++) {
+            // favour the low symbols to move the cdfs away from uniform
+            std::uniform_int_distribution<int> rnd(0, nsymbs - 1);
+            const int symbol = (i & 1) ? rnd(gen) : rnd(gen) >> 1;
+            symbols.push_back(symbol);
+            aom_write_symbol(&bw, symbol, cdfs[nsymbs], nsymbs);
+        }
+    }
+    aom_stop_encode(&bw);
+
+    SvtReader br;
+    memset(&br, 0, sizeof(br));
+    init_svt_reader(&br,
+                    stream_buffer.data(),
+                    stream_buffer.data() + buffer_size,
+                    bw.pos,
+                    1);
+    reset_cdfs();
+    size_t idx = 0;
+    for (int i = 0; i < 2000; ++i) {
+        for (int nsymbs = 2; nsymbs <= max_symbols; nsymbs++) {
+            ASSERT_EQ(svt_read_symbol(&br, cdfs[nsymbs], nsymbs, nullptr),
+                      symbols[idx++])
+                << "nsymbs " << nsymbs << " iteration " << i;
+        }
+    }
+}
 }  // namespace
@@ -23,6 +23,8 @@
  * - svt_unpack_avg_avx2_intrin
  * - svt_unpack_avg_sse2_intrin
  * - svt_unpack_avg_safe_sub_avx2_intrin
+ * - svt_unpack_p010_and_2bcompress_avx2
+ * - svt_unpack_p010_uv_and_2bcompress_avx2
  *
  * @author Cidana-Ivy, Cidana-Wenyao
  *
@@ -458,6 +460,152 @@ INSTANTIATE_TEST_CASE_P(
                        ::testing::Values(svt_unpack_and_2bcompress_sse4_1,
                                          svt_unpack_and_2bcompress_avx2)));
 
+// test svt_unpack_p010_and_2bcompress_avx2 and
+// svt_unpack_p010_uv_and_2bcompress_avx2. The luma C kernel is also checked
+// against svt_unpack_and_2bcompress_c() on the LSB aligned samples.
+class UnpackP010 : public ::testing::TestWithParam<AreaSize> {
+  public:
+    UnpackP010()
+        : area_width_(std::get<0>(GetParam())),
+          area_height_(std::get<1>(GetParam())) {
+        // the interleaved chroma rows hold 2 samples per pixel
+        in_stride_ = 2 * MAX_TEST_SIZE;
+        out8_stride_ = MAX_TEST_SIZE;
+        out2_stride_ = MAX_TEST_SIZE >> 2;
+        in_size_ = in_stride_ * MAX_TEST_SIZE;
+        out_size_ = MAX_TEST_SIZE * MAX_TEST_SIZE;
+    }
+
+    void SetUp() override {
+        in_16bit_ = reinterpret_cast<uint16_t *>(
+            svt_aom_memalign(32, sizeof(uint16_t) * in_size_));
+        in_lsb_ = reinterpret_cast<uint16_t *>(
+            svt_aom_memalign(32, sizeof(uint16_t) * in_size_));
+        for (int i = 0; i < 4; i++) {
+            out8_[i] = reinterpret_cast<uint8_t *>(
+                svt_aom_memalign(32, out_size_));
+            out2_[i] = reinterpret_cast<uint8_t *>(
+                svt_aom_memalign(32, out_size_ >> 2));
+            memset(out8_[i], 0, out_size_);
+            memset(out2_[i], 0, out_size_ >> 2);
+        }
+    }
+
+    void TearDown() override {
+        svt_aom_free(in_16bit_);
+        svt_aom_free(in_lsb_);
+        for (int i = 0; i < 4; i++) {
+            svt_aom_free(out8_[i]);
+            svt_aom_free(out2_[i]);
+        }
+        aom_clear_system_state();
+    }
+
+  protected:
+    void check_output(uint32_t width, uint32_t height, const uint8_t *out_1,
+                      const uint8_t *out_2, uint32_t out_stride) {
+        int fail_count = 0;
+        for (uint32_t j = 0; j < height; j++) {
+            for (uint32_t k = 0; k < width; k++) {
+                if (out_1[k + j * out_stride] != out_2[k + j * out_stride])
+                    fail_count++;
+            }
+        }
+        EXPECT_EQ(0, fail_count) << "compare result error in test area for "
+                                 << fail_count << " times";
+    }
+
+    void check_planes(int ref, int mod) {
+        check_output((area_width_ + 3) >> 2,
+                     area_height_,
+                     out2_[ref],
+                     out2_[mod],
+                     out2_stride_);
+        check_output(
+            area_width_, area_height_, out8_[ref], out8_[mod], out8_stride_);
+    }
+
+    void run_test() {
+        for (int i = 0; i < RANDOM_TIME; i++) {
+            svt_buf_random_u16(in_16bit_, in_size_);
+            for (uint32_t j = 0; j < in_size_; j++)
+                in_lsb_[j] = in_16bit_[j] >> 6;
+
+            // luma
+            svt_unpack_and_2bcompress_c(in_lsb_,
+                                        in_stride_,
+                                        out8_[0],
+                                        out8_stride_,
+                                        out2_[0],
+                                        out2_stride_,
+                                        area_width_,
+                                        area_height_);
+            svt_unpack_p010_and_2bcompress_c(in_16bit_,
+                                             in_stride_,
+                                             out8_[1],
+                                             out8_stride_,
+                                             out2_[1],
+                                             out2_stride_,
+                                             area_width_,
+                                             area_height_);
+            svt_unpack_p010_and_2bcompress_avx2(in_16bit_,
+                                                in_stride_,
+                                                out8_[2],
+                                                out8_stride_,
+                                                out2_[2],
+                                                out2_stride_,
+                                                area_width_,
+                                                area_height_);
+            check_planes(0, 1);
+            check_planes(1, 2);
+
+            // interleaved chroma
+            svt_unpack_p010_uv_and_2bcompress_c(in_16bit_,
+                                                in_stride_,
+                                                out8_[0],
+                                                out8_[1],
+                                                out8_stride_,
+                                                out2_[0],
+                                                out2_[1],
+                                                out2_stride_,
+                                                area_width_,
+                                                area_height_);
+            svt_unpack_p010_uv_and_2bcompress_avx2(in_16bit_,
+                                                   in_stride_,
+                                                   out8_[2],
+                                                   out8_[3],
+                                                   out8_stride_,
+                                                   out2_[2],
+                                                   out2_[3],
+                                                   out2_stride_,
+                                                   area_width_,
+                                                   area_height_);
+            check_planes(0, 2);
+            check_planes(1, 3);
+
+            EXPECT_FALSE(HasFailure())
+                << "svt_unpack_p010 failed at " << i << "th test with size ("
+                << area_width_ << "," << area_height_ << ")";
+        }
+    }
+
+    uint16_t *in_16bit_, *in_lsb_;
+    uint8_t *out8_[4], *out2_[4];
+    uint32_t in_stride_, out8_stride_, out2_stride_;
+    uint32_t in_size_, out_size_;
+    uint32_t area_width_, area_height_;
+};
+
+TEST_P(UnpackP010, UnpackP010) {
+    run_test();
+};
+
+INSTANTIATE_TEST_CASE_P(UNPACKP010, UnpackP010,
+                        ::testing::ValuesIn(TEST_PACK_SIZES));
+
+INSTANTIATE_TEST_CASE_P(UNPACKP010_EXTEND, UnpackP010,
+                        ::testing::ValuesIn(TEST_PACK_SIZES_EXTEND));
+
 // test svt_enc_msb_pack2d_avx2_intrin_al and svt_enc_msb_pack2d_sse2_intrin.
 // There is an implicit assumption that the width should be multiple of 4.
 // Also there are special snippet to handle width of {4, 8, 16, 32, 64}, so use
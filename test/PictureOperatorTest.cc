@@ -17,6 +17,8 @@
  * - svt_picture_average_kernel_sse2_intrin
  * - svt_picture_average_kernel1_line_sse2_intrin
  * - picture_copy_kernel_sse2
+ * - downsample_2d_avx2
+ * - downsample_2d_pyramid_avx2
  *
  * @author Cidana-Ivy
  *
@@ -43,6 +45,7 @@
 #include "common_dsp_rtcd.h"
 #include "aom_dsp_rtcd.h"
 #include "EbMotionEstimation.h"
+#include "EbTime.h"
 using svt_av1_test_tool::SVTRandom;  // to generate the random
 
 namespace {
@@ -288,4 +291,156 @@ INSTANTIATE_TEST_CASE_P(
     Downsample2D, Downsample2DTest,
     ::testing::Combine(::testing::ValuesIn(DOWNSAMPLE_SIZES),
                        ::testing::ValuesIn(DECIM_STEPS)));
+
+PUSize PYRAMID_SIZES[] = {PUSize(1920, 1080),
+                          PUSize(960, 540),
+                          PUSize(200, 130),
+                          PUSize(176, 144),
+                          PUSize(104, 66),
+                          PUSize(88, 72)};
+PUSize PYRAMID_SPEED_SIZES[] = {PUSize(3840, 2160), PUSize(7680, 4320)};
+
+// The fused 1/4 + 1/16 kernel must match two cascaded downsample_2d calls
+class Downsample2DPyramidTest
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<PUSize> {
+  public:
+    Downsample2DPyramidTest()
+        : width(std::get<0>(GetParam())), height(std::get<1>(GetParam())) {
+        stride = width + 2 * PAD;
+        quarter_stride = (width >> 1) + PAD;
+        sixteenth_stride = (width >> 2) + PAD;
+        src_size = stride * (height + 2 * PAD);
+        quarter_size = quarter_stride * ((height >> 1) + PAD);
+        sixteenth_size = sixteenth_stride * ((height >> 2) + PAD);
+        src_ptr = (uint8_t *)malloc(src_size);
+        for (int i = 0; i < 2; i++) {
+            quarter_ptr[i] = (uint8_t *)malloc(quarter_size);
+            sixteenth_ptr[i] = (uint8_t *)malloc(sixteenth_size);
+        }
+    }
+
+    void TearDown() override {
+        free(src_ptr);
+        for (int i = 0; i < 2; i++) {
+            free(quarter_ptr[i]);
+            free(sixteenth_ptr[i]);
+        }
+    }
+
+  protected:
+    static const uint32_t PAD = 64;
+
+    void prepare_data() {
+        SVTRandom rnd(0, (1 << 8) - 1);
+        for (uint32_t i = 0; i < src_size; i++)
+            src_ptr[i] = rnd.random();
+        uint8_t val = rnd.random();
+        for (int i = 0; i < 2; i++) {
+            memset(quarter_ptr[i], val, quarter_size);
+            memset(sixteenth_ptr[i], val, sixteenth_size);
+        }
+    }
+
+    void run_cascade(int idx) {
+        downsample_2d_avx2(src_ptr + PAD * stride + PAD,
+                           stride,
+                           width,
+                           height,
+                           quarter_ptr[idx],
+                           quarter_stride,
+                           2);
+        downsample_2d_avx2(quarter_ptr[idx],
+                           quarter_stride,
+                           width >> 1,
+                           height >> 1,
+                           sixteenth_ptr[idx],
+                           sixteenth_stride,
+                           2);
+    }
+
+    void run_pyramid(int idx, bool use_c) {
+        (use_c ? downsample_2d_pyramid_c : downsample_2d_pyramid_avx2)(
+            src_ptr + PAD * stride + PAD,
+            stride,
+            width,
+            height,
+            quarter_ptr[idx],
+            quarter_stride,
+            sixteenth_ptr[idx],
+            sixteenth_stride);
+    }
+
+    void check_output() {
+        EXPECT_EQ(memcmp(quarter_ptr[0], quarter_ptr[1], quarter_size), 0);
+        EXPECT_EQ(memcmp(sixteenth_ptr[0], sixteenth_ptr[1], sixteenth_size),
+                  0);
+    }
+
+    void run_test() {
+        for (int i = 0; i < 10; i++) {
+            prepare_data();
+            run_cascade(0);
+            run_pyramid(1, true);
+            check_output();
+            run_pyramid(1, false);
+            check_output();
+        }
+    }
+
+    void speed_test() {
+        const uint64_t num_loop = 100000000 / (width * height) + 1;
+        uint64_t start_time_seconds, start_time_useconds;
+        uint64_t middle_time_seconds, middle_time_useconds;
+        uint64_t finish_time_seconds, finish_time_useconds;
+
+        prepare_data();
+        svt_av1_get_time(&start_time_seconds, &start_time_useconds);
+        for (uint64_t i = 0; i < num_loop; i++)
+            run_cascade(0);
+        svt_av1_get_time(&middle_time_seconds, &middle_time_useconds);
+        for (uint64_t i = 0; i < num_loop; i++)
+            run_pyramid(1, false);
+        svt_av1_get_time(&finish_time_seconds, &finish_time_useconds);
+        check_output();
+
+        const double time_cascade = svt_av1_compute_overall_elapsed_time_ms(
+            start_time_seconds,
+            start_time_useconds,
+            middle_time_seconds,
+            middle_time_useconds);
+        const double time_fused = svt_av1_compute_overall_elapsed_time_ms(
+            middle_time_seconds,
+            middle_time_useconds,
+            finish_time_seconds,
+            finish_time_useconds);
+        printf("    1/4 + 1/16 pyramid (%ux%u): cascaded %6.3f ms, fused %6.3f ms "
+               "(%5.2fx)\n",
+               width,
+               height,
+               time_cascade / num_loop,
+               time_fused / num_loop,
+               time_cascade / time_fused);
+    }
+
+    uint32_t width, height;
+    uint32_t stride, quarter_stride, sixteenth_stride;
+    uint32_t src_size, quarter_size, sixteenth_size;
+    uint8_t *src_ptr;
+    uint8_t *quarter_ptr[2], *sixteenth_ptr[2];
+};
+
+TEST_P(Downsample2DPyramidTest, MatchTest) {
+    run_test();
+}
+
+TEST_P(Downsample2DPyramidTest, DISABLED_Speed) {
+    speed_test();
+}
+
+INSTANTIATE_TEST_CASE_P(Downsample2DPyramid, Downsample2DPyramidTest,
+                        ::testing::ValuesIn(PYRAMID_SIZES));
+
+INSTANTIATE_TEST_CASE_P(Downsample2DPyramidSpeed, Downsample2DPyramidTest,
+                        ::testing::ValuesIn(PYRAMID_SPEED_SIZES));
 }  // namespace
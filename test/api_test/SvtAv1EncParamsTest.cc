@@ -250,6 +250,14 @@ PARAM_TEST(EncParamEncBitDepthTest);
 DEFINE_PARAM_TEST_CLASS(EncParamCompr10BitFmtTest, compressed_ten_bit_format);
 PARAM_TEST(EncParamCompr10BitFmtTest);
 
+/** Test case for p010_input*/
+DEFINE_PARAM_TEST_CLASS(EncParamP010InputTest, p010_input);
+PARAM_TEST(EncParamP010InputTest);
+
+/** Test case for hbd_16bit_source*/
+DEFINE_PARAM_TEST_CLASS(EncParamHbd16bitSourceTest, hbd_16bit_source);
+PARAM_TEST(EncParamHbd16bitSourceTest);
+
 /** Test case for qp*/
 DEFINE_PARAM_TEST_CLASS(EncParamQPTest, qp);
 PARAM_TEST(EncParamQPTest);
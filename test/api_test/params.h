@@ -310,6 +310,34 @@ static const vector<uint32_t> invalid_compressed_ten_bit_format = {
     2, 10,  // ...
 };
 
+/* 10-bit input in the P010 layout.
+ *
+ * Default is 0. */
+static const vector<uint32_t> default_p010_input = {
+    0,
+};
+static const vector<uint32_t> valid_p010_input = {
+    0,
+    // 1, Requires a 10-bit input
+};
+static const vector<uint32_t> invalid_p010_input = {
+    2, 10,  // ...
+};
+
+/* Keep a 16-bit copy of the 10-bit source picture.
+ *
+ * Default is 0. */
+static const vector<uint32_t> default_hbd_16bit_source = {
+    0,
+};
+static const vector<uint32_t> valid_hbd_16bit_source = {
+    0,
+    // 1, Requires a 10-bit input
+};
+static const vector<uint32_t> invalid_hbd_16bit_source = {
+    2, 10,  // ...
+};
+
 /* Number of frames of sequence to be encoded. If number of frames is greater
  * than the number of frames in file, the encoder will loop to the beginning
  * and continue the encode.
@@ -11,6 +11,7 @@
  */
 
 #include <stdlib.h>
+#include <algorithm>
 #include "gtest/gtest.h"
 #include "aom_dsp_rtcd.h"
 #include "EbDefinitions.h"
@@ -18,7 +19,9 @@
 #include "util.h"
 #include "EbUnitTestUtility.h"
 #include "acm_random.h"
+extern "C" {
 #include "corner_match.h"
+}
 
 using libaom_test::ACMRandom;
 
@@ -157,4 +160,194 @@ INSTANTIATE_TEST_CASE_P(
                       make_tuple(0, &svt_av1_compute_cross_correlation_avx2),
                       make_tuple(1, &svt_av1_compute_cross_correlation_avx2)));
 
+// Reference for svt_av1_determine_correspondence(): the plain scan of all the
+// ref corners for each frame corner, followed by improve_correspondence().
+static int ref_determine_correspondence(unsigned char *frm, int *frm_corners,
+                                        int num_frm_corners, unsigned char *ref,
+                                        int *ref_corners, int num_ref_corners,
+                                        int width, int height, int stride,
+                                        Correspondence *corr) {
+    const int thresh = (width < height ? height : width) >> 4;
+    const int thresh_sqr = thresh * thresh;
+    const int search_by2 = 4;
+    int num_corr = 0;
+    auto eligible = [&](int x, int y) {
+        return x >= MATCH_SZ_BY2 && y >= MATCH_SZ_BY2 &&
+               x + MATCH_SZ_BY2 < width && y + MATCH_SZ_BY2 < height;
+    };
+    auto near = [&](int x1, int y1, int x2, int y2) {
+        return (x1 - x2) * (x1 - x2) + (y1 - y2) * (y1 - y2) <= thresh_sqr;
+    };
+    for (int i = 0; i < num_frm_corners; ++i) {
+        const int x = frm_corners[2 * i], y = frm_corners[2 * i + 1];
+        double best_ncc = 0.0;
+        int best_j = -1;
+        if (!eligible(x, y))
+            continue;
+        for (int j = 0; j < num_ref_corners; ++j) {
+            const int rx = ref_corners[2 * j], ry = ref_corners[2 * j + 1];
+            if (!eligible(rx, ry) || !near(x, y, rx, ry))
+                continue;
+            const double ncc = svt_av1_compute_cross_correlation_c(
+                frm, stride, x, y, ref, stride, rx, ry);
+            if (ncc > best_ncc) {
+                best_ncc = ncc;
+                best_j = j;
+            }
+        }
+        int sum = 0, sumsq = 0;
+        for (int r = 0; r < MATCH_SZ; ++r)
+            for (int c = 0; c < MATCH_SZ; ++c) {
+                const int v =
+                    frm[(y + r - MATCH_SZ_BY2) * stride + x + c - MATCH_SZ_BY2];
+                sum += v;
+                sumsq += v * v;
+            }
+        const int template_norm = sumsq * MATCH_SZ_SQ - sum * sum;
+        if (best_ncc > template_norm * 0.75 * 0.75) {
+            corr[num_corr].x = x;
+            corr[num_corr].y = y;
+            corr[num_corr].rx = ref_corners[2 * best_j];
+            corr[num_corr].ry = ref_corners[2 * best_j + 1];
+            num_corr++;
+        }
+    }
+    for (int i = 0; i < num_corr; ++i) {
+        int best_x = 0, best_y = 0;
+        double best_ncc = 0.0;
+        for (int y = -search_by2; y <= search_by2; ++y)
+            for (int x = -search_by2; x <= search_by2; ++x) {
+                if (!eligible(corr[i].rx + x, corr[i].ry + y) ||
+                    !near(corr[i].x, corr[i].y, corr[i].rx + x, corr[i].ry + y))
+                    continue;
+                const double ncc = svt_av1_compute_cross_correlation_c(
+                    frm, stride, corr[i].x, corr[i].y, ref, stride,
+                    corr[i].rx + x, corr[i].ry + y);
+                if (ncc > best_ncc) {
+                    best_ncc = ncc;
+                    best_x = x;
+                    best_y = y;
+                }
+            }
+        corr[i].rx += best_x;
+        corr[i].ry += best_y;
+    }
+    for (int i = 0; i < num_corr; ++i) {
+        int best_x = 0, best_y = 0;
+        double best_ncc = 0.0;
+        for (int y = -search_by2; y <= search_by2; ++y)
+            for (int x = -search_by2; x <= search_by2; ++x) {
+                if (!eligible(corr[i].x + x, corr[i].y + y) ||
+                    !near(corr[i].x + x, corr[i].y + y, corr[i].rx, corr[i].ry))
+                    continue;
+                const double ncc = svt_av1_compute_cross_correlation_c(
+                    ref, stride, corr[i].rx, corr[i].ry, frm, stride,
+                    corr[i].x + x, corr[i].y + y);
+                if (ncc > best_ncc) {
+                    best_ncc = ncc;
+                    best_x = x;
+                    best_y = y;
+                }
+            }
+        corr[i].x += best_x;
+        corr[i].y += best_y;
+    }
+    return num_corr;
+}
+
+// svt_av1_determine_correspondence() only visits the ref corners of the rows
+// near each frame corner; check it picks the same matches as the full scan,
+// including the ties between duplicated ref corners.
+TEST(AV1DetermineCorrespondenceTest, MatchesFullScan) {
+    const int w = 320, h = 180;
+    const int num_corners = 1500;
+    ACMRandom rnd(ACMRandom::DeterministicSeed());
+    uint8_t *frm = new uint8_t[w * h];
+    uint8_t *ref = new uint8_t[w * h];
+    int *frm_corners = new int[2 * num_corners];
+    int *ref_corners = new int[2 * num_corners];
+    Correspondence *corr = new Correspondence[num_corners];
+    Correspondence *corr_ref = new Correspondence[num_corners];
+
+    for (int iter = 0; iter < 8; ++iter) {
+        // Random texture, tiled in the second half of the iterations so that
+        // ref corners on different rows tie; ref is the frame moved by a
+        // small offset
+        const int dx = (int)rnd.PseudoUniform(9) - 4;
+        const int dy = (int)rnd.PseudoUniform(9) - 4;
+        uint8_t tile[8 * 8];
+        for (int i = 0; i < 8 * 8; ++i) tile[i] = rnd.Rand8();
+        for (int i = 0; i < h; ++i)
+            for (int j = 0; j < w; ++j)
+                frm[i * w + j] = iter < 4 ? (uint8_t)(((i * 7 + j * 3) & 63) * 2 +
+                                                      (rnd.Rand8() & 63))
+                                          : tile[(i & 7) * 8 + (j & 7)];
+        for (int i = 0; i < h; ++i)
+            for (int j = 0; j < w; ++j) {
+                const int si = AOMMIN(AOMMAX(i + dy, 0), h - 1);
+                const int sj = AOMMIN(AOMMAX(j + dx, 0), w - 1);
+                ref[i * w + j] = (iter & 1) ? frm[si * w + sj]
+                                            : (uint8_t)(frm[si * w + sj] / 2 +
+                                                        (rnd.Rand8() & 31));
+            }
+        for (int i = 0; i < num_corners; ++i) {
+            frm_corners[2 * i] = rnd.Rand16() % w;
+            frm_corners[2 * i + 1] = rnd.Rand16() % h;
+            if (i && !(rnd.Rand8() & 3)) {
+                // duplicated ref corners give equal correlations
+                const int k = rnd.Rand16() % i;
+                ref_corners[2 * i] = ref_corners[2 * k];
+                ref_corners[2 * i + 1] = ref_corners[2 * k + 1];
+            } else {
+                ref_corners[2 * i] = AOMMIN(AOMMAX(frm_corners[2 * i] - dx, 0), w - 1);
+                ref_corners[2 * i + 1] =
+                    AOMMIN(AOMMAX(frm_corners[2 * i + 1] - dy, 0), h - 1);
+            }
+        }
+        // shuffle the ref corners out of raster and frame order
+        for (int i = num_corners - 1; i > 0; --i) {
+            const int k = rnd.Rand16() % (i + 1);
+            std::swap(ref_corners[2 * i], ref_corners[2 * k]);
+            std::swap(ref_corners[2 * i + 1], ref_corners[2 * k + 1]);
+        }
+
+        const int num_ref = ref_determine_correspondence(frm,
+                                                         frm_corners,
+                                                         num_corners,
+                                                         ref,
+                                                         ref_corners,
+                                                         num_corners,
+                                                         w,
+                                                         h,
+                                                         w,
+                                                         corr_ref);
+        const int num = svt_av1_determine_correspondence(frm,
+                                                         frm_corners,
+                                                         num_corners,
+                                                         ref,
+                                                         ref_corners,
+                                                         num_corners,
+                                                         w,
+                                                         h,
+                                                         w,
+                                                         w,
+                                                         (int *)corr);
+        ASSERT_GT(num_ref, 0);
+        ASSERT_EQ(num, num_ref) << "iter " << iter;
+        for (int i = 0; i < num; ++i) {
+            ASSERT_EQ(corr[i].x, corr_ref[i].x) << "iter " << iter << " i " << i;
+            ASSERT_EQ(corr[i].y, corr_ref[i].y) << "iter " << iter << " i " << i;
+            ASSERT_EQ(corr[i].rx, corr_ref[i].rx) << "iter " << iter << " i " << i;
+            ASSERT_EQ(corr[i].ry, corr_ref[i].ry) << "iter " << iter << " i " << i;
+        }
+    }
+
+    delete[] frm;
+    delete[] ref;
+    delete[] frm_corners;
+    delete[] ref_corners;
+    delete[] corr;
+    delete[] corr_ref;
+}
+
 }  // namespace
@@ -153,6 +153,11 @@ void SvtAv1E2ETestFramework::post_process() {
         output_stat();
 }
 
+void SvtAv1E2ETestFramework::check_output_packet(
+    const EbBufferHeaderType *output) {
+    (void)output;
+}
+
 void SvtAv1E2ETestFramework::init_test(TestVideoVector &test_vector) {
     start_pos_ = std::get<7>(test_vector);
     frames_to_test_ = std::get<8>(test_vector);
@@ -463,6 +468,7 @@ void SvtAv1E2ETestFramework::run_encode_process() {
                 if (return_error != EB_NoErrorEmptyQueue && enc_out) {
                     // send to reference decoder
                     TimeAutoCount counter(CONFORMANCE, collect_);
+                    check_output_packet(enc_out);
                     process_compress_data(enc_out);
                     if (enc_out->flags & EB_BUFFERFLAG_EOS) {
                         enc_file_eos = true;
@@ -96,6 +96,12 @@ class SvtAv1E2ETestFramework : public ::testing::TestWithParam<EncTestSetting> {
     */
     virtual void post_process();
 
+    /** Add custom check of every output packet here, which will be invoked
+     before the packet is written to file or sent to the reference decoder.
+     @param output  compressed data from encoder
+    */
+    virtual void check_output_packet(const EbBufferHeaderType *output);
+
     /** Initialize the test, including
      create and setup encoder, setup input and output buffer
      create decoder if required.
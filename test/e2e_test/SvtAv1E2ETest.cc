@@ -19,6 +19,7 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
 #include "EbSvtAv1Enc.h"
 #include "gtest/gtest.h"
 #include "SvtAv1E2EFramework.h"
@@ -495,3 +496,108 @@ INSTANTIATE_TEST_CASE_P(
     SUPERRESQTHRESTEST, SuperResTest,
     ::testing::ValuesIn(generate_super_res_q_threshold_settings()),
     EncTestSetting::GetSettingName);
+
+/**
+ * @brief SVT-AV1 encoder E2E test of the CBR client buffer model
+ *
+ * Test strategy:
+ * Setup SVT-AV1 encoder in one pass CBR with different bitrates, with and
+ * without the in-flight frame size estimates, and drain a leaky bucket model
+ * of the client buffer with the size of every output packet: shown frames add
+ * one frame period of the target bitrate, hidden (ALT_REF) frames are pure
+ * overhead, and the level is clipped to the buffer size.
+ *
+ * Expected result:
+ * The buffer level never drops below empty. The number of violations and the
+ * lowest level reached are reported for each test vector.
+ *
+ * Test coverage:
+ * All test vectors
+ */
+class CbrBufferModelTest : public SvtAv1E2ETestFramework {
+  protected:
+    void config_test() override {
+        enable_config = true;
+        SvtAv1E2ETestFramework::config_test();
+    }
+
+    void update_enc_setting() override {
+        SvtAv1E2ETestFramework::update_enc_setting();
+        const EbSvtAv1EncConfiguration &config = av1enc_ctx_.enc_params;
+        double fps;
+        if (config.frame_rate_numerator && config.frame_rate_denominator)
+            fps = (double)config.frame_rate_numerator /
+                  config.frame_rate_denominator;
+        else if (config.frame_rate > 1000)
+            fps = config.frame_rate / 65536.0;
+        else
+            fps = config.frame_rate;
+        bits_per_frame_ = config.target_bit_rate / fps;
+        buffer_size_ =
+            (double)config.maximum_buffer_size_ms * config.target_bit_rate /
+            1000;
+        buffer_level_ = (double)config.starting_buffer_level_ms *
+                        config.target_bit_rate / 1000;
+        lowest_level_ = buffer_level_;
+        violations_ = 0;
+        packets_ = 0;
+    }
+
+    void check_output_packet(const EbBufferHeaderType *output) override {
+        if (output->n_filled_len == 0)
+            return;
+        const double bits = 8.0 * output->n_filled_len;
+        if (output->flags & EB_BUFFERFLAG_IS_ALT_REF)
+            buffer_level_ -= bits;
+        else
+            buffer_level_ += bits_per_frame_ - bits;
+        buffer_level_ = std::min(buffer_level_, buffer_size_);
+        lowest_level_ = std::min(lowest_level_, buffer_level_);
+        if (buffer_level_ < 0)
+            violations_++;
+        packets_++;
+    }
+
+    void post_process() override {
+        printf("CBR buffer model: %u packets, %u violations, lowest level "
+               "%.0f of %.0f bits\n",
+               packets_,
+               violations_,
+               lowest_level_,
+               buffer_size_);
+        EXPECT_EQ(violations_, 0u)
+            << "client buffer underflow in " << violations_ << " of "
+            << packets_ << " packets";
+        SvtAv1E2ETestFramework::post_process();
+    }
+
+  private:
+    double bits_per_frame_;
+    double buffer_size_;
+    double buffer_level_;
+    double lowest_level_;
+    uint32_t violations_;
+    uint32_t packets_;
+};
+
+TEST_P(CbrBufferModelTest, BufferLevelTest) {
+    run_test();
+}
+
+/* clang-format off */
+static const std::vector<EncTestSetting> cbr_buffer_settings = {
+    {"CbrBufferTest1", {{"RateControlMode", "2"}, {"TargetBitRate", "1000000"}}, default_test_vectors},
+    {"CbrBufferTest2", {{"RateControlMode", "2"}, {"TargetBitRate", "2000000"}}, default_test_vectors},
+    {"CbrBufferTest3", {{"RateControlMode", "2"}, {"TargetBitRate", "1000000"}, {"BufSz", "1000"},
+                        {"BufInitialSz", "600"}, {"BufOptimalSz", "800"}}, default_test_vectors},
+    {"CbrBufferTest4", {{"RateControlMode", "2"}, {"TargetBitRate", "1000000"}, {"CbrInflightEst", "0"}},
+     default_test_vectors},
+    {"CbrBufferTest5", {{"RateControlMode", "2"}, {"TargetBitRate", "1000000"}, {"BufSz", "1000"},
+                        {"BufInitialSz", "600"}, {"BufOptimalSz", "800"}, {"CbrInflightEst", "0"}},
+     default_test_vectors},
+};
+/* clang-format on */
+
+INSTANTIATE_TEST_CASE_P(SvtAv1, CbrBufferModelTest,
+                        ::testing::ValuesIn(cbr_buffer_settings),
+                        EncTestSetting::GetSettingName);